@@ -0,0 +1,119 @@
+#include "batch.h"
+#include "simd.h"
+#include <math.h>
+using namespace la;
+
+
+/// intersection des cercles d'une jambe, sur `simd::width` poses a la fois
+/// h est l'axe horizontal du plan de la jambe, f l'axe normal au plan (voir Delta::mgi)
+static void leg_batch(const Delta &model, DeltaBatch &batch, size_t i, size_t h, size_t f, size_t p) {
+	using namespace simd;
+	const vec3 &bi = model.b[i];
+	const pack R2 = set(sq(model.R));
+	const pack l2 = set(sq(model.l));
+	const pack two = set(2);
+	const pack zero = set(0);
+
+	pack Sh = load(&batch.a[i][h][p]);
+	pack Sf = load(&batch.a[i][f][p]);
+	pack Sz = load(&batch.a[i][2][p]);
+	pack bh = set(bi(h));
+
+	// meme forme que Delta::mgi: intersection du cercle du levier et du cercle de la tringle dans le plan de la jambe
+	pack sk = Sf - set(bi(f));		// distance de S au plan
+	pack L2 = R2 - sk*sk;
+	pack B = bh - Sh;
+	pack A = set(bi(2)) - Sz;
+	pack d = sqrt(A*A + B*B);
+	pack m = (d*d + L2 - l2) / (two*d);
+	pack hc = sqrt(L2 - m*m);
+	pack sign = select(B < zero, set(-1), set(1));
+	pack z2 = (A*m + abs(B)*hc) / d + Sz;
+	pack h2 = (B*m - sign*A*hc) / d + Sh;
+
+	store(&batch.c[i][h][p], h2);
+	store(&batch.c[i][f][p], set(bi(f)));
+	store(&batch.c[i][2][p], z2);
+	// l'arctangente reste scalaire pour donner exactement le meme resultat que mgi
+	float num[width], den[width];
+	store(num, z2);
+	store(den, abs(h2 - bh));
+	for (size_t k=0; k<width; k++)	batch.q[i][p+k] = atan2(num[k], den[k]);
+}
+
+/// matrice de rotation associée a un quaternion, sur `simd::width` poses a la fois (meme formule que quat2mat)
+static void quat2mat_batch(const simd::pack q[4], simd::pack m[3][3]) {
+	using namespace simd;
+	const pack one = set(1);
+	const pack two = set(2);
+	m[0][0] = two*(q[0]*q[0] + q[1]*q[1]) - one;
+	m[0][1] = two*(q[1]*q[2] - q[0]*q[3]);
+	m[0][2] = two*(q[1]*q[3] + q[0]*q[2]);
+	m[1][0] = two*(q[1]*q[2] + q[0]*q[3]);
+	m[1][1] = two*(q[0]*q[0] + q[2]*q[2]) - one;
+	m[1][2] = two*(q[2]*q[3] - q[0]*q[1]);
+	m[2][0] = two*(q[1]*q[3] - q[0]*q[2]);
+	m[2][1] = two*(q[2]*q[3] + q[0]*q[1]);
+	m[2][2] = two*(q[0]*q[0] + q[3]*q[3]) - one;
+}
+
+/// positions des rotules de la plateforme, sur `simd::width` poses a la fois
+static void platform_batch(const Delta &model, DeltaBatch &batch, const float quat[2][4][batch_size], size_t p) {
+	using namespace simd;
+	pack qe[4], qg[4], qd[4];
+	for (size_t k=0; k<4; k++) {
+		qe[k] = load(&quat[0][k][p]);
+		qg[k] = load(&quat[1][k][p]);
+	}
+	// la sous-plateforme droite tourne en sens inverse de la gauche: quaternion conjugué
+	qd[0] = qg[0];
+	for (size_t k=1; k<4; k++)	qd[k] = set(0) - qg[k];
+	
+	pack bRe[3][3], eRrg[3][3], eRrd[3][3], matg[3][3], matd[3][3];
+	quat2mat_batch(qe, bRe);
+	quat2mat_batch(qg, eRrg);
+	quat2mat_batch(qd, eRrd);
+	for (size_t r=0; r<3; r++)
+		for (size_t c=0; c<3; c++) {
+			matg[r][c] = bRe[r][0]*eRrg[0][c] + bRe[r][1]*eRrg[1][c] + bRe[r][2]*eRrg[2][c];
+			matd[r][c] = bRe[r][0]*eRrd[0][c] + bRe[r][1]*eRrd[1][c] + bRe[r][2]*eRrd[2][c];
+		}
+	pack t[3] = {load(&batch.X[0][p]), load(&batch.X[1][p]), load(&batch.X[2][p])};
+	
+	for (size_t i=0; i<N; i++) {
+		const vec4 &A = model.RgA[i];
+		pack (*m)[3] = i<4? matg: matd;
+		for (size_t r=0; r<3; r++)
+			store(&batch.a[i][r][p], m[r][0]*set(A(0)) + m[r][1]*set(A(1)) + m[r][2]*set(A(2)) + t[r]*set(A(3)));
+	}
+}
+
+void mgi_batch(const Delta &model, DeltaBatch &batch, size_t n) {
+	if (!n)		return;
+	// completer le dernier pack avec la derniere pose pour ne pas calculer sur des valeurs indefinies
+	size_t end = (n + simd::width-1) / simd::width * simd::width;
+	for (size_t p=n; p<end; p++)
+		for (size_t i=0; i<N; i++)	batch.X[i][p] = batch.X[i][n-1];
+
+	// seuls les sinus et cosinus des quaternions restent scalaires
+	float quat[2][4][batch_size];
+	for (size_t p=0; p<end; p++) {
+		vec4 qe = vec2quat(vec(batch.X[3][p], batch.X[4][p], batch.X[5][p]));
+		vec4 qg = vec2quat(vec(batch.X[6][p], batch.X[7][p], 0));
+		for (size_t k=0; k<4; k++) {
+			quat[0][k][p] = qe(k);
+			quat[1][k][p] = qg(k);
+		}
+	}
+
+	// jambes dans un plan x = a (axe horizontal x, normale y), puis dans un plan y = a
+	const size_t v1[] = {0, 3, 4, 7};
+	const size_t v2[] = {1, 2, 5, 6};
+	for (size_t p=0; p<end; p+=simd::width) {
+		platform_batch(model, batch, quat, p);
+		for (size_t i=0; i<4; i++) {
+			leg_batch(model, batch, v1[i], 0, 1, p);
+			leg_batch(model, batch, v2[i], 1, 0, p);
+		}
+	}
+}
@@ -0,0 +1,21 @@
+#ifndef _BATCH_H
+#define _BATCH_H
+
+#include "model.h"
+
+/**
+	bloc de poses en structure-of-arrays, pour les balayages hors-ligne de l'espace de travail
+	chaque composante est un tableau contigu de `batch_size` poses, ce qui permet de calculer plusieurs poses par instruction SIMD (voir simd.h)
+*/
+static const size_t batch_size = 64;
+struct DeltaBatch {
+	float X[N][batch_size];		// poses (entrée)
+	float q[N][batch_size];		// angles moteurs
+	float c[N][3][batch_size];	// extremités des leviers
+	float a[N][3][batch_size];	// rotules de la plateforme
+};
+
+/// equivalent a Delta::mgi sur les `n` premieres poses du bloc (n <= batch_size)
+void mgi_batch(const Delta &model, DeltaBatch &batch, size_t n=batch_size);
+
+#endif
@@ -0,0 +1,158 @@
+#include "command.h"
+#include <string.h>
+#include <math.h>
+
+namespace command {
+
+static const float pow10[] = {
+	1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f, 1e11f, 1e12f, 1e13f, 1e14f, 1e15f, 1e16f, 1e17f, 1e18f, 1e19f,
+	1e20f, 1e21f, 1e22f, 1e23f, 1e24f, 1e25f, 1e26f, 1e27f, 1e28f, 1e29f, 1e30f, 1e31f, 1e32f, 1e33f, 1e34f, 1e35f, 1e36f, 1e37f, 1e38f,
+};
+static const int max_pow10 = sizeof(pow10) / sizeof(pow10[0]) - 1;
+
+float scale(uint32_t mantissa, int exponent) {
+	float f = mantissa;
+	if (!mantissa)	return 0;
+	if (exponent > max_pow10)	return HUGE_VALF;
+	if (exponent >= 0)	return f * pow10[exponent];
+	// division par une puissance exacte jusqu'a 1e10, plus precise que la multiplication par un inverse arrondi
+	if (exponent < -max_pow10) {
+		f /= pow10[max_pow10];
+		exponent += max_pow10;
+		if (exponent < -max_pow10)	return 0;
+	}
+	return f / pow10[-exponent];
+}
+
+void Parser::reset() {
+	state = KEYWORD;
+	length = 0;
+	count = 0;
+}
+
+bool Parser::identify() {
+	keyword[length] = 0;
+	if 		(!strcmp(keyword, "force"))		kind = FORCE;
+	else if (!strcmp(keyword, "block"))		kind = BLOCK;
+	else if (!strcmp(keyword, "none"))		kind = NONE;
+	else if (!strcmp(keyword, "probes"))	kind = PROBES;
+	else	return false;
+	return true;
+}
+
+bool Parser::fail() {
+	errors++;
+	state = SKIP;
+	return false;
+}
+
+bool Parser::end_of_line() {
+	bool ok = false;
+	bool with_values = false;
+	switch (state) {
+		case KEYWORD:
+			if (!length)	return false;		// ligne vide
+			ok = identify();
+			with_values = true;		// pas de valeur: seules none et probes sont completes
+			count = 0;
+			break;
+		case SPACE:
+		case VALUE:
+			ok = true;
+			with_values = true;
+			break;
+		case NUMBER:
+			ok = end_number();
+			with_values = true;
+			break;
+		case SKIP:
+			reset();
+			return false;
+	}
+	if (ok && with_values)	ok = (kind == FORCE || kind == BLOCK) ? count == values : count == 0;
+	if (!ok)	errors++;
+	reset();
+	return ok;
+}
+
+void Parser::begin_number() {
+	part = INTEGER;
+	negative = exponent_negative = false;
+	digits = exponent_digits = false;
+	significant = 0;
+	mantissa = 0;
+	shift = 0;
+	exponent = 0;
+	state = NUMBER;
+}
+
+bool Parser::end_number() {
+	if (!digits || (part >= EXPONENT_SIGN && !exponent_digits) || count >= values)	return false;
+	float v = scale(mantissa, shift + (exponent_negative ? -exponent : exponent));
+	value[count++] = negative ? -v : v;
+	return true;
+}
+
+bool Parser::number(uint8_t c) {
+	if (c >= '0' && c <= '9') {
+		uint8_t d = c - '0';
+		if (part >= EXPONENT_SIGN) {
+			part = EXPONENT;
+			exponent_digits = true;
+			if (exponent < 1000)	exponent = exponent*10 + d;
+			return true;
+		}
+		digits = true;
+		if (significant < 9) {
+			mantissa = mantissa*10 + d;
+			significant += mantissa != 0;	// les zeros de tete ne comptent pas
+			shift -= part == FRACTION;
+		}
+		else if (part == INTEGER && shift < 1000)	shift++;	// chiffre au dela de la precision d'un flottant
+		return true;
+	}
+	if (c == '.' && part == INTEGER)	{ part = FRACTION;	return true; }
+	if ((c == 'e' || c == 'E') && part <= FRACTION && digits)	{ part = EXPONENT_SIGN;	return true; }
+	if ((c == '-' || c == '+') && part == EXPONENT_SIGN) {
+		exponent_negative = c == '-';
+		part = EXPONENT;
+		return true;
+	}
+	return false;
+}
+
+bool Parser::push(uint8_t c) {
+	if (c == '\r')	return false;
+	if (c == '\n')	return end_of_line();
+	bool space = c == ' ' || c == '\t';
+	switch (state) {
+		case KEYWORD:
+			if (c >= 'a' && c <= 'z' && length < max_keyword)	{ keyword[length++] = c;	return false; }
+			if (space && !length)	return false;		// espaces en debut de ligne
+			if (!space || !identify())	return fail();
+			state = (kind == FORCE || kind == BLOCK) ? VALUE : SPACE;
+			return false;
+		case SPACE:
+			if (space)	return false;
+			if (c == ',' && (kind == FORCE || kind == BLOCK))	{ state = VALUE;	return false; }
+			return fail();
+		case VALUE:
+			if (space)	return false;
+			if (count == values)	return fail();		// apres la virgule finale, plus rien
+			begin_number();
+			if (c == '-' || c == '+')	{ negative = c == '-';	return false; }
+			return number(c) ? false : fail();
+		case NUMBER:
+			if (space || c == ',') {
+				if (!end_number())	return fail();
+				state = space ? SPACE : VALUE;
+				return false;
+			}
+			return number(c) ? false : fail();
+		case SKIP:
+			return false;
+	}
+	return false;
+}
+
+};
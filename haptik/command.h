@@ -0,0 +1,123 @@
+#ifndef _COMMAND_H
+#define _COMMAND_H
+
+/*
+	commandes texte du port serie (quand le protocole binaire est desactivé)
+
+	une commande par ligne: un mot clé, puis pour force et block 8 valeurs separées par des virgules (virgule finale permise)
+		force 12.5,0,0,0,0,0,0,0
+		block 0,0,1,0,0,0,0,0,
+		none
+		probes
+	les fins de ligne \n et \r\n sont acceptées, les espaces autour des valeurs ignorés.
+
+	Ring est rempli octet par octet depuis la reception (interruption du port, ou a chaque loop() depuis le tampon de Serial),
+	Parser le consomme octet par octet: une commande coupée entre deux appels reprend la ou elle s'etait arretée.
+	le parseur ne garde pas la ligne: les nombres sont accumulés au fil des chiffres, le temps par octet est borné
+	et une ligne trop longue ou invalide est seulement ignorée jusqu'a la fin de ligne.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace command {
+
+/// file d'octets d'un seul producteur (interruption de reception) vers un seul consommateur (la boucle)
+template <size_t capacity>
+class Ring {
+	static_assert(capacity && !(capacity & (capacity-1)) && capacity <= 32768, "la capacité doit etre une puissance de 2");
+public:
+	Ring() : dropped(0), head(0), tail(0) {}
+
+	/// producteur: faux si la file est pleine, l'octet est alors perdu
+	bool push(uint8_t byte) {
+		uint16_t h = head;
+		if (uint16_t(h - tail) == capacity) {
+			dropped++;
+			return false;
+		}
+		items[h & (capacity-1)] = byte;
+		__asm__ __volatile__("" ::: "memory");	// l'octet est ecrit avant d'etre publié
+		head = h + 1;
+		return true;
+	}
+	/// consommateur: faux si la file est vide
+	bool pop(uint8_t &byte) {
+		uint16_t t = tail;
+		if (head == t)	return false;
+		byte = items[t & (capacity-1)];
+		__asm__ __volatile__("" ::: "memory");
+		tail = t + 1;
+		return true;
+	}
+	size_t size() const		{ return uint16_t(head - tail); }
+	size_t room() const		{ return capacity - size(); }
+
+	volatile unsigned long dropped;		// octets perdus, file pleine
+
+private:
+	uint8_t items[capacity];
+	volatile uint16_t head;		// ecrit par le producteur seul
+	volatile uint16_t tail;		// ecrit par le consommateur seul
+};
+
+enum Kind : uint8_t {
+	NONE,
+	FORCE,
+	BLOCK,
+	PROBES,
+};
+
+static const size_t values = 8;		// valeurs de force et block
+static const size_t max_keyword = 7;
+
+/// mantisse * 10^exponent en flottant, a 2 ulp pres pour une mantisse d'au plus 9 chiffres
+float scale(uint32_t mantissa, int exponent);
+
+class Parser {
+public:
+	Parser() : errors(0)	{ reset(); }
+
+	/// consomme un octet, retourne vrai s'il termine une commande valide, alors decrite par kind et value
+	/// (value n'est valable que jusqu'au prochain appel)
+	bool push(uint8_t c);
+
+	Kind kind;
+	float value[values];
+	unsigned long errors;		// lignes non vides rejetées
+
+private:
+	enum State : uint8_t {
+		KEYWORD,	// lettres du mot clé
+		SPACE,		// apres le mot clé ou une valeur: espaces, virgule ou fin de ligne
+		VALUE,		// avant une valeur: espaces, signe ou premier chiffre
+		NUMBER,		// dans une valeur
+		SKIP,		// ligne invalide, jusqu'a la fin de ligne
+	};
+	enum Part : uint8_t { INTEGER, FRACTION, EXPONENT_SIGN, EXPONENT };
+
+	State state;
+	char keyword[max_keyword+1];
+	uint8_t length;			// lettres du mot clé
+	uint8_t count;			// valeurs lues
+
+	// nombre en cours
+	Part part;
+	bool negative, exponent_negative;
+	bool digits, exponent_digits;	// au moins un chiffre dans la mantisse, dans l'exposant
+	uint8_t significant;	// chiffres gardés dans la mantisse
+	uint32_t mantissa;
+	int16_t shift;			// puissance de 10 de la mantisse
+	int16_t exponent;		// exposant écrit
+
+	void reset();
+	bool identify();
+	bool fail();
+	bool end_of_line();
+	void begin_number();
+	bool end_number();
+	bool number(uint8_t c);
+};
+
+};
+#endif
@@ -0,0 +1,47 @@
+#ifndef _CONSTMATH_H
+#define _CONSTMATH_H
+
+/*
+	fonctions mathematiques evaluables a la compilation (constexpr), pour les constantes de geometrie
+	calculées en double par series: lentes, a ne pas utiliser a l'execution.
+*/
+
+namespace cm {
+
+constexpr double pi = 3.14159265358979323846;
+
+/// angle ramené dans [-pi, pi]
+constexpr double reduce(double x) {
+	while (x > pi)		x -= 2*pi;
+	while (x < -pi)		x += 2*pi;
+	return x;
+}
+
+/// serie de Taylor jusqu'a ce que les termes ne changent plus la somme
+constexpr double sin(double x) {
+	x = reduce(x);
+	double term = x, sum = x;
+	for (int n=1; sum + term != sum; n++) {
+		term *= -x*x / ((2*n) * (2*n+1));
+		sum += term;
+	}
+	return sum;
+}
+constexpr double cos(double x)	{ return sin(x + pi/2); }
+
+/// Newton, pour x >= 0
+constexpr double sqrt(double x) {
+	if (x <= 0)		return 0;
+	double r = x > 1 ? x : 1;
+	for (int i=0; i<100; i++) {
+		double next = (r + x/r) / 2;
+		if (next >= r)	break;
+		r = next;
+	}
+	return r;
+}
+
+constexpr double deg2rad(double angle)	{ return angle * pi/180; }
+
+};
+#endif
@@ -0,0 +1,114 @@
+#ifndef _DUAL_H
+#define _DUAL_H
+
+/*
+	nombre dual pour la differentiation automatique en mode direct, utilisable comme S dans les templates la:: et dans BasicDelta
+	chaque valeur porte ses derivées par rapport a n variables d'entrée, propagées par les operations et fonctions usuelles.
+	les fonctions mathematiques sont des amies cachées, trouvées par ADL comme pour la::Fixed.
+*/
+
+#include <stddef.h>
+#include <math.h>
+
+namespace la {
+
+template <class S, size_t n>
+struct Dual {
+	S v;		// valeur
+	S d[n];		// derivées partielles
+
+	// constructeurs
+	Dual() {}
+	Dual(const S value) : v(value) {
+		for (size_t i=0; i<n; i++)	d[i] = 0;
+	}
+	/// variable d'entrée numero i
+	static Dual variable(const S value, const size_t i) {
+		Dual x(value);
+		x.d[i] = 1;
+		return x;
+	}
+	explicit operator S() const		{ return v; }
+
+	/// resultat d'une fonction f de derivée df en v
+	Dual chain(const S fv, const S df) const {
+		Dual r;
+		r.v = fv;
+		for (size_t i=0; i<n; i++)	r.d[i] = df * d[i];
+		return r;
+	}
+
+
+	/***** operateurs ******/
+
+	friend Dual operator+(const Dual &a, const Dual &b) {
+		Dual r;
+		r.v = a.v + b.v;
+		for (size_t i=0; i<n; i++)	r.d[i] = a.d[i] + b.d[i];
+		return r;
+	}
+	friend Dual operator-(const Dual &a, const Dual &b) {
+		Dual r;
+		r.v = a.v - b.v;
+		for (size_t i=0; i<n; i++)	r.d[i] = a.d[i] - b.d[i];
+		return r;
+	}
+	friend Dual operator-(const Dual &a)	{ return a.chain(-a.v, -1); }
+	friend Dual operator*(const Dual &a, const Dual &b) {
+		Dual r;
+		r.v = a.v * b.v;
+		for (size_t i=0; i<n; i++)	r.d[i] = a.d[i] * b.v + a.v * b.d[i];
+		return r;
+	}
+	friend Dual operator/(const Dual &a, const Dual &b) {
+		Dual r;
+		r.v = a.v / b.v;
+		for (size_t i=0; i<n; i++)	r.d[i] = (a.d[i] - r.v * b.d[i]) / b.v;
+		return r;
+	}
+
+	// operations avec une constante: pas de derivées nulles a propager
+	friend Dual operator+(const Dual &a, const S b)	{ Dual r = a;	r.v = a.v + b;	return r; }
+	friend Dual operator+(const S a, const Dual &b)	{ Dual r = b;	r.v = a + b.v;	return r; }
+	friend Dual operator-(const Dual &a, const S b)	{ Dual r = a;	r.v = a.v - b;	return r; }
+	friend Dual operator-(const S a, const Dual &b)	{ return b.chain(a - b.v, -1); }
+	friend Dual operator*(const Dual &a, const S b)	{ return a.chain(a.v * b, b); }
+	friend Dual operator*(const S a, const Dual &b)	{ return b.chain(a * b.v, a); }
+	friend Dual operator/(const Dual &a, const S b)	{ return a.chain(a.v / b, S(1) / b); }
+	friend Dual operator/(const S a, const Dual &b)	{ S r = a / b.v;	return b.chain(r, -r / b.v); }
+
+	Dual & operator+=(const Dual &b)	{ return *this = *this + b; }
+	Dual & operator-=(const Dual &b)	{ return *this = *this - b; }
+	Dual & operator*=(const Dual &b)	{ return *this = *this * b; }
+	Dual & operator/=(const Dual &b)	{ return *this = *this / b; }
+
+	// les comparaisons ne portent que sur la valeur
+	friend bool operator==(const Dual &a, const Dual &b)	{ return a.v == b.v; }
+	friend bool operator!=(const Dual &a, const Dual &b)	{ return a.v != b.v; }
+	friend bool operator< (const Dual &a, const Dual &b)	{ return a.v <  b.v; }
+	friend bool operator> (const Dual &a, const Dual &b)	{ return a.v >  b.v; }
+	friend bool operator<=(const Dual &a, const Dual &b)	{ return a.v <= b.v; }
+	friend bool operator>=(const Dual &a, const Dual &b)	{ return a.v >= b.v; }
+
+
+	/***** fonctions mathematiques ******/
+
+	friend Dual fabs(const Dual &a)		{ return a.v < 0 ? -a : a; }
+	friend Dual sqrt(const Dual &a) {
+		S r = sqrt(a.v);
+		return a.chain(r, S(0.5) / r);
+	}
+	friend Dual sin(const Dual &a)		{ return a.chain(sin(a.v), cos(a.v)); }
+	friend Dual cos(const Dual &a)		{ return a.chain(cos(a.v), -sin(a.v)); }
+	friend Dual atan(const Dual &a)		{ return a.chain(atan(a.v), S(1) / (1 + a.v*a.v)); }
+	friend Dual atan2(const Dual &y, const Dual &x) {
+		Dual r;
+		S den = x.v*x.v + y.v*y.v;
+		r.v = atan2(y.v, x.v);
+		for (size_t i=0; i<n; i++)	r.d[i] = (x.v * y.d[i] - y.v * x.d[i]) / den;
+		return r;
+	}
+};
+
+};
+#endif
@@ -0,0 +1,267 @@
+#include "dxlbus.h"
+#include <string.h>
+
+namespace dxlbus {
+
+static const uint8_t header[] = {0xFF, 0xFF, 0xFD, 0x00};
+static const size_t header_size = 7;	// entete, id, longueur
+
+uint16_t crc16(const uint8_t *data, size_t size, uint16_t crc) {
+	for (size_t i=0; i<size; i++) {
+		crc ^= uint16_t(data[i]) << 8;
+		for (int k=0; k<8; k++)
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x8005 : crc << 1;
+	}
+	return crc;
+}
+
+/// vrai si les trois octets avant end forment FF FF FD: l'octet suivant est un bourrage
+static bool stuffing(const uint8_t *start, const uint8_t *end) {
+	return end - start >= 3 && end[-3] == 0xFF && end[-2] == 0xFF && end[-1] == 0xFD;
+}
+
+size_t packet(uint8_t *out, uint8_t id, uint8_t instruction, const uint8_t *params, size_t size) {
+	memcpy(out, header, sizeof(header));
+	out[4] = id;
+	uint8_t *body = out + header_size;
+	uint8_t *p = body;
+	for (size_t i=0; i<=size; i++) {
+		if (p - out + 4 > ptrdiff_t(max_packet))	return 0;	// place pour l'octet, un bourrage et le crc
+		*p++ = i ? params[i-1] : instruction;
+		if (stuffing(body, p))	*p++ = 0xFD;
+	}
+	uint16_t length = p - body + 2;
+	out[5] = length;
+	out[6] = length >> 8;
+	uint16_t crc = crc16(out, p - out);
+	*p++ = crc;
+	*p++ = crc >> 8;
+	return p - out;
+}
+
+bool Parser::push(uint8_t byte) {
+	if (state < sizeof(header)) {
+		if (byte == header[state])		state++;
+		else if (state == 2 && byte == 0xFF)	{}		// FF FF FF: les deux derniers peuvent commencer l'entete
+		else	state = byte == 0xFF;
+		if (state == sizeof(header))	raw_size = 0;
+		return false;
+	}
+	raw[sizeof(header) + raw_size++] = byte;
+	if (raw_size < 3)	return false;
+	if (raw_size == 3) {
+		length = raw[5] | uint16_t(raw[6]) << 8;
+		if (length < 3 || header_size + length > max_packet) {
+			errors++;
+			reset();
+		}
+		return false;
+	}
+	size_t total = sizeof(header) + raw_size;
+	if (total < header_size + length)	return false;
+	memcpy(raw, header, sizeof(header));
+	reset();
+	uint16_t crc = raw[total-2] | uint16_t(raw[total-1]) << 8;
+	if (crc16(raw, total-2) != crc) {
+		errors++;
+		return false;
+	}
+	// instruction et parametres, sans le bourrage
+	const uint8_t *body = raw + header_size;
+	size = 0;
+	for (const uint8_t *p = body; p < raw + total-2; p++) {
+		if (*p == 0xFD && stuffing(body, p))	continue;
+		if (p == body)	instruction = *p;
+		else if (size < max_params)		params[size++] = *p;
+		else {
+			errors++;
+			return false;
+		}
+	}
+	id = raw[4];
+	return true;
+}
+
+
+Engine::Engine(Transport &transport, Clock clock, uint32_t timeout, Idle idle)
+	: transport(transport), clock(clock), idle(idle), timeout(timeout), first(0), queued(0) {
+	memset(&counters, 0, sizeof(counters));
+	for (uint8_t i=0; i<slots; i++)		transactions[i].state = FREE;
+}
+
+Engine::Handle Engine::submit(uint8_t id, uint8_t instruction, const uint8_t *params, size_t size, const uint8_t *ids, uint8_t count, uint16_t address, uint16_t length, bool keep) {
+	Handle h = 0;
+	while (h < slots && transactions[h].state != FREE)	h++;
+	if (h == slots || count > max_ids || length > max_data) {
+		counters.rejected++;
+		return -1;
+	}
+	Transaction &t = transactions[h];
+	t.size = packet(t.packet, id, instruction, params, size);
+	if (!t.size) {
+		counters.rejected++;
+		return -1;
+	}
+	t.state = QUEUED;
+	t.keep = keep;
+	t.address = address;
+	t.length = length;
+	for (uint8_t i=0; i<count; i++)		t.ids[i] = ids[i];
+	t.count = count;
+	t.received = 0;
+	order[(first + queued++) % slots] = h;
+	counters.submitted++;
+	poll();
+	return h;
+}
+
+Engine::Handle Engine::read(uint8_t id, uint16_t address, uint16_t length) {
+	const uint8_t params[] = {uint8_t(address), uint8_t(address >> 8), uint8_t(length), uint8_t(length >> 8)};
+	return submit(id, READ, params, sizeof(params), &id, 1, address, length, true);
+}
+
+Engine::Handle Engine::write(uint8_t id, uint16_t address, uint16_t length, const void *data) {
+	uint8_t params[max_params];
+	if (size_t(2) + length > max_params) {
+		counters.rejected++;
+		return -1;
+	}
+	params[0] = address;
+	params[1] = address >> 8;
+	memcpy(params+2, data, length);
+	return submit(id, WRITE, params, 2 + length, &id, id != BROADCAST, 0, 0, true);
+}
+
+Engine::Handle Engine::sync_read(uint16_t address, uint16_t length, const uint8_t *ids, uint8_t count) {
+	uint8_t params[4 + max_ids];
+	if (count > max_ids) {
+		counters.rejected++;
+		return -1;
+	}
+	memcpy(params+4, ids, count);
+	params[0] = address;
+	params[1] = address >> 8;
+	params[2] = length;
+	params[3] = length >> 8;
+	return submit(BROADCAST, SYNC_READ, params, 4 + count, ids, count, address, length, true);
+}
+
+bool Engine::sync_write(uint16_t address, uint16_t length, const uint8_t *ids, uint8_t count, const int32_t *data) {
+	uint8_t params[max_params];
+	size_t size = 4 + count * (1 + length);
+	if (length > 4 || size > max_params) {
+		counters.rejected++;
+		return false;
+	}
+	params[0] = address;
+	params[1] = address >> 8;
+	params[2] = length;
+	params[3] = length >> 8;
+	for (uint8_t i=0; i<count; i++) {
+		uint8_t *p = params + 4 + i * (1 + length);
+		p[0] = ids[i];
+		uint32_t value = data[i];
+		memcpy(p+1, &value, length);
+	}
+	return submit(BROADCAST, SYNC_WRITE, params, size, nullptr, 0, 0, 0, false) >= 0;
+}
+
+void Engine::finish(Transaction &t, State state) {
+	t.state = state;
+	t.finished = clock();
+	counters.completed += state == DONE;
+	first = (first + 1) % slots;
+	queued--;
+	if (!t.keep)	t.state = FREE;
+}
+
+bool Engine::step(Transaction &t) {
+	switch (t.state) {
+		case QUEUED:
+			t.state = SENDING;
+			t.sent = 0;
+			// fall through
+		case SENDING:
+			t.sent += transport.write(t.packet + t.sent, t.size - t.sent);
+			if (t.sent < t.size)	return false;
+			if (!t.count) {
+				finish(t, DONE);
+				return true;
+			}
+			t.state = RECEIVING;
+			t.deadline = clock() + timeout;
+			input.reset();
+			// fall through
+		case RECEIVING:
+			for (int byte; (byte = transport.read()) >= 0; ) {
+				if (!input.push(byte) || input.instruction != STATUS || !input.size)	continue;
+				for (uint8_t i=0; i<t.count; i++) {
+					if (t.ids[i] != input.id || (t.received & (1 << i)))	continue;
+					if (input.size - 1 < t.length)	break;	// retour trop court pour la lecture demandée
+					t.errors[i] = input.params[0];
+					memcpy(t.data[i], input.params + 1, t.length);
+					t.received |= 1 << i;
+					t.deadline = clock() + timeout;
+					break;
+				}
+				if (t.received == (1 << t.count) - 1) {
+					finish(t, DONE);
+					return true;
+				}
+			}
+			if (int32_t(clock() - t.deadline) > 0) {
+				counters.timeouts++;
+				finish(t, FAILED);
+				return true;
+			}
+			return false;
+		default:
+			return true;
+	}
+}
+
+void Engine::poll() {
+	while (queued)
+		if (!step(transactions[order[first]]))	return;
+	// bus libre: retours en retard d'une transaction abandonnée, ou parasites
+	while (transport.read() >= 0)	counters.stray++;
+}
+
+bool Engine::wait(Handle h) {
+	if (state(h) == FREE)	return false;
+	while (pending(h)) {
+		poll();
+		if (idle && pending(h))		idle();
+	}
+	return state(h) == DONE;
+}
+
+uint8_t Engine::error(Handle h, uint8_t id) const {
+	if (!valid(h))	return 0;
+	const Transaction &t = transactions[h];
+	for (uint8_t i=0; i<t.count; i++)
+		if (t.ids[i] == id && (t.received & (1 << i)))	return t.errors[i];
+	return 0;
+}
+
+bool Engine::get(Handle h, uint8_t id, uint16_t address, uint16_t length, uint32_t *value) const {
+	if (!valid(h))	return false;
+	const Transaction &t = transactions[h];
+	if (t.state == FREE || address < t.address || address + length > t.address + t.length || length > 4)	return false;
+	for (uint8_t i=0; i<t.count; i++) {
+		if (t.ids[i] != id || !(t.received & (1 << i)))		continue;
+		*value = 0;
+		memcpy(value, &t.data[i][address - t.address], length);
+		return true;
+	}
+	return false;
+}
+
+void Engine::release(Handle h) {
+	if (!valid(h))	return;
+	Transaction &t = transactions[h];
+	if (t.state == DONE || t.state == FAILED)	t.state = FREE;
+	else	t.keep = false;
+}
+
+};
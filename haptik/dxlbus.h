@@ -0,0 +1,183 @@
+#ifndef _DXLBUS_H
+#define _DXLBUS_H
+
+/*
+	echanges non bloquants avec les moteurs Dynamixel (protocole 2.0), sans la bibliotheque DynamixelWorkbench
+
+	une transaction est un paquet d'instruction et les paquets de retour qu'il attend. on la soumet, elle part sur le bus
+	des que les precedentes sont terminées, et poll() la fait avancer: il donne au port les octets qu'il peut accepter
+	et analyse ceux qui sont arrivés, sans jamais attendre. le calcul continue pendant que les octets passent sur le bus.
+
+	le port est un Transport: sur la carte un port serie dont l'emission et la reception passent par des interruptions
+	ou un DMA, sur l'hote un bus simulé (tests/sim/FakeTransport.h).
+	le bus est half-duplex: une instruction ne part qu'une fois recus les retours de la precedente, ou son delai depassé.
+	le basculement de direction de la ligne est a la charge du transport. StreamTransport ne le fait pas: il ne convient qu'aux
+	ports dont le materiel bascule seul (adaptateur USB). le port DXL de l'OpenCR n'a pas encore de transport: le croquis
+	n'attache pas de moteur de transactions sur la carte.
+
+	paquet: FF FF FD 00 id longueur(2) instruction parametres crc(2), la longueur compte l'instruction, les parametres et le crc.
+	dans l'instruction et les parametres, chaque suite FF FF FD est suivie d'un octet FD de bourrage.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace dxlbus {
+
+enum Instruction : uint8_t {
+	READ = 0x02,
+	WRITE = 0x03,
+	STATUS = 0x55,		// paquet de retour d'un moteur, le premier parametre est son octet d'erreur
+	SYNC_READ = 0x82,
+	SYNC_WRITE = 0x83,
+};
+
+static const uint8_t BROADCAST = 0xFE;
+static const size_t max_params = 64;		// parametres d'un paquet, sans le bourrage
+static const size_t max_packet = 96;		// paquet complet, avec le bourrage
+
+/// CRC-16 du protocole 2.0 (polynome 0x8005, sans reflexion)
+uint16_t crc16(const uint8_t *data, size_t size, uint16_t crc = 0);
+
+/// ecrit un paquet complet dans out, retourne sa taille ou 0 s'il depasse max_packet
+size_t packet(uint8_t *out, uint8_t id, uint8_t instruction, const uint8_t *params, size_t size);
+
+/// decoupe un flux d'octets en paquets, en se resynchronisant sur l'entete apres une erreur
+class Parser {
+public:
+	Parser() : errors(0)	{ reset(); }
+	/// ajoute un octet, retourne vrai quand il termine un paquet valide, alors decrit par id, instruction, params et size
+	bool push(uint8_t byte);
+	void reset()	{ state = 0;	raw_size = 0; }
+
+	uint8_t id;
+	uint8_t instruction;
+	uint8_t params[max_params];	// sans le bourrage
+	size_t size;
+	unsigned long errors;		// paquets rejetés: crc faux ou trop longs
+
+private:
+	uint8_t state;				// octets de l'entete deja reconnus
+	uint16_t length;
+	uint8_t raw[max_packet];
+	size_t raw_size;
+};
+
+/// port du bus: les deux methodes rendent la main immediatement
+class Transport {
+public:
+	/// accepte au plus size octets a emettre, retourne le nombre accepté
+	virtual size_t write(const uint8_t *data, size_t size) = 0;
+	/// prochain octet recu, -1 s'il n'y en a pas
+	virtual int read() = 0;
+};
+
+/// transport sur un port serie Arduino dont les tampons sont remplis et vidés par interruption (HardwareSerial),
+/// pour une ligne dont la direction bascule d'elle meme
+template <class Port>
+class StreamTransport : public Transport {
+public:
+	StreamTransport(Port &port) : port(port) {}
+	size_t write(const uint8_t *data, size_t size) override {
+		size_t room = port.availableForWrite();
+		return port.write(data, size < room ? size : room);
+	}
+	int read() override		{ return port.available() ? port.read() : -1; }
+private:
+	Port &port;
+};
+
+class Engine {
+public:
+	typedef unsigned long (*Clock)();
+	typedef void (*Idle)();
+	typedef int8_t Handle;		// -1: transaction refusée
+
+	enum State : uint8_t {
+		FREE,
+		QUEUED,		// attend que les precedentes soient terminées
+		SENDING,	// instruction en cours d'emission
+		RECEIVING,	// attend les retours
+		DONE,
+		FAILED,		// delai depassé, ou retour invalide
+	};
+
+	static const uint8_t slots = 4;			// transactions soumises et pas encore libérées
+	static const uint8_t max_ids = 8;		// moteurs d'une operation groupée
+	static const uint8_t max_data = 10;		// octets lus par moteur
+
+	/// timeout: attente maximale de chaque retour (µs), depuis que le transport a accepté le dernier octet de l'instruction
+	/// ou depuis le retour precedent
+	/// idle: appelée par wait() tant que la transaction n'est pas terminée (sur l'hote, fait avancer le temps simulé)
+	Engine(Transport &transport, Clock clock, uint32_t timeout = 3000, Idle idle = nullptr);
+
+	// soumission: la transaction part aussitot si le bus est libre. -1 si aucun emplacement n'est libre ou si le paquet est trop long
+
+	Handle read(uint8_t id, uint16_t address, uint16_t length);
+	Handle write(uint8_t id, uint16_t address, uint16_t length, const void *data);
+	/// un retour par moteur, dans l'ordre de ids
+	Handle sync_read(uint16_t address, uint16_t length, const uint8_t *ids, uint8_t count);
+	/// sans retour des moteurs: terminée des que l'instruction est partie, et libérée d'elle meme. une valeur par moteur, comme syncWrite
+	bool sync_write(uint16_t address, uint16_t length, const uint8_t *ids, uint8_t count, const int32_t *data);
+
+	/// fait avancer les transactions: emission, analyse des octets recus, delais. ne bloque jamais
+	void poll();
+	/// appelle poll() jusqu'a la fin de la transaction, retourne vrai si elle a reussi
+	bool wait(Handle h);
+
+	State state(Handle h) const		{ return valid(h) ? transactions[h].state : FREE; }
+	bool pending(Handle h) const	{ return state(h) == QUEUED || state(h) == SENDING || state(h) == RECEIVING; }
+	/// instant de la fin de la transaction (µs): dernier retour recu
+	uint32_t finished(Handle h) const	{ return valid(h) ? transactions[h].finished : 0; }
+	/// octet d'erreur du retour d'un moteur
+	uint8_t error(Handle h, uint8_t id) const;
+	/// valeur lue d'un moteur (little-endian, non signée, 4 octets au plus), faux si elle n'a pas été recue
+	bool get(Handle h, uint8_t id, uint16_t address, uint16_t length, uint32_t *value) const;
+	/// libere l'emplacement d'une transaction terminée; une transaction pas encore terminée l'est a sa fin
+	void release(Handle h);
+
+	struct Counters {
+		unsigned long submitted;
+		unsigned long completed;
+		unsigned long timeouts;
+		unsigned long rejected;		// pas d'emplacement libre
+		unsigned long stray;		// octets recus hors de toute transaction
+	} counters;
+
+	const Parser & parser() const	{ return input; }
+
+private:
+	struct Transaction {
+		State state;
+		bool keep;				// faux: libérée des qu'elle est terminée
+		uint8_t packet[max_packet];
+		uint8_t size;
+		uint8_t sent;
+		uint16_t address, length;	// registres lus
+		uint8_t ids[max_ids];		// moteurs qui doivent repondre
+		uint8_t count;
+		uint8_t received;			// masque des retours recus
+		uint8_t errors[max_ids];
+		uint8_t data[max_ids][max_data];
+		uint32_t deadline;
+		uint32_t finished;
+	};
+
+	Transport &transport;
+	Clock clock;
+	Idle idle;
+	uint32_t timeout;
+	Parser input;
+	Transaction transactions[slots];
+	Handle order[slots];		// transactions soumises pas encore terminées, dans l'ordre de soumission
+	uint8_t first, queued;
+
+	bool valid(Handle h) const	{ return h >= 0 && h < slots; }
+	Handle submit(uint8_t id, uint8_t instruction, const uint8_t *params, size_t size, const uint8_t *ids, uint8_t count, uint16_t address, uint16_t length, bool keep);
+	void finish(Transaction &t, State state);
+	/// avance la plus ancienne transaction, retourne vrai si elle est terminée et que la suivante peut partir
+	bool step(Transaction &t);
+};
+
+};
+#endif
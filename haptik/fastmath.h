@@ -0,0 +1,139 @@
+#ifndef _FASTMATH_H
+#define _FASTMATH_H
+
+/*
+	fonctions mathematiques rapides en simple precision, a erreur bornée
+	approximations polynomiales minimax (Remez) apres reduction d'argument, sans table ni appel a la libm.
+
+	chaque site d'appel choisit: `fm::sin(x)` pour la version rapide, `sin(x)` pour la libm.
+	la cinematique passe par les fonctions de `kin::`, qui suivent HAPTIK_FASTMATH: fm:: sur la carte, libm sur l'hote par defaut.
+	les types non float (la::Fixed, la::Dual) gardent dans tous les cas leurs propres fonctions, trouvées par ADL.
+
+	erreurs maximales mesurées par tests/test_fastmath.cpp contre la libm en double, arrondi float compris (le test echoue au dela de 10% de plus):
+		sin, cos	|x| <= 100	1.2e-7 en absolu
+		atan					1.9e-7 rad
+		atan2					2.9e-7 rad (atan2f: 2.8e-7)
+		rsqrt					1.5e-7 en relatif
+		sqrt					1.8e-7 en relatif, NaN pour x < 0 comme la libm
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#ifndef HAPTIK_FASTMATH
+	#ifdef ARDUINO
+		#define HAPTIK_FASTMATH 1
+	#else
+		#define HAPTIK_FASTMATH 0
+	#endif
+#endif
+
+namespace fm {
+
+static const float half_pi = 1.57079632679f;
+static const float two_over_pi = 0.636619772368f;
+// pi/2 en deux morceaux (Cody-Waite): k*half_pi_hi est exact pour |k| < 2^11
+static const float half_pi_hi = 1.5703125f;
+static const float half_pi_lo = 4.83826794897e-4f;
+
+/// x = k*pi/2 + r, |r| <= pi/4, retourne k modulo 4
+inline int reduce(const float x, float &r) {
+	int k = int(x * two_over_pi + copysignf(0.5f, x));		// arrondi par conversion entiere: nearbyintf est un appel de fonction sur Cortex-M4
+	r = (x - k*half_pi_hi) - k*half_pi_lo;
+	return k & 3;
+}
+/// sin(r) pour |r| <= pi/4, erreur relative du polynome 3.2e-9
+inline float sin_poly(const float r) {
+	float s = r*r;
+	return r * (0.9999999968f + s*(-0.1666665022f + s*(8.332016454e-3f + s*-1.950182216e-4f)));
+}
+/// cos(r) pour |r| <= pi/4, erreur relative du polynome 3.3e-8
+inline float cos_poly(const float r) {
+	float s = r*r;
+	return 0.9999999674f + s*(-0.4999984243f + s*(4.165441957e-2f + s*-1.357940422e-3f));
+}
+
+inline float sin(const float x) {
+	float r;
+	switch (reduce(x, r)) {
+		case 0:		return sin_poly(r);
+		case 1:		return cos_poly(r);
+		case 2:		return -sin_poly(r);
+		default:	return -cos_poly(r);
+	}
+}
+inline float cos(const float x) {
+	float r;
+	switch (reduce(x, r)) {
+		case 0:		return cos_poly(r);
+		case 1:		return -sin_poly(r);
+		case 2:		return -cos_poly(r);
+		default:	return sin_poly(r);
+	}
+}
+
+/// atan(t) pour 0 <= t <= 1, erreur relative du polynome 9.9e-8
+inline float atan_poly(const float t) {
+	float s = t*t;
+	return t * (0.9999999010f + s*(-0.3333199075f + s*(0.1996972390f + s*(-0.1401948092f
+		+ s*(9.914292857e-2f + s*(-5.948639346e-2f + s*(2.425240328e-2f + s*-4.693276058e-3f)))))));
+}
+
+inline float atan(const float x) {
+	float t = fabsf(x);
+	float r = (t > 1) ? half_pi - atan_poly(1/t) : atan_poly(t);
+	return (x < 0) ? -r : r;
+}
+/// meme convention que la libm: resultat dans [-pi, pi], du signe de y
+inline float atan2(const float y, const float x) {
+	float ax = fabsf(x), ay = fabsf(y);
+	float hi = (ax > ay) ? ax : ay;
+	float lo = (ax > ay) ? ay : ax;
+	float r = (hi == 0) ? 0 : atan_poly(lo / hi);
+	if (ay > ax)	r = half_pi - r;
+	if (signbit(x))	r = 2*half_pi - r;
+	return signbit(y) ? -r : r;
+}
+
+/// 1/sqrt(x): approximation initiale sur la representation IEEE, puis trois iterations de Newton
+inline float rsqrt(const float x) {
+	uint32_t i;
+	memcpy(&i, &x, sizeof(i));
+	i = 0x5f375a86 - (i >> 1);
+	float y;
+	memcpy(&y, &i, sizeof(y));
+	float h = 0.5f * x;
+	y = y * (1.5f - h*y*y);
+	y = y * (1.5f - h*y*y);
+	y = y * (1.5f - h*y*y);
+	return y;
+}
+inline float sqrt(const float x) {
+	if (!(x > 0))	return (x == 0) ? 0 : NAN;		// NaN propage aussi
+	return x * rsqrt(x);
+}
+
+};
+
+/*
+	fonctions utilisées par la cinematique (mgi, vec2quat): libm ou fm:: pour les float selon HAPTIK_FASTMATH,
+	fonctions propres du type (ADL) pour les autres scalaires.
+*/
+namespace kin {
+
+template <class T> inline T sqrt(const T &x)					{ using ::sqrt;		return sqrt(x); }
+template <class T> inline T sin(const T &x)						{ using ::sin;		return sin(x); }
+template <class T> inline T cos(const T &x)						{ using ::cos;		return cos(x); }
+template <class T> inline T atan2(const T &y, const T &x)		{ using ::atan2;	return atan2(y, x); }
+
+// sqrt reste celle de la libm: une instruction (vsqrt.f32, sqrtss) des qu'il y a une FPU, plus rapide que fm::sqrt
+#if HAPTIK_FASTMATH
+inline float sin(const float x)						{ return fm::sin(x); }
+inline float cos(const float x)						{ return fm::cos(x); }
+inline float atan2(const float y, const float x)	{ return fm::atan2(y, x); }
+#endif
+
+};
+
+#endif
@@ -0,0 +1,170 @@
+#ifndef _FIXED_H
+#define _FIXED_H
+
+/*
+	scalaire en virgule fixe (format Q), utilisable comme S dans les templates la:: et dans BasicDelta
+	pour les cartes sans FPU (ou avec une FPU simple precision seulement).
+
+	la valeur est stockée sur 32 bits signés avec `frac` bits apres la virgule, les produits passent par 64 bits.
+	toutes les operations saturent au lieu de deborder, une division par zero sature du signe du numerateur.
+	sqrt, atan, atan2, sin et cos sont calculés sans flottants (racine entiere et CORDIC).
+
+	les fonctions mathematiques sont des amies cachées: elles ne sont trouvées que par ADL, ce qui laisse `sqrt(float)` etc. intacts dans le reste du code.
+*/
+
+#include <stdint.h>
+
+namespace la {
+
+/// table CORDIC: atan(2^-i) en Q29
+static const int32_t cordic_atan[] = {
+	421657428, 248918915, 131521918, 66762579, 33510843, 16771758, 8387925, 4194219,
+	2097141, 1048575, 524288, 262144, 131072, 65536, 32768, 16384,
+	8192, 4096, 2048, 1024, 512, 256, 128, 64,
+	32, 16, 8, 4};
+static const int cordic_iterations = sizeof(cordic_atan)/sizeof(int32_t);
+static const int64_t cordic_gain = 326016437;		// produit des cos(atan(2^-i)), Q29
+static const int64_t cordic_pi = 1686629713;		// pi en Q29
+
+
+template<int frac>
+struct Fixed {
+	int32_t raw;
+
+	static const int64_t one = int64_t(1) << frac;
+
+	static int32_t saturate(const int64_t v) {
+		if (v > INT32_MAX)	return INT32_MAX;
+		if (v < INT32_MIN)	return INT32_MIN;
+		return v;
+	}
+	static Fixed from_raw(const int32_t r)	{ Fixed x; x.raw = r; return x; }
+
+	// constructeurs
+	Fixed() {}
+	Fixed(const int v)				: raw(saturate(int64_t(v) * one)) {}
+	Fixed(const unsigned v)			: raw(saturate(int64_t(v) * one)) {}
+	Fixed(const long v)				: raw(saturate(int64_t(v) * one)) {}
+	Fixed(const unsigned long v)	: raw(saturate(int64_t(v) * one)) {}
+	Fixed(const float v)			: raw(from_double(v)) {}
+	Fixed(const double v)			: raw(from_double(v)) {}
+
+	static int32_t from_double(double v) {
+		v *= one;
+		if (v >= INT32_MAX)	return INT32_MAX;
+		if (v <= INT32_MIN)	return INT32_MIN;
+		return v < 0 ? int32_t(v - 0.5) : int32_t(v + 0.5);
+	}
+	explicit operator float() const		{ return float(raw) / one; }
+	explicit operator double() const	{ return double(raw) / one; }
+
+
+	/***** operateurs ******/
+
+	friend Fixed operator+(const Fixed a, const Fixed b)	{ return from_raw(saturate(int64_t(a.raw) + b.raw)); }
+	friend Fixed operator-(const Fixed a, const Fixed b)	{ return from_raw(saturate(int64_t(a.raw) - b.raw)); }
+	friend Fixed operator-(const Fixed a)					{ return from_raw(saturate(-int64_t(a.raw))); }
+	friend Fixed operator*(const Fixed a, const Fixed b) {
+		return from_raw(saturate((int64_t(a.raw) * b.raw + (one>>1)) >> frac));
+	}
+	friend Fixed operator/(const Fixed a, const Fixed b) {
+		if (b.raw == 0)		return from_raw(a.raw < 0 ? INT32_MIN : INT32_MAX);
+		return from_raw(saturate((int64_t(a.raw) << frac) / b.raw));
+	}
+
+	Fixed & operator+=(const Fixed b)	{ return *this = *this + b; }
+	Fixed & operator-=(const Fixed b)	{ return *this = *this - b; }
+	Fixed & operator*=(const Fixed b)	{ return *this = *this * b; }
+	Fixed & operator/=(const Fixed b)	{ return *this = *this / b; }
+
+	friend bool operator==(const Fixed a, const Fixed b)	{ return a.raw == b.raw; }
+	friend bool operator!=(const Fixed a, const Fixed b)	{ return a.raw != b.raw; }
+	friend bool operator< (const Fixed a, const Fixed b)	{ return a.raw <  b.raw; }
+	friend bool operator> (const Fixed a, const Fixed b)	{ return a.raw >  b.raw; }
+	friend bool operator<=(const Fixed a, const Fixed b)	{ return a.raw <= b.raw; }
+	friend bool operator>=(const Fixed a, const Fixed b)	{ return a.raw >= b.raw; }
+
+
+	/***** fonctions mathematiques ******/
+
+	friend Fixed fabs(const Fixed a)	{ return a.raw < 0 ? -a : a; }
+
+	/// racine entiere bit a bit, 0 pour un argument negatif
+	friend Fixed sqrt(const Fixed a) {
+		if (a.raw <= 0)		return from_raw(0);
+		uint64_t op = uint64_t(a.raw) << frac;
+		uint64_t res = 0;
+		uint64_t bit = uint64_t(1) << 62;
+		while (bit > op)	bit >>= 2;
+		while (bit) {
+			if (op >= res + bit) {
+				op -= res + bit;
+				res = (res >> 1) + bit;
+			}
+			else	res >>= 1;
+			bit >>= 2;
+		}
+		return from_raw(res);
+	}
+
+	/// CORDIC en mode vectorisation
+	friend Fixed atan2(const Fixed y, const Fixed x) {
+		if (x.raw == 0 && y.raw == 0)	return from_raw(0);
+		int64_t X = x.raw, Y = y.raw, z = 0;
+		// ramener dans le demi-plan x > 0
+		if (X < 0) {
+			z = Y < 0 ? -cordic_pi : cordic_pi;
+			X = -X;
+			Y = -Y;
+		}
+		// normaliser pour garder la precision pendant les decalages
+		while ((X > 0 ? X : -X) < (int64_t(1)<<28) && (Y > 0 ? Y : -Y) < (int64_t(1)<<28)) {
+			X <<= 1;
+			Y <<= 1;
+		}
+		for (int i=0; i<cordic_iterations; i++) {
+			int64_t Xi = X;
+			if (Y > 0)	{ X += Y >> i;	Y -= Xi >> i;	z += cordic_atan[i]; }
+			else		{ X -= Y >> i;	Y += Xi >> i;	z -= cordic_atan[i]; }
+		}
+		return from_raw(saturate((z + (int64_t(1) << (28-frac))) >> (29-frac)));
+	}
+	friend Fixed atan(const Fixed a)	{ return atan2(a, Fixed(1)); }
+
+	/// CORDIC en mode rotation, donne le cosinus et le sinus en Q29
+	static void cordic_rotate(const Fixed a, int64_t &c, int64_t &s) {
+		int64_t z = int64_t(a.raw) << (29-frac);
+		// ramener l'angle dans [-pi/2, pi/2]
+		z %= 2*cordic_pi;
+		if (z > cordic_pi)	z -= 2*cordic_pi;
+		if (z < -cordic_pi)	z += 2*cordic_pi;
+		int sign = 1;
+		if (z > cordic_pi/2)		{ z -= cordic_pi;	sign = -1; }
+		else if (z < -cordic_pi/2)	{ z += cordic_pi;	sign = -1; }
+
+		int64_t X = cordic_gain, Y = 0;
+		for (int i=0; i<cordic_iterations; i++) {
+			int64_t Xi = X;
+			if (z >= 0)	{ X -= Y >> i;	Y += Xi >> i;	z -= cordic_atan[i]; }
+			else		{ X += Y >> i;	Y -= Xi >> i;	z += cordic_atan[i]; }
+		}
+		c = sign*X;
+		s = sign*Y;
+	}
+	friend Fixed cos(const Fixed a) {
+		int64_t c, s;
+		cordic_rotate(a, c, s);
+		return from_raw((c + (int64_t(1) << (28-frac))) >> (29-frac));
+	}
+	friend Fixed sin(const Fixed a) {
+		int64_t c, s;
+		cordic_rotate(a, c, s);
+		return from_raw((s + (int64_t(1) << (28-frac))) >> (29-frac));
+	}
+};
+
+/// Q19.12: assez de dynamique pour les carrés de longueurs du robot (mm^2), et une resolution de 0.25 µm ou 0.25 mrad
+typedef Fixed<12> fix12;
+
+};
+#endif
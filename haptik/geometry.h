@@ -0,0 +1,82 @@
+#ifndef _GEOMETRY_H
+#define _GEOMETRY_H
+
+/*
+	dimensions du robot et constantes qui en decoulent, calculées a la compilation
+	BasicDelta se construit a partir de ces tableaux: un `constexpr Delta` est entierement calculé par le compilateur et peut rester en flash.
+*/
+
+#include "constmath.h"
+#include <stddef.h>
+
+namespace geometry {
+
+struct Constants {
+	float RgA[8][4];	// rotules de la plateforme, coordonnées homogenes dans le repere de la sous-plateforme
+	float b[8][3];		// pivots des leviers
+	float axis[8][3];	// axes des pivots
+	float ra, rb, R, l;
+};
+
+constexpr Constants compute() {
+	const double ra = 39;	// (mm) angle de placement des rotules sur la plateforme
+	const double rb = 125;	// (mm) angle de placement des pivotes des moteurs
+	const double R = 222;	// (mm) longueur de tringle (tube noir)
+	const double l = 77;	// (mm) longueur de levier des servo
+	const double phia_base = cm::deg2rad(23.19);
+	const double phib_base = cm::deg2rad(12.225);
+	const double pi = cm::pi;
+	const double phia[8] = {
+		phia_base,
+		pi/2 - phia_base,
+		pi/2 + phia_base,
+		pi - phia_base,
+		pi + phia_base,
+		3*pi/2 - phia_base,
+		3*pi/2 + phia_base,
+		-phia_base
+	};
+	const double phib[8] = {
+		phib_base,
+		pi/2 - phib_base,
+		pi/2 + phib_base,
+		pi - phib_base,
+		pi + phib_base,
+		3*pi/2 - phib_base,
+		3*pi/2 + phib_base,
+		-phib_base
+	};
+	const float dirs[8][3] = {
+		{0,-1,0},
+		{1,0,0},
+		{1,0,0},
+		{0,1,0},
+		{0,1,0},
+		{-1,0,0},
+		{-1,0,0},
+		{0,-1,0}
+	};
+	
+	Constants c = {};
+	c.ra = ra;
+	c.rb = rb;
+	c.R = R;
+	c.l = l;
+	for (size_t i=0; i<8; i++) {
+		// rotation de phi autour de z de (r, 0, 0)
+		c.RgA[i][0] = ra * cm::cos(phia[i]);
+		c.RgA[i][1] = ra * cm::sin(phia[i]);
+		c.RgA[i][2] = 0;
+		c.RgA[i][3] = 1;
+		c.b[i][0] = rb * cm::cos(phib[i]);
+		c.b[i][1] = rb * cm::sin(phib[i]);
+		c.b[i][2] = 0;
+		for (size_t j=0; j<3; j++)	c.axis[i][j] = dirs[i][j];
+	}
+	return c;
+}
+
+constexpr Constants delta = compute();
+
+};
+#endif
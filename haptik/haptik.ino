@@ -1,5 +1,12 @@
 #include "model.h"
 #include "haptlib.h"
+#include "protocol.h"
+#include "scheduler.h"
+#include "probe.h"
+#include "observer.h"
+#include "scene.h"
+#include "telemetry.h"
+#include "command.h"
 #include <Arduino.h>
 #include <stdio.h>
 #include <string.h>
@@ -29,43 +36,34 @@ void send_pose(const vec8 & pose) {
 	}
 }
 
-static const size_t recvsize = 256;
-char recvbuff[recvsize];
-/// receive characters in recvbuff until the endseq sequence is found (the ending sequence will be in recvbuff too)
-bool receive(const char * endseq, const size_t endlen) {
-	size_t recvindex = 0;
-	size_t endindex = 0;
-	while (Serial.available() && recvindex < recvsize) {
-		char recv = recvbuff[recvindex++] = Serial.read();
-		if (recv == endseq[endindex]) {
-			endindex++;
-			if (endindex >= endlen)		break;
-		}
-	}
-	recvbuff[recvindex] = 0;
-	return recvindex < recvsize && endindex == endlen;
+bool dump_requested = false;	// rapport des sondes de temps a envoyer a la prochaine communication
+
+// octets recus, versés depuis le tampon de Serial a chaque loop(): les commandes peuvent arriver en morceaux entre deux communications
+// la communication en consomme au plus receive_budget par appel, plus que ce que le port recoit pendant sa periode
+command::Ring<512> serial_rx;
+static const size_t receive_budget = 256;
+command::Parser command_parser;
+
+/// verse les octets du port serie dans serial_rx
+void pump_serial() {
+	while (serial_rx.room() && Serial.available())	serial_rx.push(Serial.read());
 }
-/// receive a force-feedback info though the serial port
+
+/// receive a force-feedback info though the serial port, return the last complete order (UNKNOWN if there is none)
 ForceFeedback receive_feedback() {
 	ForceFeedback feedback;
-	if (receive("\n", 1)) {
-		if 		(strcmp(recvbuff, "force") == 0) 	feedback.type = ForceFeedback::FORCE;
-		else if (strcmp(recvbuff, "block") == 0) 	feedback.type = ForceFeedback::BLOCK;
-		else if (strcmp(recvbuff, "none") == 0)		feedback.type = ForceFeedback::NONE;
-		else										feedback.type = ForceFeedback::UNKNOWN;
-		if (feedback.type == ForceFeedback::NONE)
-			return feedback;
-		
-		size_t index = 0;
-		for (size_t i=0; i<8; i++) {
-			if (sscanf(recvbuff+index, "%f,", &feedback.vec(i)) != 1) {
-				feedback.type = ForceFeedback::UNKNOWN;
-				break;
-			}
-			while (recvbuff[index] != ',' && index < recvsize)	index++;
+	feedback.type = ForceFeedback::UNKNOWN;
+	uint8_t byte;
+	for (size_t n=0; n<receive_budget && serial_rx.pop(byte); n++) {
+		if (!command_parser.push(byte))		continue;
+		switch (command_parser.kind) {
+			case command::FORCE:	feedback.type = ForceFeedback::FORCE;	break;
+			case command::BLOCK:	feedback.type = ForceFeedback::BLOCK;	break;
+			case command::NONE:		feedback.type = ForceFeedback::NONE;	break;
+			case command::PROBES:	dump_requested = true;	continue;
 		}
+		feedback.vec = feedback.type == ForceFeedback::NONE ? vec8(0.) : vec8(command_parser.value);
 	}
-	else	feedback.type = ForceFeedback::UNKNOWN;
 	return feedback;
 }
 
@@ -74,102 +72,191 @@ ForceFeedback receive_feedback() {
 bool enable_feedback = true;	// retour de force
 bool enable_measure = true;		// envoi de la pose sur le port serie
 bool enable_assist = false;		// suivi de mouvement utilisateur (spasmes)
+bool enable_binary = true;		// protocole binaire (protocol.h) au lieu des commandes texte
+bool enable_velocity = false;	// lecture des vitesses moteurs pour l'observateur, une fois par resolution du mgd
 
 HaptikDXL dxl;
-Delta model;
-vec8 last_pose;
+constexpr Delta model;	// geometrie calculée a la compilation, en flash
+Delta::broyden solver_cache;	// jacobienne inverse reutilisée d'un tick a l'autre par mgd_solve
+Delta::levenberg solver_damping;	// amortissement des resolutions de reprise
+Observer observer;		// pose et vitesse filtrées, point de depart du mgd
+bool last_converged = false;
 ForceFeedback feedback;
 vec8 feedback_dir;
 vec8 feedback_origin;
+scene::Scene haptic_scene;			// primitives evaluées a chaque periode de controle
+Delta::jacobian scene_jacobian;		// mci a la derniere pose resolue: vitesses moteurs vers X, et effort de la scene vers les moteurs
+bool scene_jacobian_valid = false;
+telemetry::Recorder recorder;		// voies enregistrées a chaque tick, envoyées par communicate()
+static const float force_current = 1.;	// (mA/N)	TODO: a determiner experimentalement
 
-// nbr de périodes de loop entre chaque communications (envoi de pose et reception d'ordre)
-static const int comrefresh_sample = 10;
-int comrefresh = 0;	// compteur periodes depuis dernier envoi
+// periodes des taches (µs)
+static const uint32_t control_period = 2000;		// lecture des angles, limites et courants
+static const uint32_t kinematics_period = 4000;	// resolution du mgd
+// nbr de périodes de controle entre chaque communications (envoi de pose et reception d'ordre)
+int comrefresh_sample = 10;
 
-void setup() {
-	Serial.begin(57600);
-	dxl.begin("3", 1000000);
-	
-	for (int i=0; i<N; i++) {
-		// check the motor connection
-		if (!dxl.ping(i)) {
-			Serial.print("motor ");
-			Serial.print(i);
-			Serial.println(" not responding");
+// etat partagé entre les taches: chaque tache ecrit entierement ce qu'elle produit, les autres lisent la derniere valeur
+vec8 angle;				// angles moteurs, ecrits par le controle
+vec8 angle_velocity;	// vitesses moteurs (rad/s), si enable_velocity
+bool velocity_fresh = false;	// angle_velocity lue avec les angles courants, pas encore utilisée par la cinematique
+bool velocity_requested = false;	// la lecture des angles en cours comprend les vitesses
+uint32_t angle_time;	// instant de lecture des angles (µs)
+Delta::state pose;		// derniere pose resolue, ecrite par la cinematique
+
+Scheduler scheduler(micros);
+int comm_task = -1;
+
+proto::Encoder encoder;
+proto::Decoder decoder;
+
+/// send the pose through Serial as a binary frame
+void send_pose_binary(const vec8 & pose) {
+	proto::Message message;
+	message.type = proto::POSE;
+	message.timestamp = micros();
+	for (size_t i=0; i<N; i++)	message.vec[i] = pose(i);
+	uint8_t frame[proto::max_frame];
+	Serial.write(frame, encoder.encode(message, frame));
+}
+/// send the complete telemetry blocks, as long as the serial buffer takes them without blocking
+void send_telemetry() {
+	proto::Message message;
+	message.type = proto::TELEMETRY;
+	uint8_t frame[proto::max_frame];
+	size_t size;
+	const uint8_t *block;
+	while ((block = recorder.next(size))) {
+		// taille de la trame: contenu, entete, crc, un octet de COBS et le delimiteur. sinon le bloc attend la prochaine communication
+		if (Serial.availableForWrite() < int(proto::header_size + size + proto::crc_size + 2))	break;
+		message.timestamp = micros();
+		message.length = size;
+		memcpy(message.text, block, size);
+		Serial.write(frame, encoder.encode(message, frame));
+		recorder.release();
+	}
+}
+/// answer a latency measurement of the computer, with the timestamp of its request
+void send_ping(uint32_t echo) {
+	proto::Message message;
+	message.type = proto::PING;
+	message.timestamp = micros();
+	message.echo = echo;
+	uint8_t frame[proto::max_frame];
+	Serial.write(frame, encoder.encode(message, frame));
+}
+/// send the timing report, one line per message
+void dump_probes() {
+	proto::Message message;
+	message.type = proto::TEXT;
+	uint8_t frame[proto::max_frame];
+	for (size_t i=0; (message.length = probe::format(i, message.text, proto::max_text)); i++) {
+		if (enable_binary) {
+			message.timestamp = micros();
+			Serial.write(frame, encoder.encode(message, frame));
+		}
+		else {
+			message.text[message.length] = 0;
+			Serial.println(message.text);
 		}
-		
-		// setup motor
-		dxl.set_profile_acceleration(i, 30000.);
-		dxl.set_profile_velocity(i, 200.);
-		dxl.enable(i, true);
-		
-		// set the initial pose (in real and in memory)
-		const float default_position = 0;
-		dxl.set_mode(i, HaptikDXL::POSITION);
-		dxl.set_position(i, default_position);
-		last_pose = vec8(0.);
-		delay(1000);
-		
-		// setup current mode for the rest of the program
-		dxl.set_mode(i, HaptikDXL::CURRENT);
 	}
-	
-	feedback = ForceFeedback {ForceFeedback::NONE, vec8(0.)};
-	feedback_dir = vec8(0.);
-	feedback_origin = last_pose;
+}
+/// decode the received bytes (receive_budget at most), return the last force-feedback order (UNKNOWN if there is none)
+/// configuration messages are applied immediately
+ForceFeedback receive_feedback_binary() {
+	ForceFeedback feedback;
+	feedback.type = ForceFeedback::UNKNOWN;
+	proto::Message message;
+	uint8_t byte;
+	for (size_t n=0; n<receive_budget && serial_rx.pop(byte); n++) {
+		if (!decoder.push(byte, message))	continue;
+		switch (message.type) {
+			case proto::FORCE:	feedback.type = ForceFeedback::FORCE;	break;
+			case proto::BLOCK:	feedback.type = ForceFeedback::BLOCK;	break;
+			case proto::NONE:	feedback.type = ForceFeedback::NONE;	haptic_scene.clear();	break;
+			case proto::DUMP:	dump_requested = true;	continue;
+			case proto::SCENE:
+				haptic_scene.set(message.scene.slot, scene::Kind(message.scene.kind), message.scene.first, message.scene.values, message.scene.count);
+				continue;
+			case proto::PATH:
+				haptic_scene.set_points(message.scene.first, message.scene.values, message.scene.count);
+				continue;
+			case proto::RECORD:
+				for (size_t c=0; c<telemetry::channels; c++)	recorder.select(telemetry::Channel(c), message.decimation[c]);
+				continue;
+			case proto::PING:
+				send_ping(message.timestamp);
+				continue;
+			case proto::CONFIG:
+				enable_feedback = message.config.flags & proto::FEEDBACK;
+				enable_measure = message.config.flags & proto::MEASURE;
+				enable_assist = message.config.flags & proto::ASSIST;
+				enable_binary = !(message.config.flags & proto::ASCII);
+				enable_velocity = message.config.flags & proto::VELOCITY;
+				if (message.config.refresh) {
+					comrefresh_sample = message.config.refresh;
+					scheduler.set_period(comm_task, comrefresh_sample * control_period);
+				}
+				continue;
+			default:
+				continue;
+		}
+		feedback.vec = feedback.type == ForceFeedback::NONE ? vec8(0.) : vec8(message.vec);
+	}
+	return feedback;
 }
 
-void loop() {
+/// lance la lecture des angles, avec celle des vitesses seulement quand la cinematique a consommé les precedentes:
+/// elle allonge l'echange au dela de la periode de controle a 1 Mbps
+void request_angles() {
+	velocity_requested = enable_velocity && !velocity_fresh;
+	dxl.submit_state(velocity_requested);
+}
+
+/// lecture des angles et ecriture des courants, a la plus haute frequence
+void control() {
+	uint32_t start = micros();
 	// restreindre les plages des moteurs (en attendant de faire ca avec des detections de singularités)
-	const float force_current = 1.;	// (Nm/mA)	TODO: a determiner experimentalement
-	const float current_corr = 5.;	// (mA/mm)	TODO: a affiner
-	
 	const float max_angle = 2;	// rad
 	const float min_angle = -0.5;	// rad
 	const float resist_current = 50;	// mA
-	vec8 angle;
-	
-	// get the pose
-	for (size_t i=0; i<N; i++) 	angle(i) = dxl.get_position(i);
-	
-	Delta::state pose = model.mgd_solve(angle, last_pose);	// compute the pose
 	
-	if (comrefresh == 0) {
-		if (enable_measure) 
-			send_pose(pose.X);	// send to computer
-		
-		if (enable_feedback) {
-			// receive order and setup execution datas
-			ForceFeedback new_fb = feedback = receive_feedback();
-			if (new_fb.type != ForceFeedback::UNKNOWN)	{
-				feedback = new_fb;
-				switch (feedback.type) {
-					case ForceFeedback::FORCE:
-						feedback_dir = force_current * (model.mci(pose) * feedback.vec);
-						break;
-					case ForceFeedback::BLOCK:
-						// le vecteur passé est une direction (donc vecteur normé), si sa norme n'est pas 1, elle servira de facteur a l'asservissement
-						feedback_dir = current_corr * (model.mci(pose) * feedback.vec);
-						feedback_origin = pose.X;
-						break;
-				}
+	// get the angles, in one bus transaction if possible
+	// avec les echanges non bloquants (sur l'hote seulement, voir setup), la lecture a été lancée a la fin du tick precedent
+	// et son resultat est deja arrivé
+	{
+		PROBE(READ);
+		if (!dxl.state_pending())	request_angles();
+		if (!dxl.collect_state(&angle(0), &angle_velocity(0), &angle_time)) {
+			for (size_t i=0; i<N; i++) {
+				angle(i) = dxl.get_position(i);
+				if (velocity_requested)		angle_velocity(i) = dxl.get_velocity(i);
 			}
+			angle_time = micros();
 		}
+		velocity_fresh = velocity_requested;
+		recorder.record(telemetry::ANGLES, &angle(0), angle_time);
 	}
-	comrefresh = (comrefresh+1)%comrefresh_sample;
 	
-	// apply feedback
+	// apply feedback, with the last solved pose
 	vec8 current;
 	switch (feedback.type) {
 		case ForceFeedback::FORCE:
 			current = feedback_dir;
 			break;
 		case ForceFeedback::BLOCK:
-			current = dot(pose.X - feedback_origin, feedback.vec) * feedback_dir;
+			// ressort seul: sur le robot simulé, le frottement des reducteurs l'amortit deja, et un terme de vitesse
+			// (estimée des poses ou lue sur les moteurs, filtrée ou non) n'a fait qu'ajouter des vibrations
+			current = -dot(pose.X - feedback_origin, feedback.vec) * feedback_dir;
 			break;
 		default:
 			current = vec8(0.);
 	}
+	// scene locale: pose extrapolée a l'instant de lecture des angles, effort ramené sur les moteurs par J^T
+	if (enable_feedback && !haptic_scene.empty() && scene_jacobian_valid) {
+		vec8 wrench = haptic_scene.evaluate(observer.predict(angle_time), observer.velocity());
+		current += force_current * scene_jacobian.apply_transpose(wrench);
+	}
 	
 	// apply limitations
 	for (size_t i=0; i<N; i++) {
@@ -178,5 +265,155 @@ void loop() {
 	}
 	
 	// apply torques to motors
-	for (size_t i=0; i<N; i++)	dxl.set_current(i, current(i));
+	{
+		PROBE(WRITE);
+		if (!dxl.sync_set_current(&current(0)))
+			for (size_t i=0; i<N; i++)	dxl.set_current(i, current(i));
+	}
+	recorder.record(telemetry::CURRENT, &current(0), angle_time);
+	// lecture du tick suivant: sur le bus pendant la cinematique et les autres taches, seulement avec un moteur de transactions attaché
+	if (dxl.asynchronous())		request_angles();
+	float duration = micros() - start;
+	recorder.record(telemetry::LOOP, &duration, start);
+}
+
+/// resolution de la pose a partir des derniers angles lus
+void kinematics() {
+	PROBE(SOLVE);
+	Delta::solve_info info;
+	// partir de la pose predite a l'instant de lecture des angles
+	// apres une resolution qui n'a pas convergé (grand deplacement, demarrage, singularité), repartir plutot de la table de poses
+	// avec les moindres carrés amortis, plus robustes loin de la solution
+	uint32_t time = angle_time;
+	if (last_converged)		pose = model.mgd_solve(angle, observer.predict(time), solver_cache, &info);
+	else					pose = model.mgd_solve(angle, model.seed(angle), solver_damping, &info);
+	probe::record_iterations(info.iterations);
+	recorder.record(telemetry::POSE, &pose.X(0), time);
+	float solver[] = {float(info.iterations), float(info.residual)};
+	recorder.record(telemetry::SOLVER, solver, time);
+	// une resolution qui a echoué (angles hors de l'espace de travail) ne corrige pas l'observateur, la suivante repart d'une vitesse nulle
+	if (info.converged) {
+		if (last_converged)		observer.update(pose.X, time);
+		else					observer.reset(pose.X, time);
+		// jacobienne a la pose resolue, une seule fois pour les vitesses moteurs (ramenées dans l'espace de X) et pour la scene
+		if (velocity_fresh || !haptic_scene.empty()) {
+			PROBE(MCI);
+			scene_jacobian = model.mci_factor(pose);
+		}
+		if (velocity_fresh)		observer.update_velocity(scene_jacobian.apply(angle_velocity));
+	}
+	scene_jacobian_valid = info.converged && !haptic_scene.empty();
+	velocity_fresh = false;
+	last_converged = info.converged;
+}
+
+/// envoi de la pose et reception des ordres, a basse frequence
+void communicate() {
+	const float current_corr = 5.;	// (mA/mm)	TODO: a affiner
+	PROBE(COMM);
+	
+	if (enable_measure) {
+		// send to computer
+		// pose extrapolée a l'instant d'envoi: sans le retard depuis la derniere lecture des angles
+		vec8 X = last_converged ? observer.predict(micros()) : pose.X;
+		if (enable_binary)	send_pose_binary(X);
+		else				send_pose(X);
+	}
+	
+	if (enable_feedback) {
+		// receive order and setup execution datas
+		ForceFeedback new_fb = enable_binary ? receive_feedback_binary() : receive_feedback();
+		if (new_fb.type != ForceFeedback::UNKNOWN)	{
+			feedback = new_fb;
+			// effort sur X ramené sur les moteurs par J^T (travail virtuel: couples = (dX/dq)^T effort), comme pour la scene
+			switch (feedback.type) {
+				case ForceFeedback::FORCE: {
+					PROBE(MCI);
+					feedback_dir = force_current * model.mci_factor(pose).apply_transpose(feedback.vec);
+					break;
+				}
+				case ForceFeedback::BLOCK: {
+					PROBE(MCI);
+					// le vecteur passé est une direction (donc vecteur normé), si sa norme n'est pas 1, elle servira de facteur a l'asservissement
+					feedback_dir = current_corr * model.mci_factor(pose).apply_transpose(feedback.vec);
+					feedback_origin = pose.X;
+					break;
+				}
+				default:
+					break;
+			}
+		}
+	}
+	
+	if (enable_binary)	send_telemetry();
+	
+	if (dump_requested) {
+		dump_probes();
+		dump_requested = false;
+	}
+}
+
+void setup() {
+	Serial.begin(57600);
+	probe::init();
+	dxl.begin("3", 1000000);
+	
+	for (int i=0; i<N; i++) {
+		// check the motor connection
+		if (!dxl.ping(i)) {
+			Serial.print("motor ");
+			Serial.print(i);
+			Serial.println(" not responding");
+		}
+		
+		// sans delai de retour: celui d'usine (250 µs par lecture) ne laisse pas le controle tenir sa periode
+		dxl.set_return_delay(i, 0);
+		
+		// setup motor: les deux profils sont voisins dans la table, un seul paquet
+		dxl.begin_batch();
+		dxl.set_profile_acceleration(i, 30000.);
+		dxl.set_profile_velocity(i, 200.);
+		dxl.end_batch();
+		dxl.enable(i, true);
+		
+		// set the initial pose (in real and in memory)
+		const float default_position = 0;
+		dxl.set_mode(i, HaptikDXL::POSITION);
+		dxl.set_position(i, default_position);
+		delay(1000);
+		
+		// setup current mode for the rest of the program
+		dxl.set_mode(i, HaptikDXL::CURRENT);
+	}
+	
+	// lectures et ecritures groupées dans loop()
+	if (!dxl.setup_sync(N))
+		Serial.println("sync read/write unavailable");
+	// pas de dxl.attach() sur la carte: il manque un dxlbus::Transport pour le port DXL de l'OpenCR, qui bascule la ligne
+	// half-duplex par sa broche de direction. les echanges restent bloquants, et la lecture anticipée des angles
+	// (dxl.asynchronous()) n'existe que sur l'hote, avec le bus simulé de test_hil
+	
+	// pose de depart: resolue a partir de la pose de la table la plus proche des angles reels
+	for (size_t i=0; i<N; i++) 	angle(i) = dxl.get_position(i);
+	angle_velocity = vec8(0.);
+	angle_time = micros();
+	Delta::solve_info info;
+	pose = model.mgd_solve(angle, &info);
+	observer.reset(pose.X, angle_time);
+	last_converged = info.converged;
+	
+	feedback = ForceFeedback {ForceFeedback::NONE, vec8(0.)};
+	feedback_dir = vec8(0.);
+	feedback_origin = pose.X;
+	
+	// taches de la plus prioritaire a la moins prioritaire
+	scheduler.add("control", control, control_period);
+	scheduler.add("kinematics", kinematics, kinematics_period);
+	comm_task = scheduler.add("comm", communicate, comrefresh_sample * control_period);
+}
+
+void loop() {
+	pump_serial();
+	dxl.poll();
+	scheduler.poll();
 }
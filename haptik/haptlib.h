@@ -2,12 +2,15 @@
 #define _haptlib_h
 
 #include <DynamixelWorkbench.h>
+#include "dxlbus.h"
+#include <string.h>
 
 //class HaptikDXL : public DynamixelDriver {
 class HaptikDXL : public DynamixelWorkbench {
 public:	
 	
 	enum DXLREG {
+		RETURN_DELAY_TIME = 9,
 		MODE = 11,
 		ENABLE = 64,
 		
@@ -44,11 +47,20 @@ public:
 	};
 	
 	typedef uint16_t dxlid;
+	
+	/// handlers des operations groupées, dans l'ordre de creation par setup_sync
+	enum SYNC_HANDLER {
+		SYNC_WRITE_CURRENT = 0,
+		SYNC_READ_POSITION = 0,
+		SYNC_READ_STATE = 1,
+	};
+	static const uint16_t SYNC_STATE_END = DXLREG::PRESENT_POSITION + 4;	// fin de la plage courant, vitesse, position
 
-	const int32_t MAX_ENCODER = 4095;
-	const float UNIT_ANGLE = 2*M_PI/MAX_ENCODER;
+	static constexpr int32_t MAX_ENCODER = 4095;
+	static constexpr float UNIT_ANGLE = 2*M_PI/MAX_ENCODER;
 	const float UNIT_ACCELERATION = 214.577;
-	const float UNIT_VELOCITY = 0.229;
+	const float UNIT_VELOCITY = 0.229;	// rpm, unité des profils de vitesse
+	const float UNIT_ANGULAR_VELOCITY = UNIT_VELOCITY * 2*M_PI/60;	// rad/s, unité des vitesses lues
 	const float UNIT_CURRENT = 2.69;
 	const float UNIT_VOLTAGE = 0.00113;
 	
@@ -57,37 +69,119 @@ public:
 	*/
 	// torque
 	float get_torque(dxlid id) {
-		int8_t _torque;
-		readRegister(id, DXLREG::ENABLE, 1, (uint32_t*) &_torque);
-		return _torque;
+		uint32_t _torque = 0;	// la bibliotheque ecrit toujours 32 bits
+		read_register(id, DXLREG::ENABLE, 1, &_torque);
+		return int8_t(_torque);
 	}
 	
 	// courant en mA
 	float get_current(dxlid id) {
-		int16_t _current;
-		readRegister(id, DXLREG::PRESENT_CURRENT, 2, (uint32_t*) &_current);
-		return _current * UNIT_CURRENT;
+		uint32_t _current = 0;
+		read_register(id, DXLREG::PRESENT_CURRENT, 2, &_current);
+		return int16_t(_current) * UNIT_CURRENT;
 	}
 	
 	// vitesse en rad/s
 	float get_velocity(dxlid id) {
 		int32_t _velocity;
-		readRegister(id, DXLREG::PRESENT_VELOCITY, 4, (uint32_t*) &_velocity);
-		return _velocity * UNIT_VELOCITY;
+		read_register(id, DXLREG::PRESENT_VELOCITY, 4, (uint32_t*) &_velocity);
+		return _velocity * UNIT_ANGULAR_VELOCITY;
 	}
 	
 	// position en rad
 	float get_position(dxlid id) {
 		int32_t _position;
-		readRegister(id, DXLREG::PRESENT_POSITION, 4, (uint32_t*) &_position);
+		read_register(id, DXLREG::PRESENT_POSITION, 4, (uint32_t*) &_position);
 		return _position * UNIT_ANGLE;
 	}
 	
 	// voltage
 	float get_voltage(dxlid id) {
-		int16_t _voltage;
-		readRegister(id, DXLREG::PRESENT_VOLTAGE, 2, (uint32_t*) &_voltage);
-		return _voltage * UNIT_VOLTAGE;
+		uint32_t _voltage = 0;
+		read_register(id, DXLREG::PRESENT_VOLTAGE, 2, &_voltage);
+		return int16_t(_voltage) * UNIT_VOLTAGE;
+	}
+
+	/*
+		operations groupées: un seul paquet d'instruction pour tous les moteurs (Sync Read / Sync Write)
+		a appeler apres begin(), pour les moteurs d'identifiants 0 a count-1
+	*/
+	
+	static const uint8_t MAX_SYNC = 8;
+	
+	/// declare les handlers de la bibliotheque, ils sont numérotés dans l'ordre de creation
+	bool setup_sync(uint8_t count) {
+		sync_count = count < MAX_SYNC ? count : MAX_SYNC;
+		for (uint8_t i=0; i<sync_count; i++)	sync_ids[i] = i;
+		sync_ready = addSyncWriteHandler(DXLREG::GOAL_CURRENT, 2)								// SYNC_WRITE_CURRENT
+				&& addSyncReadHandler(DXLREG::PRESENT_POSITION, 4)								// SYNC_READ_POSITION
+				&& addSyncReadHandler(DXLREG::PRESENT_CURRENT, SYNC_STATE_END - DXLREG::PRESENT_CURRENT);	// SYNC_READ_STATE
+		return sync_ready;
+	}
+	
+	/// positions de tous les moteurs en rad
+	bool sync_get_position(float *position) {
+		int32_t _position[MAX_SYNC];
+		if (engine)		return sync_ready && collect(engine->sync_read(DXLREG::PRESENT_POSITION, 4, sync_ids, sync_count), position, nullptr, nullptr, nullptr);
+		if (!sync_ready
+		||	!syncRead(SYNC_READ_POSITION, sync_ids, sync_count)
+		||	!getSyncReadData(SYNC_READ_POSITION, sync_ids, sync_count, DXLREG::PRESENT_POSITION, 4, _position))
+			return false;
+		for (uint8_t i=0; i<sync_count; i++)	position[i] = _position[i] * UNIT_ANGLE;
+		return true;
+	}
+	
+	/// position (rad), vitesse (rad/s) et courant (mA) de tous les moteurs en un seul echange: les registres sont contigus
+	/// velocity et current peuvent etre nuls
+	bool sync_get_state(float *position, float *velocity, float *current) {
+		int32_t _position[MAX_SYNC], _velocity[MAX_SYNC], _current[MAX_SYNC];
+		if (engine)		return sync_ready && collect(engine->sync_read(DXLREG::PRESENT_CURRENT, SYNC_STATE_END - DXLREG::PRESENT_CURRENT, sync_ids, sync_count), position, velocity, current, nullptr);
+		if (!sync_ready
+		||	!syncRead(SYNC_READ_STATE, sync_ids, sync_count)
+		||	!getSyncReadData(SYNC_READ_STATE, sync_ids, sync_count, DXLREG::PRESENT_POSITION, 4, _position)
+		||	!getSyncReadData(SYNC_READ_STATE, sync_ids, sync_count, DXLREG::PRESENT_VELOCITY, 4, _velocity)
+		||	!getSyncReadData(SYNC_READ_STATE, sync_ids, sync_count, DXLREG::PRESENT_CURRENT, 2, _current))
+			return false;
+		for (uint8_t i=0; i<sync_count; i++) {
+			position[i] = _position[i] * UNIT_ANGLE;
+			if (velocity)	velocity[i] = _velocity[i] * UNIT_ANGULAR_VELOCITY;
+			if (current)	current[i] = int16_t(_current[i]) * UNIT_CURRENT;
+		}
+		return true;
+	}
+	
+	/// courants de tous les moteurs en mA, sans retour des moteurs
+	/// seuls les moteurs dont la consigne quantifiée change sont dans le paquet, et il n'y a pas de paquet si aucune ne change
+	/// sauf toutes les SYNC_REFRESH ecritures, ou tous les moteurs sont envoyés: sans retour des moteurs, un paquet perdu sur le bus
+	/// ne serait sinon jamais corrigé. seul un paquet complet remet le compte a zero: un paquet partiel n'envoie pas les autres moteurs
+	bool sync_set_current(const float *current) {
+		int32_t _current[MAX_SYNC];
+		uint8_t ids[MAX_SYNC];
+		uint8_t count = 0;
+		if (!sync_ready)	return false;
+		bool refresh = ++sync_suppressed >= SYNC_REFRESH;
+		for (uint8_t i=0; i<sync_count; i++) {
+			int16_t value = current[i] / UNIT_CURRENT;
+			if (!refresh && unchanged(sync_ids[i], DXLREG::GOAL_CURRENT, 2, &value))	continue;
+			ids[count] = sync_ids[i];
+			_current[count++] = value;
+		}
+		if (!count) {
+			write_counters.suppressed++;
+			return true;
+		}
+		if (count == sync_count)	sync_suppressed = 0;
+		write_counters.sent++;
+		// avec un moteur de transactions, le paquet est seulement mis en file: faux si la file est pleine
+		if (engine ? !engine->sync_write(DXLREG::GOAL_CURRENT, 2, ids, count, _current) : !syncWrite(SYNC_WRITE_CURRENT, ids, count, _current, 1)) {
+			for (uint8_t i=0; i<count; i++)		forget(ids[i], DXLREG::GOAL_CURRENT, 2);
+			return false;
+		}
+		for (uint8_t i=0; i<count; i++) {
+			int16_t value = _current[i];
+			store(ids[i], DXLREG::GOAL_CURRENT, 2, &value, false);
+		}
+		return true;
 	}
 
 	/* 
@@ -96,42 +190,54 @@ public:
 	*/
 	
 	void enable(dxlid id, bool enable) {
-		writeRegister(id, DXLREG::ENABLE, 1, (uint8_t*) &enable);
+		uint8_t _enable = enable;
+		write(id, DXLREG::ENABLE, 1, &_enable);
 	}
 	
+	/// le mode ne s'ecrit que couple coupé: rien n'est envoyé si le moteur y est deja (il reste alors seulement a activer le couple)
 	void set_mode(dxlid id, uint8_t mode) {
-		enable(id, false);
-		writeRegister(id, DXLREG::MODE, 1, (uint8_t*) &mode);
+		if (!unchanged(id, DXLREG::MODE, 1, &mode)) {
+			// les ecritures en attente du moteur partent avant, dans l'ancien mode, puis le changement est immediat meme dans un lot
+			flush(id);
+			bool batch = batching;
+			batching = false;
+			enable(id, false);
+			write(id, DXLREG::MODE, 1, &mode);
+			// le changement de mode peut remettre des consignes et des gains par defaut: l'ombre de la zone RAM n'est plus sure
+			forget(id, DXLREG::ENABLE, SHADOW_SIZE - DXLREG::ENABLE);
+			batching = batch;
+		}
+		else 	write_counters.suppressed++;
 		enable(id, true);
 	}
 	
 	/// voltage comme fraction de l'alim (1 pour max)
 	void set_voltage(dxlid id, float voltage) {
 		int16_t _voltage = voltage / UNIT_VOLTAGE;
-		writeRegister(id, DXLREG::GOAL_VOLTAGE, 2, (uint8_t*) &_voltage);
+		write(id, DXLREG::GOAL_VOLTAGE, 2, &_voltage);
 		Serial.print("voltage set to");
 		Serial.println(_voltage);
 	}
 
-	/// courant en mA
+	/// courant en mA, pas envoyé si la consigne quantifiée (pas de UNIT_CURRENT) ne change pas
 	void set_current(dxlid id, float current) {
 		int16_t _current = current / UNIT_CURRENT;
 		//set_mode(id, DXL_MODE::CURRENT);
-		writeRegister(id, DXLREG::GOAL_CURRENT, 2, (uint8_t*) &_current);
+		write(id, DXLREG::GOAL_CURRENT, 2, &_current);
 	}
 	
 	/// position en rad
 	void set_position(dxlid id, float position) {
 		int32_t _position = position / UNIT_ANGLE;
 		//set_mode(id, DXL_MODE::POSITION);
-		writeRegister(id, DXLREG::GOAL_POSITION, 4, (uint8_t*) &_position);
+		write(id, DXLREG::GOAL_POSITION, 4, &_position);
 	}
 	
 	/// velocity en rad
 	void set_velocity(dxlid id, float velocity) {
 		int32_t _velocity = velocity / UNIT_VELOCITY;
 		//set_mode(id, DXL_MODE::POSITION);
-		writeRegister(id, DXLREG::GOAL_VELOCITY, 4, (uint8_t*) &_velocity);
+		write(id, DXLREG::GOAL_VELOCITY, 4, &_velocity);
 	}
 	
 	/*
@@ -142,31 +248,225 @@ public:
 	/// ce parametre sert aux asservissements de position et vitesse
 	void set_profile_acceleration(dxlid id, float accel) {
 		uint32_t _accel = accel / UNIT_ACCELERATION;
-		writeRegister(id, DXLREG::PROFILE_ACCELERATION, 4, (uint8_t*) &_accel);
+		write(id, DXLREG::PROFILE_ACCELERATION, 4, &_accel);
 	}
 	
 	/// vitesse cible en rad/s
 	/// ce parametre sert uniquement a l'asservissement de position
 	void set_profile_velocity(dxlid id, float velocity) {
 		uint32_t _velocity = velocity / UNIT_VELOCITY;
-		writeRegister(id, DXLREG::PROFILE_VELOCITY, 4, (uint8_t*) &_velocity);
+		write(id, DXLREG::PROFILE_VELOCITY, 4, &_velocity);
 	}
 	
 	///position min (0 - 4095)
 	void set_min_position(dxlid id, int32_t min) {
-		writeRegister(id, DXLREG::MIN_POSITION, 4,(uint8_t*) &min);
+		write(id, DXLREG::MIN_POSITION, 4, &min);
 	}
 	
 	///position max (0 - 4095)
 	void set_max_position(dxlid id, int32_t max) {
-		writeRegister(id, DXLREG::MAX_POSITION, 4,(uint8_t*) &max);
+		write(id, DXLREG::MAX_POSITION, 4, &max);
+	}
+	
+	/// delai de retour des moteurs (µs, par pas de 2 µs), 250 µs en sortie d'usine: chaque lecture l'attend
+	/// registre de l'EEPROM, a ecrire couple desactivé
+	void set_return_delay(dxlid id, uint32_t delay) {
+		uint8_t _delay = delay / 2;
+		write(id, DXLREG::RETURN_DELAY_TIME, 1, &_delay);
 	}
 	
 	void set_max_voltage(dxlid id, float max) {
 		uint16_t _voltage = 885; //max / UNIT_VOLTAGE;
-		writeRegister(id, DXLREG::MAX_VOLTAGE, 2, (uint8_t*) &_voltage);
+		write(id, DXLREG::MAX_VOLTAGE, 2, &_voltage);
+	}
+	
+	/*
+		ombre des registres ecrits
+		chaque ecriture passe par une copie locale des registres de chaque moteur: une valeur identique a la derniere ecrite n'est pas renvoyée.
+		dans un lot (begin_batch / end_batch) les ecritures attendent la fin du lot, et les registres modifiés qui se suivent
+		dans la table partent dans un seul paquet. hors d'un lot, chaque ecriture part immediatement.
+		la copie suppose que seule cette classe ecrit les registres: apres un redemarrage d'un moteur, appeler invalidate().
+	*/
+	
+	static const uint8_t SHADOW_SIZE = DXLREG::GOAL_POSITION + 4;	// registres 0 a GOAL_POSITION
+	static const uint8_t SYNC_REFRESH = 50;		// ecritures groupées des courants au plus entre deux paquets complets
+	
+	struct WriteCounters {
+		unsigned long sent;			// paquets d'ecriture envoyés
+		unsigned long suppressed;	// ecritures qui ne changeaient rien, pas envoyées
+		unsigned long coalesced;	// ecritures parties dans le paquet d'un autre registre
+	} write_counters = {0, 0, 0};
+	
+	void begin_batch()	{ batching = true; }
+	/// envoie les ecritures du lot, retourne faux si un paquet a echoué
+	bool end_batch() {
+		batching = false;
+		bool ok = true;
+		for (uint8_t id=0; id<MAX_SYNC; id++)	ok = flush(id) && ok;
+		return ok;
+	}
+	/// oublie les valeurs connues d'un moteur: les prochaines ecritures partiront toutes
+	void invalidate(dxlid id)	{ forget(id, 0, SHADOW_SIZE); }
+	void invalidate() {
+		for (uint8_t id=0; id<MAX_SYNC; id++)	invalidate(id);
+		sync_suppressed = 0;
 	}
 	
+	/*
+		echanges non bloquants (dxlbus.h)
+		avec un moteur de transactions attaché, tous les echanges de cette classe passent par lui. la lecture des angles
+		se fait alors en deux temps: submit_state() met l'instruction sur le bus et rend la main, collect_state() en recupere
+		le resultat. entre les deux, la carte calcule pendant que les octets passent sur le bus.
+		le moteur est alors seul sur le port: les methodes de la bibliotheque (begin, ping) sont a appeler avant attach().
+		sans moteur, submit_state() retient seulement la demande et collect_state() fait l'echange bloquant.
+	*/
+	
+	/// nul pour revenir aux echanges bloquants de la bibliotheque
+	void attach(dxlbus::Engine *transactions) {
+		engine = transactions;
+		state_requested = false;
+	}
+	bool asynchronous() const	{ return engine; }
+	/// fait avancer les echanges en cours, a appeler aussi souvent que possible
+	void poll()		{ if (engine)	engine->poll(); }
+	
+	/// lance la lecture groupée des positions, et des vitesses si velocity. faux si une lecture est deja en attente de collect_state()
+	bool submit_state(bool velocity) {
+		if (state_requested || !sync_ready)		return false;
+		state_velocity = velocity;
+		if (engine) {
+			state_handle = velocity
+				? engine->sync_read(DXLREG::PRESENT_CURRENT, SYNC_STATE_END - DXLREG::PRESENT_CURRENT, sync_ids, sync_count)
+				: engine->sync_read(DXLREG::PRESENT_POSITION, 4, sync_ids, sync_count);
+			if (state_handle < 0)	return false;
+		}
+		state_requested = true;
+		return true;
+	}
+	bool state_pending() const	{ return state_requested; }
+	/// resultat de la lecture lancée par submit_state(), en attendant sa fin si besoin: positions en rad, vitesses en rad/s
+	/// si la lecture les comprenait. time: instant ou le resultat est arrivé (µs). faux si la lecture a echoué
+	bool collect_state(float *position, float *velocity, uint32_t *time) {
+		if (!state_requested)	return false;
+		state_requested = false;
+		if (engine)		return collect(state_handle, position, state_velocity ? velocity : nullptr, nullptr, time);
+		bool ok = state_velocity ? sync_get_state(position, velocity, nullptr) : sync_get_position(position);
+		if (time)	*time = micros();
+		return ok;
+	}
+	
+private:
+	dxlbus::Engine *engine = nullptr;
+	dxlbus::Engine::Handle state_handle = -1;
+	bool state_requested = false;
+	bool state_velocity = false;
+	
+	bool read_register(dxlid id, uint16_t address, uint16_t length, uint32_t *data) {
+		if (!engine)	return readRegister(id, address, length, data);
+		dxlbus::Engine::Handle h = engine->read(id, address, length);
+		bool ok = engine->wait(h) && engine->get(h, id, address, length, data);
+		engine->release(h);
+		return ok;
+	}
+	bool write_register(dxlid id, uint16_t address, uint16_t length, const void *data) {
+		if (!engine)	return writeRegister(id, address, length, (uint8_t*) data);
+		dxlbus::Engine::Handle h = engine->write(id, address, length, data);
+		bool ok = engine->wait(h);
+		engine->release(h);
+		return ok;
+	}
+	/// lecture groupée du moteur de transactions, a partir de PRESENT_CURRENT ou de PRESENT_POSITION, convertie comme sync_get_state
+	bool collect(dxlbus::Engine::Handle h, float *position, float *velocity, float *current, uint32_t *time) {
+		bool ok = engine->wait(h);
+		for (uint8_t i=0; i<sync_count && ok; i++) {
+			uint32_t _position, _velocity, _current;
+			ok = engine->get(h, sync_ids[i], DXLREG::PRESENT_POSITION, 4, &_position)
+				&& (!velocity || engine->get(h, sync_ids[i], DXLREG::PRESENT_VELOCITY, 4, &_velocity))
+				&& (!current || engine->get(h, sync_ids[i], DXLREG::PRESENT_CURRENT, 2, &_current));
+			if (!ok)	break;
+			position[i] = int32_t(_position) * UNIT_ANGLE;
+			if (velocity)	velocity[i] = int32_t(_velocity) * UNIT_ANGULAR_VELOCITY;
+			if (current)	current[i] = int16_t(_current) * UNIT_CURRENT;
+		}
+		if (time)	*time = engine->finished(h);
+		engine->release(h);
+		return ok;
+	}
+	
+	uint8_t sync_ids[MAX_SYNC];
+	uint8_t sync_count = 0;
+	bool sync_ready = false;
+	uint8_t sync_suppressed = 0;	// ecritures groupées des courants depuis le dernier paquet complet
+	
+	// ombre, et pour chaque octet: valeur connue, ecriture en attente
+	uint8_t shadow[MAX_SYNC][SHADOW_SIZE];
+	uint8_t known[MAX_SYNC][(SHADOW_SIZE+7)/8] = {};
+	uint8_t dirty[MAX_SYNC][(SHADOW_SIZE+7)/8] = {};
+	uint8_t pending[MAX_SYNC] = {};		// ecritures en attente depuis le dernier flush
+	bool batching = false;
+	
+	static bool cached(dxlid id, uint16_t address, uint16_t length)	{ return id < MAX_SYNC && address + length <= SHADOW_SIZE; }
+	static bool bit(const uint8_t *bits, uint16_t i)	{ return bits[i/8] & (1 << (i%8)); }
+	static void mark(uint8_t *bits, uint16_t address, uint16_t length, bool value) {
+		for (uint16_t i=address; i<address+length; i++) {
+			if (value)	bits[i/8] |= 1 << (i%8);
+			else		bits[i/8] &= ~(1 << (i%8));
+		}
+	}
+	
+	/// vrai si le registre a deja cette valeur (ou va l'avoir au prochain flush)
+	bool unchanged(dxlid id, uint16_t address, uint16_t length, const void *data) const {
+		if (!cached(id, address, length))	return false;
+		for (uint16_t i=address; i<address+length; i++)
+			if (!bit(known[id], i))		return false;
+		return memcmp(&shadow[id][address], data, length) == 0;
+	}
+	void store(dxlid id, uint16_t address, uint16_t length, const void *data, bool write_pending) {
+		if (!cached(id, address, length))	return;
+		memcpy(&shadow[id][address], data, length);
+		mark(known[id], address, length, true);
+		mark(dirty[id], address, length, write_pending);
+	}
+	void forget(dxlid id, uint16_t address, uint16_t length) {
+		if (!cached(id, address, length))	return;
+		mark(known[id], address, length, false);
+	}
+	
+	/// ecriture d'un registre par l'ombre. retourne faux si le paquet a echoué
+	bool write(dxlid id, uint16_t address, uint16_t length, const void *data) {
+		if (unchanged(id, address, length, data)) {
+			write_counters.suppressed++;
+			return true;
+		}
+		if (!cached(id, address, length)) {
+			write_counters.sent++;
+			return write_register(id, address, length, data);
+		}
+		store(id, address, length, data, true);
+		pending[id]++;
+		return batching || flush(id);
+	}
+	/// envoie les ecritures en attente d'un moteur, un paquet par suite d'octets consecutifs a ecrire
+	bool flush(dxlid id) {
+		if (id >= MAX_SYNC || !pending[id])		return true;
+		bool ok = true;
+		unsigned long packets = 0;
+		for (uint16_t a=0; a<SHADOW_SIZE; ) {
+			if (!bit(dirty[id], a))	{ a++;	continue; }
+			uint16_t start = a;
+			while (a < SHADOW_SIZE && bit(dirty[id], a))	a++;
+			mark(dirty[id], start, a - start, false);
+			packets++;
+			if (!write_register(id, start, a - start, &shadow[id][start])) {
+				forget(id, start, a - start);
+				ok = false;
+			}
+		}
+		write_counters.sent += packets;
+		write_counters.coalesced += pending[id] - packets;
+		pending[id] = 0;
+		return ok;
+	}
 };
 
 #endif
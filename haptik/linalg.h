@@ -4,12 +4,132 @@
 #include <stddef.h>
 #include <math.h>
 
+/// noyaux de taille fixe (produits, transposée, produit scalaire) deroulés a la compilation jusqu'a LA_UNROLL elements
+/// au dela (8x8) le deroulement coute du code sans rien gagner: la boucle reste. LA_UNROLL=0 revient partout aux boucles
+#ifndef LA_UNROLL
+	#define LA_UNROLL 16
+#endif
+
 namespace la {
 
+template<class S, size_t dim> struct Vector;
+template<class S, size_t rows, size_t cols> struct Matrix;
+template<class T, size_t dim, size_t stride> struct VectorView;
+template<class T, size_t rows, size_t cols, size_t ld> struct MatrixView;
+
+
+/*
+	expressions paresseuses
+	les operateurs element par element et avec un scalaire ne calculent rien: ils retournent un noeud d'expression qui est évalué en une seule boucle au moment de l'affectation (ou de la conversion) en Vector ou Matrix, sans temporaires intermédiaires.
+	une expression garde des references vers ses operandes: elle ne doit pas etre stockée au dela de l'instruction qui la crée.
+*/
+
+/// f(0), f(1) ... f(n-1): deroulé par recursion de templates si le noyau a au plus LA_UNROLL elements, sinon simple boucle
+template<size_t n, bool unroll = (n <= LA_UNROLL)>
+struct repeat {
+	template<class F>
+	static inline void apply(const F & f) {
+		repeat<n-1, true>::apply(f);
+		f(n-1);
+	}
+};
+template<size_t n>
+struct repeat<n, false> {
+	template<class F>
+	static inline void apply(const F & f) {
+		for (size_t i=0; i<n; i++)	f(i);
+	}
+};
+template<>
+struct repeat<0, true> {
+	template<class F>
+	static inline void apply(const F &) {}
+};
+
+/// permet d'empecher la deduction d'un parametre template (scalaires de type int ou double a coté d'un S=float)
+template<class T> struct identity { typedef T type; };
+
+/// type scalaire des elements d'une vue, T etant const pour une vue en lecture seule
+template<class T> struct scalar { typedef T type; };
+template<class T> struct scalar<const T> { typedef T type; };
+
+/// les feuilles (Vector, Matrix) sont tenues par reference, les noeuds intermediaires par valeur
+template<class T> struct operand { typedef const T type; };
+template<class S, size_t dim> struct operand<Vector<S,dim> > { typedef const Vector<S,dim> & type; };
+template<class S, size_t rows, size_t cols> struct operand<Matrix<S,rows,cols> > { typedef const Matrix<S,rows,cols> & type; };
+
+#define OPERATION(_NAME_, _OP_) \
+	struct _NAME_ { template<class S> static S apply(const S & a, const S & b) { return a _OP_ b; } };
+OPERATION(op_add, +)
+OPERATION(op_sub, -)
+OPERATION(op_mul, *)
+OPERATION(op_div, /)
+#undef OPERATION
+
+/// base de toute expression vectorielle, E est le type concret (Vector ou noeud)
+template<class S, size_t dim, class E>
+struct VectorExpr {
+	const E & self() const	{ return static_cast<const E &>(*this); }
+	
+	S norm() const {
+		S sum = 0;
+		for (size_t i=0; i<dim; i++)	sum += self()(i)*self()(i);
+		return sqrt(sum);
+	}
+	Vector<S,dim> normalize() const		{ return Vector<S,dim>(*this) / norm(); }
+};
+
+template<class Op, class S, size_t dim, class L, class R>
+struct VectorBinary : public VectorExpr<S, dim, VectorBinary<Op,S,dim,L,R> > {
+	typename operand<L>::type l;
+	typename operand<R>::type r;
+	
+	VectorBinary(const L & l, const R & r) : l(l), r(r) {}
+	S operator()(const size_t i) const	{ return Op::apply(l(i), r(i)); }
+};
+
+/// operation avec un scalaire, a gauche ou a droite de l'expression
+template<class Op, class S, size_t dim, class E, bool left>
+struct VectorScalar : public VectorExpr<S, dim, VectorScalar<Op,S,dim,E,left> > {
+	const S s;
+	typename operand<E>::type e;
 	
+	VectorScalar(const S & s, const E & e) : s(s), e(e) {}
+	S operator()(const size_t i) const	{ return left ? Op::apply(s, e(i)) : Op::apply(e(i), s); }
+};
+
+#define ELEMENTWISE(_OP_, _NAME_) \
+	template<class S, size_t dim, class L, class R> \
+	VectorBinary<_NAME_,S,dim,L,R> operator _OP_ (const VectorExpr<S,dim,L> & l, const VectorExpr<S,dim,R> & r) { \
+		return VectorBinary<_NAME_,S,dim,L,R>(l.self(), r.self()); \
+	}
+	
+	ELEMENTWISE(+, op_add)
+	ELEMENTWISE(-, op_sub)
+	ELEMENTWISE(*, op_mul)
+	ELEMENTWISE(/, op_div)
+#undef ELEMENTWISE
+
+#define WITHSCALAR(_OP_, _NAME_) \
+	template<class S, size_t dim, class E> \
+	VectorScalar<_NAME_,S,dim,E,true> operator _OP_ (const typename identity<S>::type & s, const VectorExpr<S,dim,E> & e) { \
+		return VectorScalar<_NAME_,S,dim,E,true>(s, e.self()); \
+	} \
+	template<class S, size_t dim, class E> \
+	VectorScalar<_NAME_,S,dim,E,false> operator _OP_ (const VectorExpr<S,dim,E> & e, const typename identity<S>::type & s) { \
+		return VectorScalar<_NAME_,S,dim,E,false>(s, e.self()); \
+	}
+	
+	WITHSCALAR(+, op_add)
+	WITHSCALAR(-, op_sub)
+	WITHSCALAR(*, op_mul)
+	WITHSCALAR(/, op_div)
+#undef WITHSCALAR
+
+
 
 template<class S, size_t dim>
-struct Vector {
+struct Vector : public VectorExpr<S, dim, Vector<S,dim> > {
 	S storage[dim];
 	
 public:
@@ -18,9 +138,14 @@ public:
 	Vector(const S v) {
 		for (size_t i=0; i<dim; i++)	storage[i] = v;
 	}
-	Vector(const S * data) {
+	constexpr Vector(const S * data) : storage{} {
 		for (size_t i=0; i<dim; i++)	storage[i] = data[i];
 	}
+	/// depuis un tableau d'un autre type scalaire (constantes calculées en flottant)
+	template<class S2>
+	explicit constexpr Vector(const S2 * data) : storage{} {
+		for (size_t i=0; i<dim; i++)	storage[i] = S(data[i]);
+	}
 	template<size_t dimin> 
 	Vector(const Vector<S,dimin> & data) {
 		size_t n = (dim < dimin)? dim: dimin;
@@ -28,6 +153,16 @@ public:
 		for (i; i<n; i++)		storage[i] = data.storage[i];
 		for (i; i<dim; i++)		storage[i] = 0;
 	}
+	/// conversion depuis un autre type scalaire
+	template<class S2>
+	explicit Vector(const Vector<S2,dim> & data) {
+		for (size_t i=0; i<dim; i++)	storage[i] = S(data.storage[i]);
+	}
+	/// evaluation d'une expression
+	template<class E>
+	Vector(const VectorExpr<S,dim,E> & e) {
+		for (size_t i=0; i<dim; i++)	storage[i] = e.self()(i);
+	}
 	
 	// methodes d'acces
 	size_t ndim() const { return dim; }
@@ -35,53 +170,51 @@ public:
 	S & operator()(const size_t i)				{ return storage[i]; }
 	const S & operator()(const size_t i) const	{ return storage[i]; }
 	
+	/// n elements consecutifs a partir de first, sans copie
+	template<size_t n>
+	VectorView<S,n,1> segment(const size_t first)				{ return VectorView<S,n,1>(storage + first); }
+	template<size_t n>
+	VectorView<const S,n,1> segment(const size_t first) const	{ return VectorView<const S,n,1>(storage + first); }
+	
 	
 	/***** operateurs ******/
 	
-#define ELEMENTWISE(_OP_) \
-	Vector<S,dim> operator _OP_ (const Vector<S,dim> & other) const { \
-		Vector<S,dim> result; \
-		for (size_t i=0; i<dim; i++)	result(i) = storage[i] _OP_ other.storage[i]; \
-		return result; \
+	template<class E>
+	Vector<S,dim> & operator=(const VectorExpr<S,dim,E> & e) {
+		for (size_t i=0; i<dim; i++)	storage[i] = e.self()(i);
+		return *this;
 	}
 	
-	ELEMENTWISE(+)
-	ELEMENTWISE(-)
-	ELEMENTWISE(*)
-	ELEMENTWISE(/)
-#undef ELEMENTWISE
-	
-#define WITHSCALAR(_OP_) \
-	friend Vector<S,dim> operator _OP_ (const S & other, const Vector<S,dim> & vec) { \
-		Vector<S,dim> result; \
-		for (size_t i=0; i<dim; i++)	result(i) = other _OP_ vec(i); \
-		return result; \
+#define INPLACE(_OP_) \
+	template<class E> \
+	Vector<S,dim> & operator _OP_ (const VectorExpr<S,dim,E> & e) { \
+		for (size_t i=0; i<dim; i++)	storage[i] _OP_ e.self()(i); \
+		return *this; \
+	} \
+	Vector<S,dim> & operator _OP_ (const S & s) { \
+		for (size_t i=0; i<dim; i++)	storage[i] _OP_ s; \
+		return *this; \
 	}
 	
-	WITHSCALAR(+)
-	WITHSCALAR(-)
-	WITHSCALAR(*)
-	WITHSCALAR(/)
-#undef WITHSCALAR
-	
-	S norm() const {
-		S sum = 0;
-		for (size_t i=0; i<dim; i++)	sum += storage[i]*storage[i];
-		return sqrt(sum);
-	}
-	Vector<S,dim> normalize() const		{ return (*this)/this->norm(); }
+	INPLACE(+=)
+	INPLACE(-=)
+	INPLACE(*=)
+	INPLACE(/=)
+#undef INPLACE
 };
 
-template<class S, size_t dim>
-S dot(const Vector<S, dim> & a, const Vector<S, dim> & b) {
+template<class S, size_t dim, class A, class B>
+S dot(const VectorExpr<S, dim, A> & a, const VectorExpr<S, dim, B> & b) {
 	S result = 0;
-	for (size_t i=0; i<dim; i++)	result += a(i) * b(i);
+	repeat<dim>::apply([&](size_t i) { result += a.self()(i) * b.self()(i); });
 	return result;
 }
 
-template<class S>
-Vector<S, 3> cross(const Vector<S, 3> & a, const Vector<S, 3> & b) {
-	float v[] = {
+template<class S, class A, class B>
+Vector<S, 3> cross(const VectorExpr<S, 3, A> & ea, const VectorExpr<S, 3, B> & eb) {
+	const A & a = ea.self();
+	const B & b = eb.self();
+	S v[] = {
 		a(1)*b(2)-a(2)*b(1), 
 		a(2)*b(0)-a(0)*b(2),
 		a(0)*b(1)-a(1)*b(0)
@@ -90,20 +223,80 @@ Vector<S, 3> cross(const Vector<S, 3> & a, const Vector<S, 3> & b) {
 }
 
 
+/**
+	vue sur dim elements espacés de stride dans le stockage d'un Vector ou d'une Matrix: segment (stride 1), colonne (stride 1), ligne (stride rows), diagonale (stride rows+1)
+	ne copie rien: les lectures et les affectations vont directement dans le stockage d'origine, qui doit survivre a la vue.
+	T est const pour une vue en lecture seule.
+	comme pour les expressions, l'affectation d'une expression qui lit les elements qu'elle ecrit (m.row(0) = m.col(0)) n'est pas definie.
+*/
+template<class T, size_t dim, size_t stride>
+struct VectorView : public VectorExpr<typename scalar<T>::type, dim, VectorView<T,dim,stride> > {
+	typedef typename scalar<T>::type S;
+	T * data;
+	
+	explicit VectorView(T * data) : data(data) {}
+	/// la copie d'une vue est une vue sur les memes elements, alors que l'affectation copie les elements
+	VectorView(const VectorView &) = default;
+	/// une vue modifiable est aussi une vue en lecture seule
+	operator VectorView<const S,dim,stride> () const	{ return VectorView<const S,dim,stride>(data); }
+	
+	// methodes d'acces
+	size_t ndim() const { return dim; }
+	T & operator()(const size_t i) const	{ return data[i*stride]; }
+	
+	template<size_t n>
+	VectorView<T,n,stride> segment(const size_t first) const	{ return VectorView<T,n,stride>(data + first*stride); }
+	
+	
+	/***** operateurs ******/
+	
+	/// copie des elements, pas de la vue
+	VectorView & operator=(const VectorView & v) {
+		for (size_t i=0; i<dim; i++)	(*this)(i) = v(i);
+		return *this;
+	}
+	template<class E>
+	VectorView & operator=(const VectorExpr<S,dim,E> & e) {
+		for (size_t i=0; i<dim; i++)	(*this)(i) = e.self()(i);
+		return *this;
+	}
+	
+#define INPLACE(_OP_) \
+	template<class E> \
+	VectorView & operator _OP_ (const VectorExpr<S,dim,E> & e) { \
+		for (size_t i=0; i<dim; i++)	(*this)(i) _OP_ e.self()(i); \
+		return *this; \
+	} \
+	VectorView & operator _OP_ (const S & s) { \
+		for (size_t i=0; i<dim; i++)	(*this)(i) _OP_ s; \
+		return *this; \
+	}
+	
+	INPLACE(+=)
+	INPLACE(-=)
+	INPLACE(*=)
+	INPLACE(/=)
+#undef INPLACE
+};
 
+
+
+/// vue de taille connue a l'execution sur une matrice stockée par colonnes, espacées de ld elements (ld = rows pour une matrice entiere, plus pour un bloc)
 template<class S>
 class View {
 public:
 	S * storage;
 	size_t rows;
 	size_t cols;
+	size_t ld;
 	
-	View(S* storage, const size_t rows, const size_t cols) :storage(storage), rows(rows), cols(cols) {}
+	View(S* storage, const size_t rows, const size_t cols, const size_t ld=0) :storage(storage), rows(rows), cols(cols), ld(ld ? ld : rows) {}
 	
-	View<S> & operator()(size_t i)				{ return View(storage + (rows*i), rows, 1); }
-	const View<S> & operator()(size_t i) const	{ return View(storage + (rows*i), rows, 1); }
-	S & operator()(size_t i, size_t j)				{ return *(storage + (rows*i + j)); }
-	const S & operator()(size_t i, size_t j) const	{ return *(storage + (rows*i + j)); }
+	/// colonne j
+	View<S> operator()(size_t j)				{ return View(storage + ld*j, rows, 1, ld); }
+	const View<S> operator()(size_t j) const	{ return View(storage + ld*j, rows, 1, ld); }
+	S & operator()(size_t i, size_t j)				{ return storage[i + ld*j]; }
+	const S & operator()(size_t i, size_t j) const	{ return storage[i + ld*j]; }
 	
 	View<S> & invert(int *err=nullptr) {
 		View<S> & A = *this;
@@ -189,8 +382,94 @@ public:
 
 
 
+/// base de toute expression matricielle, E est le type concret (Matrix ou noeud)
+template<class S, size_t rows, size_t cols, class E>
+struct MatrixExpr {
+	const E & self() const	{ return static_cast<const E &>(*this); }
+};
+
+template<class Op, class S, size_t rows, size_t cols, class L, class R>
+struct MatrixBinary : public MatrixExpr<S, rows, cols, MatrixBinary<Op,S,rows,cols,L,R> > {
+	typename operand<L>::type l;
+	typename operand<R>::type r;
+	
+	MatrixBinary(const L & l, const R & r) : l(l), r(r) {}
+	S operator()(const size_t i, const size_t j) const	{ return Op::apply(l(i,j), r(i,j)); }
+};
+
+template<class Op, class S, size_t rows, size_t cols, class E, bool left>
+struct MatrixScalar : public MatrixExpr<S, rows, cols, MatrixScalar<Op,S,rows,cols,E,left> > {
+	const S s;
+	typename operand<E>::type e;
+	
+	MatrixScalar(const S & s, const E & e) : s(s), e(e) {}
+	S operator()(const size_t i, const size_t j) const	{ return left ? Op::apply(s, e(i,j)) : Op::apply(e(i,j), s); }
+};
+
+/// colonne j d'une expression matricielle, comme expression vectorielle
+template<class S, size_t rows, class E>
+struct MatrixColumn : public VectorExpr<S, rows, MatrixColumn<S,rows,E> > {
+	typename operand<E>::type e;
+	const size_t j;
+	
+	MatrixColumn(const E & e, const size_t j) : e(e), j(j) {}
+	S operator()(const size_t i) const	{ return e(i,j); }
+};
+
+#define ELEMENTWISE(_OP_, _NAME_) \
+	template<class S, size_t rows, size_t cols, class L, class R> \
+	MatrixBinary<_NAME_,S,rows,cols,L,R> operator _OP_ (const MatrixExpr<S,rows,cols,L> & l, const MatrixExpr<S,rows,cols,R> & r) { \
+		return MatrixBinary<_NAME_,S,rows,cols,L,R>(l.self(), r.self()); \
+	}
+	
+	ELEMENTWISE(+, op_add)
+	ELEMENTWISE(-, op_sub)
+#undef ELEMENTWISE
+
+#define WITHSCALAR(_OP_, _NAME_) \
+	template<class S, size_t rows, size_t cols, class E> \
+	MatrixScalar<_NAME_,S,rows,cols,E,true> operator _OP_ (const typename identity<S>::type & s, const MatrixExpr<S,rows,cols,E> & e) { \
+		return MatrixScalar<_NAME_,S,rows,cols,E,true>(s, e.self()); \
+	} \
+	template<class S, size_t rows, size_t cols, class E> \
+	MatrixScalar<_NAME_,S,rows,cols,E,false> operator _OP_ (const MatrixExpr<S,rows,cols,E> & e, const typename identity<S>::type & s) { \
+		return MatrixScalar<_NAME_,S,rows,cols,E,false>(s, e.self()); \
+	}
+	
+	WITHSCALAR(+, op_add)
+	WITHSCALAR(-, op_sub)
+	WITHSCALAR(*, op_mul)
+	WITHSCALAR(/, op_div)
+#undef WITHSCALAR
+
+
+
+/// produit matrice-vecteur, evalué: chaque element des operandes n'est lu qu'une fois par ligne
+template<class S, size_t rows, size_t cols, class M, class V>
+Vector<S, rows> operator*(const MatrixExpr<S,rows,cols,M> & em, const VectorExpr<S,cols,V> & ev) {
+	const M & m = em.self();
+	const V & vec = ev.self();
+	Vector<S, rows> result;
+	repeat<rows, rows*cols <= LA_UNROLL>::apply([&](size_t i) {
+		S sum = 0.;
+		repeat<cols, rows*cols <= LA_UNROLL>::apply([&](size_t k) { sum += m(i,k) * vec(k); });
+		result(i) = sum;
+	});
+	return result;
+}
+
+template<class S, size_t rows, size_t cols, size_t ocols, class L, class R>
+Matrix<S, rows, ocols> operator*(const MatrixExpr<S,rows,cols,L> & l, const MatrixExpr<S,cols,ocols,R> & r) {
+	Matrix<S, rows, ocols> result;
+	// les colonnes restent une boucle: chaque produit matrice-vecteur est deja deroulé si la taille le permet
+	for (size_t j=0; j<ocols; j++)		result.col(j) = l * MatrixColumn<S,cols,R>(r.self(), j);
+	return result;
+}
+
+
+
 template <class S, size_t rows, size_t cols>
-struct Matrix {
+struct Matrix : public MatrixExpr<S, rows, cols, Matrix<S,rows,cols> > {
 	S storage[rows*cols];
 	
 public:
@@ -201,7 +480,7 @@ public:
 	}
 	Matrix(const Vector<S,rows> data[cols]) {
 		for (size_t j=0; j<cols; j++)	{
-			for (size_t i=0; i<rows; i++)	(*this)(i,j) = data[i];
+			for (size_t i=0; i<rows; i++)	(*this)(i,j) = data[j](i);
 		}
 	}
 	Matrix(const S * data) {
@@ -209,6 +488,12 @@ public:
 			for (size_t i=0; i<rows; i++)	(*this)(i,j) = data[i*cols + j];
 		}
 	}
+	/// evaluation d'une expression
+	template<class E>
+	Matrix(const MatrixExpr<S,rows,cols,E> & e) {
+		for (size_t j=0; j<cols; j++)
+			for (size_t i=0; i<rows; i++)	(*this)(i,j) = e.self()(i,j);
+	}
 	
 	static Matrix<S,rows,cols> identity() {
 		Matrix<S,rows,cols> result(0.);
@@ -225,76 +510,56 @@ public:
 	S & operator()(const size_t r, const size_t c)	{ return storage[r + rows*c]; }
 	const S & operator()(const size_t r, const size_t c) const	{ return storage[r + rows*c]; }
 	
-	Vector<S, rows> & col(const size_t c) 				{ return * ((Vector<S,rows>*) (storage + (c*rows))); }
-	const Vector<S, rows> & col(const size_t c) const 	{ return * ((const Vector<S,rows>*) (storage + (c*rows))); }
-	Vector<S, rows> row(const size_t r) const { 
-		Vector<S, rows> result;
-		for (size_t i=0; i<cols; i++)	result[i] = (*this)(r,i);
-		return result;
-	}
+	// vues sans copie sur le stockage (voir VectorView et MatrixView)
+	VectorView<S,rows,1> col(const size_t c)				{ return VectorView<S,rows,1>(storage + c*rows); }
+	VectorView<const S,rows,1> col(const size_t c) const	{ return VectorView<const S,rows,1>(storage + c*rows); }
+	VectorView<S,cols,rows> row(const size_t r)				{ return VectorView<S,cols,rows>(storage + r); }
+	VectorView<const S,cols,rows> row(const size_t r) const	{ return VectorView<const S,cols,rows>(storage + r); }
+	VectorView<S,(rows<cols ? rows:cols),rows+1> diagonal()				{ return VectorView<S,(rows<cols ? rows:cols),rows+1>(storage); }
+	VectorView<const S,(rows<cols ? rows:cols),rows+1> diagonal() const	{ return VectorView<const S,(rows<cols ? rows:cols),rows+1>(storage); }
+	/// bloc de brows x bcols elements dont le coin superieur gauche est (r,c)
+	template<size_t brows, size_t bcols>
+	MatrixView<S,brows,bcols,rows> block(const size_t r, const size_t c)				{ return MatrixView<S,brows,bcols,rows>(storage + r + rows*c); }
+	template<size_t brows, size_t bcols>
+	MatrixView<const S,brows,bcols,rows> block(const size_t r, const size_t c) const	{ return MatrixView<const S,brows,bcols,rows>(storage + r + rows*c); }
 	
 	
 	/***** operateurs ******/
 	
-	Vector<S, rows> operator*(const Vector<S, cols> & vec) const {
-		Vector<S, rows> result;
-		for (size_t i=0; i<rows; i++) {
-			result(i) = 0.;
-			for (size_t k=0; k<cols; k++)	result(i) += (*this)(i,k) * vec(k);
-		}
-		return result;
-	}
-	
-	template<size_t ocols>
-	Matrix<S, rows, ocols> operator*(const Matrix<S, cols, ocols> & other) const {
-		Matrix<S, rows, ocols> result;
-		for (size_t j=0; j<ocols; j++)		result.col(j) = (*this) * other.col(j);
-		return result;
+	template<class E>
+	Matrix<S,rows,cols> & operator=(const MatrixExpr<S,rows,cols,E> & e) {
+		for (size_t j=0; j<cols; j++)
+			for (size_t i=0; i<rows; i++)	(*this)(i,j) = e.self()(i,j);
+		return *this;
 	}
 	
-#define ELEMENTWISE(_OP_) \
-	Matrix<S, rows, cols> operator _OP_ (const Matrix<S, rows, cols> & other) const { \
-		Matrix<S, rows, cols> result; \
-		for (size_t i=0; i<rows; i++) { \
-			for (size_t j=0; j<cols; j++) \
-				result(i,j) = (*this)(i,j) _OP_ other(i,j); \
-		} \
-		return result; \
+#define INPLACE(_OP_) \
+	template<class E> \
+	Matrix<S,rows,cols> & operator _OP_ (const MatrixExpr<S,rows,cols,E> & e) { \
+		for (size_t j=0; j<cols; j++) \
+			for (size_t i=0; i<rows; i++)	(*this)(i,j) _OP_ e.self()(i,j); \
+		return *this; \
 	}
 	
-	ELEMENTWISE(+)
-	ELEMENTWISE(-)
-#undef ELEMENTWISE
+	INPLACE(+=)
+	INPLACE(-=)
+#undef INPLACE
 
-#define WITHSCALAR(_OP_) \
-	friend Matrix<S, rows, cols> operator _OP_ (const S & other, const Matrix<S, rows, cols> & mat) { \
-		Matrix<S, rows, cols> result; \
-		for (size_t i=0; i<rows; i++) { \
-			for (size_t j=0; j<cols; j++) \
-				result(i,j) = other _OP_ mat(i,j); \
-		} \
-		return result; \
-	}
-	/*
-	Matrix<S, rows, cols> & operator _OP_= (const S & other) { \
-		for (size_t i=0; i<rows; i++) { \
-			for (size_t j=0; j<cols; j++) \
-				(*this) _OP_= mat(i,j); \
-		} \
+#define INPLACE(_OP_) \
+	Matrix<S,rows,cols> & operator _OP_ (const S & s) { \
+		for (size_t i=0; i<rows*cols; i++)	storage[i] _OP_ s; \
 		return *this; \
 	}
-	*/
-	WITHSCALAR(+)
-	WITHSCALAR(-)
-	WITHSCALAR(*)
-	WITHSCALAR(/)
-#undef ELEMENTWISE
+	
+	INPLACE(*=)
+	INPLACE(/=)
+#undef INPLACE
 	
 	Matrix<S,cols,rows> transpose() const {
 		Matrix<S,cols,rows> result;
-		for (size_t i=0; i<rows; i++)
-			for (size_t j=0; j<cols; j++)
-				result(j,i) = (*this)(i,j);
+		repeat<rows, rows*cols <= LA_UNROLL>::apply([&](size_t i) {
+			repeat<cols, rows*cols <= LA_UNROLL>::apply([&](size_t j) { result(j,i) = (*this)(i,j); });
+		});
 		return result;
 	}
 	
@@ -306,6 +571,269 @@ public:
 };
 
 
+/**
+	vue sur un bloc de rows x cols elements d'une Matrix (ou d'une autre vue), dont les colonnes sont espacées de ld elements
+	memes regles que VectorView: aucune copie, T const pour une vue en lecture seule
+*/
+template<class T, size_t rows, size_t cols, size_t ld>
+struct MatrixView : public MatrixExpr<typename scalar<T>::type, rows, cols, MatrixView<T,rows,cols,ld> > {
+	typedef typename scalar<T>::type S;
+	T * data;
+	
+	explicit MatrixView(T * data) : data(data) {}
+	/// la copie d'une vue est une vue sur les memes elements, alors que l'affectation copie les elements
+	MatrixView(const MatrixView &) = default;
+	operator MatrixView<const S,rows,cols,ld> () const	{ return MatrixView<const S,rows,cols,ld>(data); }
+	
+	// methodes d'acces
+	size_t nrows() const { return rows; }
+	size_t ncols() const { return cols; }
+	T & operator()(const size_t r, const size_t c) const	{ return data[r + ld*c]; }
+	
+	VectorView<T,rows,1> col(const size_t c) const		{ return VectorView<T,rows,1>(data + ld*c); }
+	VectorView<T,cols,ld> row(const size_t r) const		{ return VectorView<T,cols,ld>(data + r); }
+	VectorView<T,(rows<cols ? rows:cols),ld+1> diagonal() const	{ return VectorView<T,(rows<cols ? rows:cols),ld+1>(data); }
+	template<size_t brows, size_t bcols>
+	MatrixView<T,brows,bcols,ld> block(const size_t r, const size_t c) const	{ return MatrixView<T,brows,bcols,ld>(data + r + ld*c); }
+	
+	
+	/***** operateurs ******/
+	
+	/// copie des elements, pas de la vue
+	MatrixView & operator=(const MatrixView & m) {
+		for (size_t j=0; j<cols; j++)
+			for (size_t i=0; i<rows; i++)	(*this)(i,j) = m(i,j);
+		return *this;
+	}
+	template<class E>
+	MatrixView & operator=(const MatrixExpr<S,rows,cols,E> & e) {
+		for (size_t j=0; j<cols; j++)
+			for (size_t i=0; i<rows; i++)	(*this)(i,j) = e.self()(i,j);
+		return *this;
+	}
+	
+#define INPLACE(_OP_) \
+	template<class E> \
+	MatrixView & operator _OP_ (const MatrixExpr<S,rows,cols,E> & e) { \
+		for (size_t j=0; j<cols; j++) \
+			for (size_t i=0; i<rows; i++)	(*this)(i,j) _OP_ e.self()(i,j); \
+		return *this; \
+	}
+	
+	INPLACE(+=)
+	INPLACE(-=)
+#undef INPLACE
+
+#define INPLACE(_OP_) \
+	MatrixView & operator _OP_ (const S & s) { \
+		for (size_t j=0; j<cols; j++) \
+			for (size_t i=0; i<rows; i++)	(*this)(i,j) _OP_ s; \
+		return *this; \
+	}
+	
+	INPLACE(*=)
+	INPLACE(/=)
+#undef INPLACE
+	
+	/// inversion du bloc en place, le reste de la matrice n'est pas touché
+	MatrixView & invert(int *err=nullptr) {
+		View<S>(data, rows, cols, ld).invert(err);
+		return *this;
+	}
+};
+
+
+/**
+	factorisation LU avec pivot partiel d'une matrice carrée:  P A = L U
+	permet de resoudre A x = b ou A^T x = b sans jamais calculer l'inverse de A
+*/
+template <class S, size_t dim>
+struct LU {
+	Matrix<S,dim,dim> lu;	// L (diagonale unitaire implicite) et U dans la meme matrice
+	size_t perm[dim];		// ligne de A correspondant a chaque ligne de lu
+	int sign;				// signe de la permutation
+	S anorm;				// norme 1 de A, pour l'estimation du conditionnement
+	int err;				// 0 si la factorisation a reussi, 1 si A est singuliere
+	
+	LU() {}
+	template<class E>
+	LU(const MatrixExpr<S,dim,dim,E> & a)	{ factorize(a); }
+	
+	/// a peut etre une expression ou un bloc d'une plus grande matrice: il est lu une seule fois
+	template<class E>
+	int factorize(const MatrixExpr<S,dim,dim,E> & a) {
+		lu = a;
+		sign = 1;
+		err = 0;
+		anorm = 0;
+		for (size_t j=0; j<dim; j++) {
+			S sum = 0;
+			for (size_t i=0; i<dim; i++)	sum += fabs(lu(i,j));
+			if (sum > anorm)	anorm = sum;
+		}
+		for (size_t i=0; i<dim; i++)	perm[i] = i;
+		
+		for (size_t k=0; k<dim; k++) {
+			// pivot: plus grand element de la colonne
+			size_t pivrow = k;
+			for (size_t i=k+1; i<dim; i++)
+				if (fabs(lu(i,k)) > fabs(lu(pivrow,k)))		pivrow = i;
+			if (lu(pivrow,k) == S(0)) {
+				err = 1;
+				return err;
+			}
+			if (pivrow != k) {
+				for (size_t j=0; j<dim; j++) {
+					S tmp = lu(k,j);
+					lu(k,j) = lu(pivrow,j);
+					lu(pivrow,j) = tmp;
+				}
+				size_t tmp = perm[k];
+				perm[k] = perm[pivrow];
+				perm[pivrow] = tmp;
+				sign = -sign;
+			}
+			// elimination sous le pivot
+			for (size_t i=k+1; i<dim; i++) {
+				lu(i,k) = lu(i,k) / lu(k,k);
+				for (size_t j=k+1; j<dim; j++)	lu(i,j) = lu(i,j) - lu(i,k) * lu(k,j);
+			}
+		}
+		return err;
+	}
+	
+	/// solution de A x = b
+	Vector<S,dim> solve(const Vector<S,dim> & b) const {
+		Vector<S,dim> x;
+		for (size_t i=0; i<dim; i++) {
+			S sum = b(perm[i]);
+			for (size_t j=0; j<i; j++)	sum = sum - lu(i,j) * x(j);
+			x(i) = sum;
+		}
+		for (size_t i=dim; i-- > 0;) {
+			S sum = x(i);
+			for (size_t j=i+1; j<dim; j++)	sum = sum - lu(i,j) * x(j);
+			x(i) = sum / lu(i,i);
+		}
+		return x;
+	}
+	
+	/// solution de A^T x = b
+	Vector<S,dim> solve_transpose(const Vector<S,dim> & b) const {
+		Vector<S,dim> y, x;
+		for (size_t i=0; i<dim; i++) {
+			S sum = b(i);
+			for (size_t j=0; j<i; j++)	sum = sum - lu(j,i) * y(j);
+			y(i) = sum / lu(i,i);
+		}
+		for (size_t i=dim; i-- > 0;) {
+			S sum = y(i);
+			for (size_t j=i+1; j<dim; j++)	sum = sum - lu(j,i) * y(j);
+			y(i) = sum;
+		}
+		for (size_t i=0; i<dim; i++)	x(perm[i]) = y(i);
+		return x;
+	}
+	
+	S determinant() const {
+		if (err)	return 0;
+		S det = sign;
+		for (size_t i=0; i<dim; i++)	det = det * lu(i,i);
+		return det;
+	}
+	
+	/// estimation de l'inverse du conditionnement en norme 1 (methode de Hager), 0 pour une matrice singuliere
+	S rcond() const {
+		if (err)	return 0;
+		Vector<S,dim> x(S(1) / S(dim));
+		S estimate = 0;
+		for (int iter=0; iter<5; iter++) {
+			Vector<S,dim> y = solve(x);
+			Vector<S,dim> xi;
+			estimate = 0;
+			for (size_t i=0; i<dim; i++) {
+				estimate += fabs(y(i));
+				xi(i) = y(i) < S(0) ? S(-1) : S(1);
+			}
+			Vector<S,dim> z = solve_transpose(xi);
+			size_t jmax = 0;
+			S ztx = 0;
+			for (size_t i=0; i<dim; i++) {
+				ztx += z(i) * x(i);
+				if (fabs(z(i)) > fabs(z(jmax)))		jmax = i;
+			}
+			if (fabs(z(jmax)) <= ztx)	break;
+			x = Vector<S,dim>(S(0));
+			x(jmax) = 1;
+		}
+		return S(1) / (anorm * estimate);
+	}
+};
+
+
+/**
+	factorisation LDL^T d'une matrice symetrique definie positive: A = L D L^T, L triangulaire inferieure a diagonale unitaire
+	sans racine carrée (utilisable en virgule fixe), deux fois moins d'operations que LU, et sans pivot.
+	seul le triangle inferieur de A est lu.
+*/
+template <class S, size_t dim>
+struct LDLT {
+	Matrix<S,dim,dim> ld;	// L sous la diagonale (diagonale unitaire implicite), D sur la diagonale
+	int err;				// 0 si la factorisation a reussi, 1 si A n'est pas definie positive
+	
+	LDLT() {}
+	template<class E>
+	LDLT(const MatrixExpr<S,dim,dim,E> & a)	{ factorize(a); }
+	
+	template<class E>
+	int factorize(const MatrixExpr<S,dim,dim,E> & a) {
+		ld = a;
+		return factorize();
+	}
+	/// factorise ld en place
+	int factorize() {
+		err = 0;
+		for (size_t j=0; j<dim; j++) {
+			// la ligne j contient L(j,k) D(k), calculés aux colonnes precedentes:  D(j) = A(j,j) - sum L(j,k) D(k) L(j,k)
+			S d = ld(j,j);
+			for (size_t k=0; k<j; k++) {
+				S ldk = ld(j,k);
+				ld(j,k) = ldk / ld(k,k);
+				d = d - ld(j,k) * ldk;
+			}
+			if (!(d > S(0))) {
+				err = 1;
+				return err;
+			}
+			ld(j,j) = d;
+			// L(i,j) D(j) = A(i,j) - sum L(i,k) D(k) L(j,k), divisé par D(j) quand la ligne i sera traitée
+			for (size_t i=j+1; i<dim; i++) {
+				S sum = ld(i,j);
+				for (size_t k=0; k<j; k++)	sum = sum - ld(i,k) * ld(j,k);
+				ld(i,j) = sum;
+			}
+		}
+		return err;
+	}
+	
+	/// solution de A x = b
+	Vector<S,dim> solve(const Vector<S,dim> & b) const {
+		Vector<S,dim> x;
+		for (size_t i=0; i<dim; i++) {
+			S sum = b(i);
+			for (size_t j=0; j<i; j++)	sum = sum - ld(i,j) * x(j);
+			x(i) = sum;
+		}
+		for (size_t i=0; i<dim; i++)	x(i) = x(i) / ld(i,i);
+		for (size_t i=dim; i-- > 0;) {
+			S sum = x(i);
+			for (size_t j=i+1; j<dim; j++)	sum = sum - ld(j,i) * x(j);
+			x(i) = sum;
+		}
+		return x;
+	}
+};
+
 // definitions pratiques
 typedef Vector<float, 2> vec2;
 typedef Vector<float, 3> vec3;
@@ -336,5 +864,24 @@ inline vec4 vec(const float x, const float y, const float z, const float a) {
 	return r;
 }
 
+/// memes constructeurs pour n'importe quel type scalaire, a appeler explicitement:  vec<S>(x, y, z)
+template<class S>
+Vector<S,3> vec(const typename identity<S>::type x, const typename identity<S>::type y, const typename identity<S>::type z) {
+	Vector<S,3> r;
+	r(0) = x;
+	r(1) = y;
+	r(2) = z;
+	return r;
+}
+template<class S>
+Vector<S,4> vec(const typename identity<S>::type x, const typename identity<S>::type y, const typename identity<S>::type z, const typename identity<S>::type a) {
+	Vector<S,4> r;
+	r(0) = x;
+	r(1) = y;
+	r(2) = z;
+	r(3) = a;
+	return r;
+}
+
 };
 #endif
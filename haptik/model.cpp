@@ -1,231 +1,382 @@
 #include "model.h"
 #include "linalg.h"
+#include "fixed.h"
+#include "dual.h"
+#include "seeds.h"
 #include <math.h>
-#include <string.h>
 using namespace la;
 
 
-Delta::Delta() {
-	ra = 39;	// (mm) angle de placement des rotules sur la plateforme
-	rb = 125;	// (mm) angle de placement des pivotes des moteurs
-	R = 222; // (mm) longueur de tringle (tube noir)
-	l = 77; // (mm) longueur de levier des servo
-	const float phia_base = deg2rad(23.19);
-	const float phib_base = deg2rad(12.225);
-	float phia[N] = {
-		phia_base,
-		pi/2 - phia_base,
-		pi/2 + phia_base,
-		pi - phia_base,
-		pi + phia_base,
-		3*pi/2 - phia_base,
-		3*pi/2 + phia_base,
-		-phia_base
-	};
-	float phib[N] = {
-		phib_base,
-		pi/2 - phib_base,
-		pi/2 + phib_base,
-		pi - phib_base,
-		pi + phib_base,
-		3*pi/2 - phib_base,
-		3*pi/2 + phib_base,
-		-phib_base
-	};
+template <class S>
+typename BasicDelta<S>::state BasicDelta<S>::mgi(const vec8 &X) const {
+	return mgi_eval(X);
+}
+
+template <class S>
+typename BasicDelta<S>::state BasicDelta<S>::mgi(const vec8 &X, mat8 &dqdX) const {
+	// chaque composante de X porte sa propre direction de derivation
+	typedef la::Dual<S,N> D;
+	la::Vector<D,N> Xd;
+	for (size_t i=0; i<N; i++)	Xd(i) = D::variable(X(i), i);
+	typename BasicDelta<D>::state sd = mgi_eval(Xd);
+	
+	state results;
+	results.X = X;
 	for (size_t i=0; i<N; i++) {
-		RgA[i] = rotz(phia[i]) * vec(ra, 0, 0, 1);
-		b[i] = vec3(rotz(phib[i]) * vec(rb, 0, 0, 1));
+		results.q(i) = sd.q(i).v;
+		for (size_t j=0; j<N; j++)		dqdX(i,j) = sd.q(i).d[j];
+		for (size_t k=0; k<3; k++) {
+			results.c[i](k) = sd.c[i](k).v;
+			results.a[i](k) = sd.a[i](k).v;
+		}
 	}
-
-	float dirs[] = {
-		0,-1,0,
-		1,0,0,
-		1,0,0,
-		0,1,0,
-		0,1,0,
-		-1,0,0,
-		-1,0,0,
-		0,-1,0
-	};
-	memcpy(axis, dirs, N*3*sizeof(float));
+	for (size_t i=0; i<4; i++)
+		for (size_t j=0; j<4; j++)	results.bRe(i,j) = sd.bRe(i,j).v;
+	return results;
 }
 
-Delta::state Delta::mgi(const vec8 &X) {
-	mat4 bRe = quat2mat(vec2quat( *((vec3*) &X(3)) ));
-    bRe(0,3) = X(0);
-    bRe(1,3) = X(1);
-    bRe(2,3) = X(2);
-	mat4 eRrg = quat2mat(vec2quat(vec(X(6), X(7), 0)));
-	mat4 eRrd = quat2mat(vec2quat(vec(-X(6), -X(7), 0)));
+template <class S>
+template <class T>
+typename BasicDelta<T>::state BasicDelta<S>::mgi_eval(const la::Vector<T,N> &X) const {
+	typedef la::Vector<T,3> tvec3;
+	typedef la::Vector<T,4> tvec4;
+	typedef la::Matrix<T,4,4> tmat4;
 	
-	mat4 matg = bRe*eRrg;
-	mat4 matd = bRe*eRrd;
+	tmat4 bRe = quat2mat(vec2quat(tvec3(X.template segment<3>(3))));
+	bRe.col(3).template segment<3>(0) = X.template segment<3>(0);
+	tmat4 eRrg = quat2mat(vec2quat(vec<T>(X(6), X(7), 0)));
+	tmat4 eRrd = quat2mat(vec2quat(vec<T>(-X(6), -X(7), 0)));
+	
+	tmat4 matg = bRe*eRrg;
+	tmat4 matd = bRe*eRrd;
 
-	state results;
+	typename BasicDelta<T>::state results;
 	results.X = X;
 	results.bRe = bRe;
-	vec8 &q = results.q;
-	vec3 *c = results.c;
-	vec3 *a = results.a;
+	la::Vector<T,N> &q = results.q;
+	tvec3 *c = results.c;
+	tvec3 *a = results.a;
 	
-	for (size_t i=0; i<4; i++) 		a[i] = matg * RgA[i];
-	for (size_t i=4; i<8; i++) 		a[i] = matd * RgA[i];
+	for (size_t i=0; i<4; i++) 		a[i] = tvec3(matg * tvec4(RgA[i]));
+	for (size_t i=4; i<8; i++) 		a[i] = tvec3(matd * tvec4(RgA[i]));
 	
-	// indices des a[i] a utiliser selon le plan
-	size_t v1[] = {0, 3, 4, 7};
-	size_t v2[] = {1, 2, 5, 6};
+	// plan de chaque jambe: les jambes 0,3,4,7 sont dans un plan y = cste (axe horizontal x), les autres dans un plan x = cste
+	const size_t horizontal[] = {0, 1, 1, 0, 0, 1, 1, 0};
 	
-	for (size_t i=0; i<4; i++) {
-		{ // intersections dans un plan x = a
-			size_t i1 = v1[i];
-			float x1,x2,z2;
-
-			vec3 S = a[i1];	// coord centre sphere
-			vec3 K = vec(S(0), b[i1](1), S(2));	// coord projection de S sur le plan
-			float sk = (S-K).norm();
-            
-			if (fabs(sk) < R) {
-				if ((l+R) >= (b[i1] - K).norm()) {
-					// calcul solutions intersections de deux cercles dans le meme plan
-					float L = sqrt(sq(R) - sq(sk));
-					float A = b[i1](2) - K(2);
-					float B = b[i1](0) - K(0);
-					float a = 2*A;
-					float b = 2*B;
-					float c = sq(A) + sq(B) - sq(l) + sq(L);
-					float delta = sq(2*a*c) - 4*(sq(a) + sq(b))*(sq(c) - sq(b)*sq(L));
-					z2 = (2*a*c + sqrt(delta)) / (2*(sq(a)+sq(b))) + K(2);
-					// calcul x1 et x2
-					if (b != 0) 	x2 = (c-a*(z2-K(2)))/b + K(0);
-					else 			x2 = b/2 - sqrt(sq(l) - sq((2*c - sq(a))/(2*a)) ) + K(0); // erreur
-				}
-				// pas de solution
-				else { /* TODO */ }
-			}
-			// 1 ou 0 solution
-			else { /* TODO */ }
-			
-			c[i1] = vec(x2, b[i1](1), z2);
-			q(i1) = atan(z2 / fabs(x2-b[i1](0)));
-		}
+	for (size_t i=0; i<N; i++) {
+		size_t h = horizontal[i];	// axe horizontal du plan
+		size_t f = 1-h;				// axe normal au plan
+		T h2, z2;
 		
-		{ // intersections dans un plan y = a
-			size_t i2 = v2[i];
-			float y1,y2,z2;
-			
-			vec3 S = a[i2];	// coord centre sphere
-			vec3 K = vec(b[i2](0), S(1), S(2));	// coord projection de S sur le plan
-			float sk = (S-K).norm();
-			if (fabs(sk) < R) {
-				if ((l+R) >= (b[i2] - K).norm()) {
-					// calcul solutions intersections de deux cercles dans le meme plan
-					float L = sqrt(sq(R) - sq(sk));
-					float A = b[i2](2) - K(2);
-					float B = b[i2](1) - K(1);
-					float a = 2*A;
-					float b = 2*B;
-					float c = sq(A) + sq(B) - sq(l) + sq(L);
-					float delta = sq(2*a*c) - 4*(sq(a) + sq(b))*(sq(c) - sq(b)*sq(L));
-					z2 = (2*a*c + sqrt(delta)) / (2*(sq(a)+sq(b))) + K(2);
-					// calcul x1 et x2
-					if (b != 0) 	y2 = (c-a*(z2-K(2)))/b + K(1);
-					else			y2 = b/2 - sqrt(sq(l) - sq((2*c - sq(a))/(2*a)) ) + K(1);
-				}
-				// pas de solution
-				else { /* TODO */ }
-			}
-			// 1 ou 0 solution
-			else { /* TODO */ }
-			
-			c[i2] = vec(b[i2](0), y2, z2);
-			q(i2) = atan(z2 / fabs(y2-b[i2](1)));
-		}
+		tvec3 Sc = a[i];	// coord centre sphere
+		// la sphere de rayon R coupe le plan du levier selon un cercle de centre K (projection de S) et de rayon L
+		T L2 = sq(R) - sq(Sc(f) - b[i](f));
+		T B = b[i](h) - Sc(h);
+		T A = b[i](2) - Sc(2);
+		T d = kin::sqrt(sq(A) + sq(B));	// distance entre K et le pivot du levier
+		
+		// intersection des deux cercles: m est la distance de K au milieu de la corde, hc la demi-corde
+		// cette forme ne fait intervenir que des carrés de longueurs, ce qui la rend utilisable en virgule fixe
+		// pas de solution si L2 < 0 (la sphere ne coupe pas le plan) ou si hc n'est pas reel (cercles disjoints)
+		T m = (sq(d) + L2 - sq(l)) / (2*d);
+		T hc = kin::sqrt(L2 - sq(m));
+		T sign = (B < T(0))? -1: 1;
+		z2 = (A*m + fabs(B)*hc) / d + Sc(2);
+		h2 = (B*m - sign*A*hc) / d + Sc(h);
+		
+		c[i](h) = h2;
+		c[i](f) = b[i](f);
+		c[i](2) = z2;
+		q(i) = kin::atan2(z2, fabs(h2-b[i](h)));
 	}
 	
 	return results;
 }
 
-mat8 Delta::mci(const Delta::state &state) {
+/// jacobienne du vecteur rotation v (voir vec2quat) vers la vitesse angulaire, dans le repere ou tourne la rotation:
+/// omega = J(v) dv,  J(v) = I + a [v]x + b [v]x^2,  et J(v)^T = J(-v) (memes coefficients)
+template <class S>
+struct RotationRate {
+	S a, b;
+	RotationRate(const la::Vector<S,3> &v) {
+		S angle2 = dot(v, v);
+		// developpement limité jusqu'a 0.7 rad, au dela des rotations de l'espace de travail: exact a la precision des float
+		// (reste en angle^8 sous 2e-8), sans trigonometrie ni division par un angle quasi-nul
+		if (angle2 < S(0.5)) {
+			S angle4 = angle2*angle2;
+			a = S(0.5) - angle2/24 + angle4/720 - angle4*angle2/40320;
+			b = S(1)/6 - angle2/120 + angle4/5040 - angle4*angle2/362880;
+		}
+		else {
+			S angle = kin::sqrt(angle2);
+			a = (1 - kin::cos(angle)) / angle2;
+			b = (angle - kin::sin(angle)) / (angle2*angle);
+		}
+	}
+	/// J(v) w
+	la::Vector<S,3> apply(const la::Vector<S,3> &v, const la::Vector<S,3> &w) const {
+		la::Vector<S,3> vw = cross(v, w);
+		return w + a*vw + b*cross(v, vw);
+	}
+};
+
+/// lignes de Jgt^T et diagonale Jd, communes a mci_factor et mgi_jacobian
+template <class S>
+static void jacobian_rows(const BasicDelta<S> &model, const typename BasicDelta<S>::state &state, typename BasicDelta<S>::mat8 &Jg, typename BasicDelta<S>::vec8 &Jd) {
+	typedef typename BasicDelta<S>::vec3 vec3;
 	const vec3 *c = state.c;
 	const vec3 *a = state.a;
-	const mat4 &bRe = state.bRe;
-    
-	mat8 Jgt;
-	vec8 Jd;
+	const typename BasicDelta<S>::mat4 &bRe = state.bRe;
 	
-	vec3 vecxp = vec3(bRe.col(0));
-	vec3 vecyp = vec3(bRe.col(1));
+	// axes et centre de la plateforme lus directement dans bRe, les moments sont pris au centre
+	vec3 axes[3] = {bRe.col(0).template segment<3>(0), bRe.col(1).template segment<3>(0), bRe.col(2).template segment<3>(0)};
+	auto p = bRe.col(3).template segment<3>(0);
+	// X3..X5 et X6,X7 sont des vecteurs rotation: leurs derivées ne sont des vitesses angulaires qu'a travers RotationRate
+	// rotation de la plateforme: colonnes J(r)^T (pa x ac);  sous-plateformes (s a gauche, -s a droite): axes bRe J(+-s) e
+	vec3 minus_r = S(-1) * vec3(state.X.template segment<3>(3));
+	RotationRate<S> platform(minus_r);
+	vec3 sub_axes[2][2];
+	vec3 s = la::vec<S>(state.X(6), state.X(7), S(0));
+	RotationRate<S> sub(s);
+	for (size_t side=0; side<2; side++) {
+		if (side)	s = S(-1) * s;
+		for (size_t k=0; k<2; k++) {
+			vec3 u = sub.apply(s, la::vec<S>(S(k==0), S(k==1), S(0)));
+			sub_axes[side][k] = u(0)*axes[0] + u(1)*axes[1] + u(2)*axes[2];
+		}
+	}
 	for (size_t i=0; i<N; i++) {		
 		vec3 ac = c[i] - a[i];
-		vec3 oa_ac = cross(a[i], ac);
-		vec3 crossxp = cross(vecxp, a[i]);
-		vec3 crossyp = cross(vecyp, a[i]);
-		float line[] = {
-			ac(0), ac(1), ac(2),
-			oa_ac(0), oa_ac(1), oa_ac(2), 
-			dot(ac, crossyp) * ((i>3)?-1:1),
-			dot(ac, crossxp) * ((i>3)?-1:1)
-		};
-		Jgt.col(i) = line;
+		vec3 pa = a[i] - p;
+		auto line = Jg.row(i);
+		line.template segment<3>(0) = ac;
+		line.template segment<3>(3) = platform.apply(minus_r, cross(pa, ac));
+		line(6) = dot(ac, cross(sub_axes[i>3][0], pa)) * ((i>3)?-1:1);
+		line(7) = dot(ac, cross(sub_axes[i>3][1], pa)) * ((i>3)?-1:1);
 	}
 	
-	for (size_t i=0; i<N; i++) 		Jd(i) = dot(c[i]-a[i], cross(axis[i], c[i]));
+	for (size_t i=0; i<N; i++) 		Jd(i) = dot(c[i]-a[i], cross(model.axis[i], c[i]-model.b[i]));	// le levier tourne autour de son pivot b
+}
 
-    mat8 J = Jgt.transpose().inverse();
-	for (size_t i=0; i<N; i++)		J.col(i) = J.col(i) * Jd(i);
+template <class S>
+typename BasicDelta<S>::jacobian BasicDelta<S>::mci_factor(const state &state) const {
+	mat8 Jg;	// Jgt^T, construite directement par lignes
+	jacobian J;
+	jacobian_rows(*this, state, Jg, J.Jd);
+	J.lu.factorize(Jg);
+	return J;
+}
+
+template <class S>
+typename BasicDelta<S>::mat8 BasicDelta<S>::mgi_jacobian(const state &state) const {
+	// J = Jg^-1 diag(Jd)  donc  J^-1 = diag(Jd)^-1 Jg
+	mat8 Jg;
+	vec8 Jd;
+	jacobian_rows(*this, state, Jg, Jd);
+	for (size_t i=0; i<N; i++)	Jg.row(i) /= Jd(i);
+	return Jg;
+}
+
+template <class S>
+typename BasicDelta<S>::vec8 BasicDelta<S>::jacobian::apply(const vec8 &v) const {
+	return lu.solve(Jd * v);
+}
 
+template <class S>
+typename BasicDelta<S>::vec8 BasicDelta<S>::jacobian::apply_transpose(const vec8 &v) const {
+	return Jd * lu.solve_transpose(v);
+}
+
+template <class S>
+typename BasicDelta<S>::mat8 BasicDelta<S>::mci(const state &state) const {
+	jacobian f = mci_factor(state);
+	mat8 J;
+	for (size_t i=0; i<N; i++) {
+		vec8 column(0.);
+		column(i) = f.Jd(i);
+		J.col(i) = f.lu.solve(column);
+	}
 	return J;
 }
 
-#include <stdio.h>
+// parametres communs des resolutions du mgd
+static const float solve_epsilon = 0.015;	// precision sur q
+// pas de Newton complet: mci est la jacobienne exacte (test_model la compare a la differentiation automatique),
+// et sur les cibles de test_model un pas de 0.5 demande 6.2 evaluations du mgi en moyenne contre 4.4
+static const float solve_dumping = 1;
+static const int solve_iterations = 8;
 
-Delta::state Delta::mgd_solve(const vec8 &q, const vec8 &x0) {
-	const float epsilon = 0.015;	// precision sur q
-	const float dumping = 0.5;
+template <class S>
+typename BasicDelta<S>::state BasicDelta<S>::mgd_solve(const vec8 &q, const vec8 &x0, solve_info *info) const {
+	const S epsilon = solve_epsilon;
+	const S dumping = solve_dumping;
 	vec8 x = x0;
 	vec8 err;
 	state s;
-	for (int j=0; j<8; j++) {
+	int j;
+	for (j=0; j<solve_iterations; j++) {
 		s = mgi(x);
 		err = s.q - q;
-		for (int i=0; i<N; i++)		printf("  %f", s.q(i));
-		printf("\n");
 		if (err.norm() <= epsilon)	break;
-		printf("  err %d\n", err.norm());
-		x = x - dumping * (mci(s) * err);
+		x = x - dumping * mci_factor(s).apply(err);
 		
 	}
+	if (info) {
+		info->iterations = j < solve_iterations ? j+1 : j;
+		info->residual = err.norm();
+		info->converged = info->residual <= epsilon;
+		info->refreshes = info->iterations - info->converged;
+	}
 	return s;
 }
 
+template <class S>
+typename BasicDelta<S>::state BasicDelta<S>::mgd_solve(const vec8 &q, const vec8 &x0, broyden &cache, solve_info *info) const {
+	const S epsilon = solve_epsilon;
+	const S dumping = solve_dumping;
+	const S stall = 0.7;	// reduction d'erreur minimale par iteration avant de revenir a mci
+	mat8 &H = cache.H;
+	int refreshes = 0;
+	
+	vec8 x = x0;
+	state s = mgi(x);
+	vec8 err = s.q - q;
+	S residual = err.norm();
+	int iterations = 1;
+	
+	while (residual > epsilon && iterations < solve_iterations) {
+		if (!cache.valid) {
+			H = dumping * mci(s);
+			cache.valid = true;
+			refreshes++;
+		}
+		vec8 dx = S(-1) * (H * err);
+		state next = mgi(x + dx);
+		vec8 nerr = next.q - q;
+		S nresidual = nerr.norm();
+		iterations++;
+		
+		// mise a jour de Broyden de l'inverse (Sherman-Morrison):  H += (dx - H dq) (dx^T H) / (dx^T H dq)
+		// sauf si le pas sort de l'espace de travail: le mgi indefini empoisonnerait H pour tous les ticks suivants
+		vec8 dq = nerr - err;
+		vec8 Hdq = H * dq;
+		S den = dot(dx, Hdq);
+		if (den != S(0) && nresidual == nresidual) {
+			vec8 u = (dx - Hdq) / den;
+			vec8 w = H.transpose() * dx;
+			for (size_t j=0; j<N; j++)	H.col(j) += u * w(j);
+		}
+		
+		// l'approximation ne fait plus converger: repartir d'une jacobienne exacte au prochain pas
+		if (!(nresidual <= stall * residual))	cache.valid = false;
+		// ne garder le pas que s'il rapproche de la solution
+		if (nresidual < residual) {
+			x = x + dx;
+			s = next;
+			err = nerr;
+			residual = nresidual;
+		}
+	}
+	
+	if (info) {
+		info->iterations = iterations;
+		info->residual = residual;
+		info->converged = residual <= epsilon;
+		info->refreshes = refreshes;
+	}
+	return s;
+}
 
-vec4 vec2quat(const vec3 &rot) {
-	if (rot(0) == 0 && rot(1) == 0 && rot(2) == 0)
-		return vec(1, 0, 0, 0);
-	else {
-		float angle = rot.norm();
-		float s = sin(angle/2);
-		float quat[] = {cos(angle/2),  s*rot(0)/angle, s*rot(1)/angle, s*rot(2)/angle};
-		return vec4(quat);
+template <class S>
+typename BasicDelta<S>::state BasicDelta<S>::mgd_solve(const vec8 &q, const vec8 &x0, levenberg &cache, solve_info *info) const {
+	const S epsilon = solve_epsilon;
+	const S increase = 3;		// facteurs d'ajustement de lambda apres un pas refusé ou accepté
+	const S decrease = 0.5;
+	const S lambda_min = 1e-6;
+	const S lambda_max = 1e3;
+	S &lambda = cache.lambda;
+	
+	vec8 x = x0;
+	state s = mgi(x);
+	vec8 err = s.q - q;
+	S residual = err.norm();
+	int iterations = 1;
+	int refreshes = 0;
+	mat8 JtJ;
+	vec8 Jterr;
+	bool stale = true;
+	
+	// chaque iteration coute au plus un mgi, une jacobienne et une factorisation: duree bornée par solve_iterations
+	while (residual > epsilon && iterations < solve_iterations) {
+		// equations normales de  min |J dx + err|^2,  J = dq/dX, recalculées seulement apres un pas accepté
+		if (stale) {
+			mat8 J = mgi_jacobian(s);
+			JtJ = J.transpose() * J;
+			Jterr = J.transpose() * err;
+			refreshes++;
+			stale = false;
+		}
+		// amortissement de Marquardt: proportionnel a la diagonale, pour des composantes en mm et en rad
+		LDLT<S,N> f;
+		f.ld = JtJ;
+		f.ld.diagonal() += lambda * JtJ.diagonal();
+		if (f.factorize()) {
+			lambda = lambda * increase < lambda_max ? lambda * increase : lambda_max;
+			iterations++;
+			continue;
+		}
+		vec8 dx = S(-1) * f.solve(Jterr);
+		state next = mgi(x + dx);
+		vec8 nerr = next.q - q;
+		S nresidual = nerr.norm();
+		iterations++;
+		
+		if (nresidual < residual) {
+			// pas accepté: se rapprocher de Gauss-Newton
+			x = x + dx;
+			s = next;
+			err = nerr;
+			residual = nresidual;
+			stale = true;
+			lambda = lambda * decrease > lambda_min ? lambda * decrease : lambda_min;
+		}
+		// pas refusé (ou hors de l'espace de travail): se rapprocher de la descente de gradient, plus courte
+		else	lambda = lambda * increase < lambda_max ? lambda * increase : lambda_max;
 	}
+	
+	if (info) {
+		info->iterations = iterations;
+		info->residual = residual;
+		info->converged = residual <= epsilon;
+		info->refreshes = refreshes;
+	}
+	return s;
 }
-mat4 quat2mat(const vec4 &rot) {
-	float q1 = rot(0);
-	float q2 = rot(1);
-	float q3 = rot(2);
-	float q4 = rot(3);
-	float m[] = {
-		2*(q1*q1 + q2*q2)-1,	2*(q2*q3 - q1*q4), 		2*(q2*q4 + q1*q3), 	0,  
-		2*(q2*q3 + q1*q4),		2*(q1*q1 + q3*q3)-1,	2*(q3*q4 - q1*q2), 	0,	 
-		2*(q2*q4 - q1*q3),		2*(q3*q4 + q1*q2),		2*(q1*q1+q4*q4)-1,	0,
-		0, 						0, 						0, 					1};
-	return mat4(m);
+
+template <class S>
+typename BasicDelta<S>::vec8 BasicDelta<S>::seed(const vec8 &q) const {
+	float qf[N], X[N];
+	for (size_t i=0; i<N; i++)	qf[i] = float(q(i));
+	seeds::pose(seeds::nearest(qf), X);
+	return vec8(::vec8(X));
 }
-mat4 rotz(const float angle) {
-	float m[] = {
-		cos(angle), -sin(angle), 0, 0, 
-		sin(angle),  cos(angle), 0, 0,
-		0,           0,          1, 0,
-		0,			 0,          0, 1};
-	return mat4(m);
+
+template <class S>
+typename BasicDelta<S>::state BasicDelta<S>::mgd_solve(const vec8 &q, solve_info *info) const {
+	return mgd_solve(q, seed(q), info);
 }
+
+
+// types de calcul disponibles
+template struct BasicDelta<float>;
+// mgi en double avec les constantes float: reference de precision pour les tests
+template BasicDelta<double>::state BasicDelta<float>::mgi_eval(const la::Vector<double,N> &) const;
+// en virgule fixe, tout sauf le mgi derivé
+template BasicDelta<la::fix12>::state BasicDelta<la::fix12>::mgi(const vec8 &) const;
+template BasicDelta<la::fix12>::mat8 BasicDelta<la::fix12>::mci(const state &) const;
+template BasicDelta<la::fix12>::jacobian BasicDelta<la::fix12>::mci_factor(const state &) const;
+template BasicDelta<la::fix12>::state BasicDelta<la::fix12>::mgd_solve(const vec8 &, const vec8 &, solve_info *) const;
+template BasicDelta<la::fix12>::state BasicDelta<la::fix12>::mgd_solve(const vec8 &, const vec8 &, broyden &, solve_info *) const;
+template BasicDelta<la::fix12>::state BasicDelta<la::fix12>::mgd_solve(const vec8 &, solve_info *) const;
+template BasicDelta<la::fix12>::vec8 BasicDelta<la::fix12>::seed(const vec8 &) const;
+template struct BasicDelta<la::fix12>::jacobian;
@@ -2,48 +2,142 @@
 #define _MODEL_H
 
 #include "linalg.h"
+#include "geometry.h"
+#include "fastmath.h"
 
 static const size_t N = 8;
 typedef la::Vector<float, N> vec8;
 typedef la::Matrix<float, N, N> mat8;
 
-/** 
+/**
  * 	structure contenant les constantes de calcul
+ * 	S est le type scalaire de tous les calculs (float, la::fix12 pour les cartes sans FPU)
 */
-struct Delta {
+template <class S>
+struct BasicDelta {
+	typedef la::Vector<S, N> vec8;
+	typedef la::Matrix<S, N, N> mat8;
+	typedef la::Vector<S, 3> vec3;
+	typedef la::Vector<S, 4> vec4;
+	typedef la::Matrix<S, 4, 4> mat4;
+
 	struct state {
 		vec8 X;
 		vec8 q;
-		la::vec3 c[N];
-		la::vec3 a[N];
-		la::mat4 bRe;
+		vec3 c[N];
+		vec3 a[N];
+		mat4 bRe;
+	};
+	/// jacobienne sous forme factorisée:  J = (Jgt^T)^-1 * diag(Jd), l'inverse n'est jamais calculée
+	struct jacobian {
+		la::LU<S, N> lu;	// factorisation de Jgt^T
+		vec8 Jd;
+
+		vec8 apply(const vec8 &v) const;			// J * v
+		vec8 apply_transpose(const vec8 &v) const;	// J^T * v
+	};
+	/// compte-rendu d'une resolution du mgd
+	struct solve_info {
+		int iterations;		// nombre d'evaluations du mgi
+		S residual;			// norme de l'erreur sur q a la sortie
+		bool converged;
+		int refreshes;		// nombre de jacobiennes recalculées par mci
+	};
+	/// jacobienne inverse approchée, conservée d'un tick a l'autre et corrigée par des mises a jour de Broyden de rang 1
+	struct broyden {
+		mat8 H;		// approximation de dX/dq, amortissement compris
+		bool valid;
+		broyden() : valid(false) {}
+	};
+	/// amortissement de Levenberg-Marquardt, conservé d'un tick a l'autre
+	struct levenberg {
+		S lambda;	// poids de diag(J^T J) ajouté a J^T J
+		levenberg() : lambda(S(1e-2)) {}
 	};
 	/// fonctions mises a disposition
-	mat8 mci(const state &c);	// J_cinematique = mci(X)
-	state mgi(const vec8 &X);	// Q,C,A,bRe = mgi(X)
-	state mgd_solve(const vec8 &Q, const vec8 &X0); // calcule X pour Q par proximité a partir d'un point de départ
-	
-	Delta();	// construction des constantes pour accelerer les calculs
+	mat8 mci(const state &c) const;	// J_cinematique = mci(X)
+	jacobian mci_factor(const state &c) const;	// meme jacobienne, a appliquer sans l'inverser
+	mat8 mgi_jacobian(const state &c) const;	// dq/dX = mci^-1, obtenue sans inversion par les memes lignes que mci_factor
+	state mgi(const vec8 &X) const;	// Q,C,A,bRe = mgi(X)
+	state mgi(const vec8 &X, mat8 &dqdX) const;	// idem, avec la jacobienne exacte dq/dX obtenue dans le meme passage (differentiation automatique)
+	state mgd_solve(const vec8 &Q, const vec8 &X0, solve_info *info=nullptr) const; // calcule X pour Q par proximité a partir d'un point de départ
+	state mgd_solve(const vec8 &Q, const vec8 &X0, broyden &cache, solve_info *info=nullptr) const; // idem sans recalculer mci a chaque iteration
+	state mgd_solve(const vec8 &Q, const vec8 &X0, levenberg &cache, solve_info *info=nullptr) const; // idem par moindres carrés amortis, robuste pres des singularités
+	state mgd_solve(const vec8 &Q, solve_info *info=nullptr) const;	// idem en partant de seed(Q), pour les grands deplacements ou au demarrage
+	vec8 seed(const vec8 &Q) const;	// pose précalculée dont les angles sont les plus proches de Q (voir seeds.h)
+
+	/// construction des constantes a partir de la geometrie: evaluée a la compilation pour un `constexpr Delta` (S = float)
+	constexpr BasicDelta(const geometry::Constants &g = geometry::delta) :
+		RgA{vec4(g.RgA[0]), vec4(g.RgA[1]), vec4(g.RgA[2]), vec4(g.RgA[3]), vec4(g.RgA[4]), vec4(g.RgA[5]), vec4(g.RgA[6]), vec4(g.RgA[7])},
+		b{vec3(g.b[0]), vec3(g.b[1]), vec3(g.b[2]), vec3(g.b[3]), vec3(g.b[4]), vec3(g.b[5]), vec3(g.b[6]), vec3(g.b[7])},
+		ra(g.ra), rb(g.rb), R(g.R), l(g.l),
+		axis{vec3(g.axis[0]), vec3(g.axis[1]), vec3(g.axis[2]), vec3(g.axis[3]), vec3(g.axis[4]), vec3(g.axis[5]), vec3(g.axis[6]), vec3(g.axis[7])}
+	{}
 	
+	/// corps du mgi, pour n'importe quel type de variables T (S, ou la::Dual<S,N> pour deriver)
+	template <class T>
+	typename BasicDelta<T>::state mgi_eval(const la::Vector<T,N> &X) const;
+
 	/* constantes */
-	la::vec4 RgA[N];	// matrices constantes pour les positionnement de A et B
-	la::vec3 b[N];
-	float ra;
-	float rb;
-	float R;
-	float l;
-	la::vec3 axis[N];	// axes des pivots par liaison
+	vec4 RgA[N];	// matrices constantes pour les positionnement de A et B
+	vec3 b[N];
+	S ra;
+	S rb;
+	S R;
+	S l;
+	vec3 axis[N];	// axes des pivots par liaison
 };
 
+typedef BasicDelta<float> Delta;
+
 /*
  * facilités internes
 */
 
 const float pi = M_PI;
-inline float sq(const float x)		{ return x*x; }
+template <class S>
+inline S sq(const S x)		{ return x*x; }
 inline float deg2rad(const float angle) { return angle * M_PI/180; }
-la::vec4 vec2quat(const la::vec3 &rot);	// quaternion associé a la rotation autour du vecteur, et d'angle sa norme
-la::mat4 quat2mat(const la::vec4 &rot);	// matrice de rotation associée au quaternion
-la::mat4 rotz(const float angle);	// matrice de rotation autour de z
+
+/// quaternion associé a la rotation autour du vecteur, et d'angle sa norme
+template <class S>
+la::Vector<S,4> vec2quat(const la::Vector<S,3> &rot) {
+	S angle2 = dot(rot, rot);
+	// developpement limité pour les petits angles: pas de division par un angle quasi-nul (virgule fixe), et des derivées correctes en 0 (nombres duaux)
+	if (angle2 < S(1e-2)) {
+		S s = S(0.5) - angle2/48 + angle2*angle2/3840;
+		S c = S(1) - angle2/8 + angle2*angle2/384;
+		return la::vec<S>(c,  s*rot(0), s*rot(1), s*rot(2));
+	}
+	else {
+		S angle = kin::sqrt(angle2);
+		S s = kin::sin(angle/2) / angle;
+		return la::vec<S>(kin::cos(angle/2),  s*rot(0), s*rot(1), s*rot(2));
+	}
+}
+/// matrice de rotation associée au quaternion
+template <class S>
+la::Matrix<S,4,4> quat2mat(const la::Vector<S,4> &rot) {
+	S q1 = rot(0);
+	S q2 = rot(1);
+	S q3 = rot(2);
+	S q4 = rot(3);
+	S m[] = {
+		2*(q1*q1 + q2*q2)-1,	2*(q2*q3 - q1*q4), 		2*(q2*q4 + q1*q3), 	0,
+		2*(q2*q3 + q1*q4),		2*(q1*q1 + q3*q3)-1,	2*(q3*q4 - q1*q2), 	0,
+		2*(q2*q4 - q1*q3),		2*(q3*q4 + q1*q2),		2*(q1*q1+q4*q4)-1,	0,
+		0, 						0, 						0, 					1};
+	return la::Matrix<S,4,4>(m);
+}
+/// matrice de rotation autour de z
+template <class S>
+la::Matrix<S,4,4> rotz(const S angle) {
+	S m[] = {
+		cos(angle), -sin(angle), 0, 0,
+		sin(angle),  cos(angle), 0, 0,
+		0,           0,          1, 0,
+		0,			 0,          0, 1};
+	return la::Matrix<S,4,4>(m);
+}
 
 #endif
@@ -0,0 +1,32 @@
+#include "observer.h"
+
+/// durée en secondes de a a b, malgré le debordement de l'horloge
+static float elapsed(uint32_t a, uint32_t b)	{ return int32_t(b - a) * 1e-6f; }
+
+void Observer::reset(const vec8 &X, uint32_t time) {
+	x = X;
+	v = vec8(0.);
+	t = time;
+	valid = true;
+}
+
+void Observer::update(const vec8 &X, uint32_t time) {
+	float dt = elapsed(t, time);
+	if (!valid || dt <= 0) {
+		reset(X, time);
+		return;
+	}
+	vec8 r = X - (x + dt * v);
+	x = x + dt * v + alpha * r;
+	v = v + (beta / dt) * r;
+	t = time;
+}
+
+void Observer::update_velocity(const vec8 &V) {
+	v = v + gamma * (V - v);
+}
+
+vec8 Observer::predict(uint32_t time) const {
+	float dt = elapsed(t, time);
+	return x + (dt < horizon ? dt : horizon) * v;
+}
@@ -0,0 +1,46 @@
+#ifndef _OBSERVER_H
+#define _OBSERVER_H
+
+/*
+	observateur alpha-beta de la pose, sur les 8 composantes de X
+	il filtre la suite des poses resolues par le mgd et en estime la vitesse, ce qui permet:
+		- de predire la pose a un instant donné: point de depart de la prochaine resolution, pose envoyée sans le retard du dernier calcul
+		- de fournir une vitesse filtrée pour l'amortissement du retour de force
+	la vitesse peut aussi etre corrigée par une mesure directe (vitesses des moteurs ramenées dans l'espace de X par la jacobienne).
+	
+	les instants sont en µs (micros()), les calculs supportent le debordement de l'horloge sur 32 bits.
+*/
+
+#include "model.h"
+#include <stdint.h>
+
+class Observer {
+public:
+	/// alpha: part de l'ecart a la prediction appliquée a la pose, beta: a la vitesse (par periode)
+	/// gamma: part de l'ecart a la vitesse mesurée appliquée a la vitesse
+	/// horizon: extrapolation maximale (s), pour ne pas envoyer une pose qui derive si les resolutions s'arretent
+	Observer(float alpha=0.6, float beta=0.2, float gamma=0.3, float horizon=0.02)
+		: alpha(alpha), beta(beta), gamma(gamma), horizon(horizon), valid(false) {}
+	
+	/// repart d'une pose connue, a vitesse nulle (demarrage, ou apres une resolution qui a echoué)
+	void reset(const vec8 &X, uint32_t time);
+	/// corrige l'estimation avec une pose resolue a partir des angles lus a l'instant time
+	void update(const vec8 &X, uint32_t time);
+	/// corrige la vitesse avec une mesure directe, au meme instant que la derniere pose
+	void update_velocity(const vec8 &V);
+	/// pose extrapolée a l'instant time, au plus horizon apres la derniere pose
+	vec8 predict(uint32_t time) const;
+	
+	const vec8 & pose() const		{ return x; }
+	const vec8 & velocity() const	{ return v; }	// mm/s et rad/s
+	bool ready() const				{ return valid; }
+	
+	float alpha, beta, gamma, horizon;
+	
+private:
+	vec8 x, v;
+	uint32_t t;		// instant de x
+	bool valid;
+};
+
+#endif
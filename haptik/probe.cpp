@@ -0,0 +1,121 @@
+#include "probe.h"
+
+#if HAPTIK_PROBES
+#include <stdio.h>
+#include <string.h>
+
+#if PROBE_DWT
+extern "C" uint32_t SystemCoreClock;	// CMSIS
+#endif
+
+namespace probe {
+
+static const char *const names[phases] = {"read", "solve", "mci", "write", "comm"};
+
+static Stats phase_stats[phases];
+static uint32_t iterations[max_iterations];
+/// dernieres mesures, la plus ancienne est ecrasée
+static struct {
+	uint8_t phase;
+	uint32_t ticks;
+} ring[ring_size];
+static size_t ring_next = 0;
+static size_t ring_count = 0;
+
+void init() {
+#if PROBE_DWT
+	*(volatile uint32_t *)0xE000EDFC |= 1u << 24;	// CoreDebug->DEMCR: TRCENA
+	*(volatile uint32_t *)0xE0001FB0 = 0xC5ACCE55;	// DWT->LAR: sur le Cortex-M7 (OpenCR), registres verrouillés sans cette clé
+	*(volatile uint32_t *)0xE0001004 = 0;			// DWT->CYCCNT
+	*(volatile uint32_t *)0xE0001000 |= 1;			// DWT->CTRL: CYCCNTENA
+#endif
+	reset();
+}
+
+uint32_t ticks_per_us() {
+#if PROBE_DWT
+	return SystemCoreClock / 1000000;
+#else
+	return 1000;
+#endif
+}
+
+void record(Phase phase, uint32_t ticks) {
+	Stats &s = phase_stats[phase];
+	s.count++;
+	s.total += ticks;
+	if (ticks > s.worst)	s.worst = ticks;
+	size_t k = 0;
+	while (k < buckets-1 && (ticks >> k))	k++;
+	s.histogram[k]++;
+	
+	ring[ring_next].phase = phase;
+	ring[ring_next].ticks = ticks;
+	ring_next = (ring_next + 1) % ring_size;
+	if (ring_count < ring_size)		ring_count++;
+}
+
+void record_iterations(int n) {
+	if (n < 0)	n = 0;
+	iterations[size_t(n) < max_iterations ? n : max_iterations-1]++;
+}
+
+void reset() {
+	memset(phase_stats, 0, sizeof(phase_stats));
+	memset(iterations, 0, sizeof(iterations));
+	ring_next = ring_count = 0;
+}
+
+const Stats & stats(Phase phase)	{ return phase_stats[phase]; }
+uint32_t iteration_count(size_t n)	{ return n < max_iterations ? iterations[n] : 0; }
+
+/// ajoute les compteurs a la ligne
+static size_t append(char *text, size_t size, size_t length, const uint32_t *counts, size_t n) {
+	for (size_t i=0; i<n && length < size; i++)
+		length += snprintf(text+length, size-length, " %lu", (unsigned long) counts[i]);
+	return length < size ? length : size-1;
+}
+
+/*
+	rapport:
+		T <unités par µs>
+		P <phase> <mesures> <pire> <total>		une ligne par phase
+		H <phase> <premiere classe> <effectifs>	une ligne par phase, de la premiere a la derniere classe non vide
+		I <0 iteration> ... <15 iterations et plus>
+		R <phase> <durée>						une ligne par mesure de l'anneau, de la plus ancienne a la plus recente
+		E
+*/
+size_t format(size_t line, char *text, size_t size) {
+	if (!size)	return 0;
+	size_t length;
+	if (line == 0)
+		length = snprintf(text, size, "T %lu", (unsigned long) ticks_per_us());
+	else if ((line -= 1) < phases) {
+		const Stats &s = phase_stats[line];
+		length = snprintf(text, size, "P %s %lu %lu %llu", names[line], (unsigned long) s.count, (unsigned long) s.worst, (unsigned long long) s.total);
+	}
+	else if ((line -= phases) < phases) {
+		const uint32_t *h = phase_stats[line].histogram;
+		size_t first = 0, last = buckets;
+		while (first < buckets && !h[first])	first++;
+		while (last > first && !h[last-1])		last--;
+		length = snprintf(text, size, "H %s %u", names[line], unsigned(first));
+		length = append(text, size, length < size ? length : size-1, h + first, last - first);
+	}
+	else if ((line -= phases) == 0) {
+		length = snprintf(text, size, "I");
+		length = append(text, size, length, iterations, max_iterations);
+	}
+	else if ((line -= 1) < ring_count) {
+		size_t i = (ring_next + ring_size - ring_count + line) % ring_size;
+		length = snprintf(text, size, "R %s %lu", names[ring[i].phase], (unsigned long) ring[i].ticks);
+	}
+	else if (line == ring_count)
+		length = snprintf(text, size, "E");
+	else
+		return 0;
+	return length < size ? length : size-1;
+}
+
+};
+#endif
@@ -0,0 +1,103 @@
+#ifndef _PROBE_H
+#define _PROBE_H
+
+/*
+	sondes de temps pour les phases du controle
+	PROBE(phase) mesure la durée du bloc qui la contient, en cycles (compteur DWT des Cortex-M3/M4/M7) ou en ns sur l'hote (clock_gettime).
+	chaque mesure alimente l'histogramme de sa phase (classes en puissances de 2), son pire cas, et un anneau des dernieres mesures.
+	le rapport est produit ligne par ligne par format(), pour etre envoyé sur n'importe quel support.
+	
+	compilé avec HAPTIK_PROBES=0, PROBE() ne produit aucun code et les fonctions sont vides.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef HAPTIK_PROBES
+	#define HAPTIK_PROBES 1
+#endif
+
+#if HAPTIK_PROBES
+	#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+		#define PROBE_DWT 1
+	#else
+		#include <time.h>
+	#endif
+#endif
+
+namespace probe {
+
+enum Phase : uint8_t {
+	READ,		// lecture des angles
+	SOLVE,		// mgd_solve
+	MCI,		// jacobienne pour le retour de force
+	WRITE,		// ecriture des courants
+	COMM,		// envoi de la pose et lecture des ordres
+	phases
+};
+static const size_t buckets = 24;		// classe k: durées dans [2^(k-1), 2^k[
+static const size_t ring_size = 64;
+static const size_t max_iterations = 16;
+
+struct Stats {
+	uint32_t count;
+	uint32_t worst;
+	uint64_t total;
+	uint32_t histogram[buckets];
+};
+
+#if HAPTIK_PROBES
+
+#if PROBE_DWT
+/// compteur de cycles du coeur
+inline uint32_t now()	{ return *(volatile uint32_t *)0xE0001004; }	// DWT->CYCCNT
+#else
+/// ns de l'horloge monotone
+inline uint32_t now() {
+	timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return uint32_t(t.tv_sec * 1000000000ull + t.tv_nsec);
+}
+#endif
+
+/// demarre le compteur de cycles, a appeler une fois au demarrage
+void init();
+/// unités de now() par µs
+uint32_t ticks_per_us();
+void record(Phase phase, uint32_t ticks);
+/// nombre d'iterations d'une resolution du mgd
+void record_iterations(int iterations);
+void reset();
+const Stats & stats(Phase phase);
+/// nombre de resolutions en n iterations (max_iterations-1 et plus pour la derniere classe)
+uint32_t iteration_count(size_t n);
+/// ligne numero `line` du rapport dans text, retourne sa longueur ou 0 apres la derniere ligne
+size_t format(size_t line, char *text, size_t size);
+
+/// mesure la durée de vie de l'objet
+class Scope {
+public:
+	Scope(Phase phase) : phase(phase), start(now()) {}
+	~Scope()	{ record(phase, now() - start); }
+private:
+	Phase phase;
+	uint32_t start;
+};
+
+#define PROBE_CONCAT2(a, b)		a##b
+#define PROBE_CONCAT(a, b)		PROBE_CONCAT2(a, b)
+#define PROBE(phase)			probe::Scope PROBE_CONCAT(probe_scope_, __LINE__)(probe::phase)
+
+#else
+
+inline void init() {}
+inline void record_iterations(int) {}
+inline void reset() {}
+inline size_t format(size_t, char *, size_t)	{ return 0; }
+
+#define PROBE(phase)
+
+#endif
+
+};
+#endif
@@ -0,0 +1,176 @@
+#include "protocol.h"
+#include <string.h>
+
+namespace proto {
+
+uint16_t crc16(const uint8_t *data, size_t size) {
+	uint16_t crc = 0xFFFF;
+	for (size_t i=0; i<size; i++) {
+		crc ^= uint16_t(data[i]) << 8;
+		for (int k=0; k<8; k++)
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+	}
+	return crc;
+}
+
+size_t cobs_encode(const uint8_t *src, size_t size, uint8_t *dst) {
+	size_t code_index = 0;	// position de l'octet donnant la distance au prochain zero
+	size_t out = 1;
+	uint8_t code = 1;
+	for (size_t i=0; i<size; i++) {
+		if (src[i])		{ dst[out++] = src[i];	code++; }
+		if (!src[i] || code == 0xFF) {
+			dst[code_index] = code;
+			code = 1;
+			code_index = out++;
+		}
+	}
+	dst[code_index] = code;
+	return out;
+}
+
+size_t cobs_decode(const uint8_t *src, size_t size, uint8_t *dst) {
+	size_t out = 0;
+	size_t i = 0;
+	while (i < size) {
+		uint8_t code = src[i++];
+		if (code == 0 || i + code-1 > size)		return 0;
+		for (uint8_t k=1; k<code; k++) {
+			if (!src[i])	return 0;
+			dst[out++] = src[i++];
+		}
+		if (code != 0xFF && i < size)	dst[out++] = 0;
+	}
+	return out;
+}
+
+size_t payload_size(Type type) {
+	switch (type) {
+		case POSE:
+		case FORCE:
+		case BLOCK:		return 8*sizeof(float);
+		case CONFIG:	return 2;
+		case TEXT:
+		case TELEMETRY:	return max_text;
+		case RECORD:	return max_channels;
+		case PING:		return sizeof(uint32_t);
+		case SCENE:
+		case PATH:		return 4 + max_scene_values*sizeof(float);
+		default:		return 0;
+	}
+}
+
+/// taille du contenu coherente avec le type: exacte, au plus max_text pour TEXT, annoncée par le compte pour SCENE et PATH
+static bool valid_payload(Type type, const uint8_t *payload, size_t size) {
+	switch (type) {
+		case TEXT:
+		case TELEMETRY:	return size <= max_text;
+		case SCENE:
+		case PATH:		return size >= 4 && payload[3] <= max_scene_values && size == 4 + payload[3]*sizeof(float);
+		default:		return size == payload_size(type);
+	}
+}
+
+size_t Encoder::encode(Message &message, uint8_t *frame) {
+	uint8_t raw[max_raw];
+	message.seq = seq++;
+	raw[0] = message.type;
+	memcpy(raw+1, &message.seq, 2);
+	memcpy(raw+3, &message.timestamp, 4);
+	size_t size = header_size;
+	if (message.type == CONFIG) {
+		raw[size++] = message.config.flags;
+		raw[size++] = message.config.refresh;
+	}
+	else if (message.type == TEXT || message.type == TELEMETRY) {
+		size_t length = message.length < max_text ? message.length : max_text;
+		memcpy(raw+size, message.text, length);
+		size += length;
+	}
+	else if (message.type == RECORD) {
+		memcpy(raw+size, message.decimation, max_channels);
+		size += max_channels;
+	}
+	else if (message.type == PING) {
+		memcpy(raw+size, &message.echo, sizeof(uint32_t));
+		size += sizeof(uint32_t);
+	}
+	else if (message.type == SCENE || message.type == PATH) {
+		uint8_t count = message.scene.count < max_scene_values ? message.scene.count : max_scene_values;
+		raw[size++] = message.scene.slot;
+		raw[size++] = message.scene.kind;
+		raw[size++] = message.scene.first;
+		raw[size++] = count;
+		memcpy(raw+size, message.scene.values, count*sizeof(float));
+		size += count*sizeof(float);
+	}
+	else {
+		memcpy(raw+size, message.vec, payload_size(message.type));
+		size += payload_size(message.type);
+	}
+	uint16_t crc = crc16(raw, size);
+	raw[size++] = crc >> 8;
+	raw[size++] = crc & 0xFF;
+	
+	size_t encoded = cobs_encode(raw, size, frame);
+	frame[encoded++] = 0;
+	return encoded;
+}
+
+Decoder::Decoder() : frames(0), errors(0), lost(0), size(0), overflow(false), synced(false), last_seq(0) {}
+
+bool Decoder::push(uint8_t byte, Message &message) {
+	if (byte) {
+		if (size < max_frame)	buffer[size++] = byte;
+		else					overflow = true;
+		return false;
+	}
+	// fin de trame
+	size_t encoded = size;
+	bool truncated = overflow;
+	size = 0;
+	overflow = false;
+	if (!encoded)	return false;	// delimiteurs consecutifs
+	
+	uint8_t raw[max_frame];
+	size_t rawsize = truncated ? 0 : cobs_decode(buffer, encoded, raw);
+	Type type = Type(rawsize ? raw[0] : 0);
+	size_t payload = rawsize - header_size - crc_size;
+	if (	rawsize < header_size + crc_size
+		||	type < POSE || type > PING
+		||	!valid_payload(type, raw + header_size, payload)
+		||	crc16(raw, rawsize - crc_size) != (uint16_t(raw[rawsize-2]) << 8 | raw[rawsize-1])) {
+		errors++;
+		return false;
+	}
+	
+	message.type = type;
+	memcpy(&message.seq, raw+1, 2);
+	memcpy(&message.timestamp, raw+3, 4);
+	if (type == CONFIG) {
+		message.config.flags = raw[header_size];
+		message.config.refresh = raw[header_size+1];
+	}
+	else if (type == TEXT || type == TELEMETRY) {
+		message.length = payload;
+		memcpy(message.text, raw+header_size, payload);
+	}
+	else if (type == RECORD)	memcpy(message.decimation, raw+header_size, max_channels);
+	else if (type == PING)		memcpy(&message.echo, raw+header_size, sizeof(uint32_t));
+	else if (type == SCENE || type == PATH) {
+		message.scene.slot = raw[header_size];
+		message.scene.kind = raw[header_size+1];
+		message.scene.first = raw[header_size+2];
+		message.scene.count = raw[header_size+3];
+		memcpy(message.scene.values, raw+header_size+4, message.scene.count*sizeof(float));
+	}
+	else	memcpy(message.vec, raw+header_size, payload_size(type));
+	
+	if (synced)		lost += uint16_t(message.seq - last_seq - 1);
+	synced = true;
+	last_seq = message.seq;
+	frames++;
+	return true;
+}
+
+};
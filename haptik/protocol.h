@@ -0,0 +1,112 @@
+#ifndef _PROTOCOL_H
+#define _PROTOCOL_H
+
+/*
+	protocole binaire du port serie, commun a la carte et a l'ordinateur
+	chaque message est une trame:  type(1) sequence(2) timestamp(4) contenu crc(2), encodée en COBS et terminée par un octet nul.
+	le COBS garantit qu'aucun octet nul n'apparait dans la trame: on se resynchronise sur le prochain 0 apres une erreur.
+	les entiers et flottants sont en little-endian (STM32 et x86).
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace proto {
+
+enum Type : uint8_t {
+	POSE = 1,		// carte -> ordinateur: pose courante
+	FORCE = 2,		// ordinateur -> carte: retour de force, comme la commande texte "force"
+	BLOCK = 3,		// ordinateur -> carte: direction bloquée, comme "block"
+	NONE = 4,		// ordinateur -> carte: plus de retour de force
+	CONFIG = 5,		// ordinateur -> carte: drapeaux d'activation
+	TEXT = 6,		// carte -> ordinateur: une ligne de texte (rapport des sondes de temps, voir probe.h)
+	DUMP = 7,		// ordinateur -> carte: demande le rapport des sondes de temps
+	SCENE = 8,		// ordinateur -> carte: parametres d'une primitive de la scene haptique (scene.h)
+	PATH = 9,		// ordinateur -> carte: coordonnées des points de trajectoire de la scene
+	TELEMETRY = 10,	// carte -> ordinateur: un bloc de telemetrie (telemetry.h)
+	RECORD = 11,	// ordinateur -> carte: decimation de chaque voie de telemetrie
+	PING = 12,		// dans les deux sens: la carte renvoie a la communication suivante un PING portant l'horodatage de celui recu
+};
+
+/// drapeaux du message CONFIG
+enum ConfigFlag : uint8_t {
+	FEEDBACK = 1,
+	MEASURE = 2,
+	ASSIST = 4,
+	ASCII = 8,		// revenir au protocole texte
+	VELOCITY = 16,	// lire aussi les vitesses des moteurs pour l'observateur de pose
+};
+
+static const size_t header_size = 7;
+static const size_t crc_size = 2;
+static const size_t max_text = 120;
+static const size_t max_payload = max_text;
+static const size_t max_scene_values = 24;		// flottants par message SCENE ou PATH
+static const size_t max_channels = 8;			// voies de telemetrie configurables par RECORD
+
+struct Message {
+	Type type;
+	uint16_t seq;			// numero de sequence de l'emetteur
+	uint32_t timestamp;		// µs, horloge de l'emetteur
+	float vec[8];			// POSE, FORCE, BLOCK
+	struct {
+		uint8_t flags;		// combinaison de ConfigFlag
+		uint8_t refresh;	// periodes de controle entre deux communications
+	} config;				// CONFIG
+	uint8_t length;			// TEXT, TELEMETRY: le texte n'est pas terminé par un 0, le bloc de telemetrie y est rangé tel quel
+	char text[max_text];
+	struct {
+		uint8_t slot;		// emplacement de la primitive (ignoré pour PATH)
+		uint8_t kind;		// scene::Kind (ignoré pour PATH)
+		uint8_t first;		// premier parametre ecrit, ou premiere coordonnée pour PATH
+		uint8_t count;		// nombre de valeurs, au plus max_scene_values
+		float values[max_scene_values];
+	} scene;				// SCENE, PATH
+	uint8_t decimation[max_channels];	// RECORD: une periode d'enregistrement par voie, 0 l'arrete
+	uint32_t echo;			// PING: horodatage du PING auquel celui-ci repond (0 pour une demande)
+};
+
+static const size_t max_raw = header_size + max_payload + crc_size;
+/// taille maximale d'une trame encodée, delimiteur compris
+static const size_t max_frame = max_raw + max_raw/254 + 2;
+
+/// CRC-16/CCITT-FALSE
+uint16_t crc16(const uint8_t *data, size_t size);
+/// encode size octets de src dans dst (au plus size + size/254 + 1 octets), sans delimiteur. retourne la taille encodée
+size_t cobs_encode(const uint8_t *src, size_t size, uint8_t *dst);
+/// decode une trame sans son delimiteur, retourne la taille decodée ou 0 si la trame est invalide
+size_t cobs_decode(const uint8_t *src, size_t size, uint8_t *dst);
+
+/// taille du contenu d'un message de ce type (maximale pour TEXT, TELEMETRY, SCENE et PATH)
+size_t payload_size(Type type);
+
+/// numérote et encode les messages d'un emetteur
+class Encoder {
+public:
+	Encoder() : seq(0) {}
+	/// ecrit dans frame (au moins max_frame octets) la trame complete, delimiteur compris, et retourne sa taille
+	size_t encode(Message &message, uint8_t *frame);
+private:
+	uint16_t seq;
+};
+
+/// decodeur incrémental: on lui donne les octets recus un par un, dans l'ordre et sans attendre
+class Decoder {
+public:
+	Decoder();
+	/// retourne vrai quand l'octet complete une trame valide, alors decodée dans message
+	bool push(uint8_t byte, Message &message);
+	
+	unsigned long frames;	// trames valides
+	unsigned long errors;	// trames rejetées (COBS, taille, type ou CRC)
+	unsigned long lost;		// messages manquants d'apres les numeros de sequence
+private:
+	uint8_t buffer[max_frame];
+	size_t size;
+	bool overflow;
+	bool synced;
+	uint16_t last_seq;
+};
+
+};
+#endif
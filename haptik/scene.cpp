@@ -0,0 +1,145 @@
+#include "scene.h"
+#include <string.h>
+#include <math.h>
+
+using namespace la;
+
+namespace scene {
+
+/// nombre de parametres utilisés par chaque nature de primitive
+static const uint8_t param_count[kinds] = {0, 6, 6, 8, 11, 5};
+
+void Scene::clear() {
+	memset(slots, 0, sizeof(slots));
+	memset(points, 0, sizeof(points));
+	active = 0;
+}
+
+/// indice de point valable: entier fini de 0 a max_points
+static bool point_index(float value) {
+	return value >= 0 && value <= max_points && value == floorf(value);
+}
+
+bool Scene::set(uint8_t slot, Kind kind, uint8_t first, const float *values, uint8_t count) {
+	if (slot >= max_primitives || kind >= kinds || size_t(first) + count > param_count[kind])
+		return false;
+	Primitive &p = slots[slot];
+	float params[max_params];
+	if (p.kind == kind)		memcpy(params, p.params, sizeof(params));
+	else					memset(params, 0, sizeof(params));
+	memcpy(params + first, values, count * sizeof(float));
+	// les bornes d'une trajectoire indexent la reserve de points
+	if (kind == PATH && !(point_index(params[0]) && point_index(params[1]) && params[0] + params[1] <= max_points))
+		return false;
+	if (p.kind != kind) {
+		active += (kind != EMPTY) - (p.kind != EMPTY);
+		p.kind = kind;
+	}
+	memcpy(p.params, params, sizeof(params));
+	return true;
+}
+
+bool Scene::set_points(uint8_t first, const float *values, uint8_t count) {
+	if (size_t(first) + count > 3*max_points)	return false;
+	memcpy(&points[0][0] + first, values, count * sizeof(float));
+	return true;
+}
+
+/// reaction d'un contact de normale n (sortante, unitaire) et de penetration pen: ressort et amortisseur, jamais attractive
+static vec3 contact(const vec3 &n, float pen, const vec3 &v, float stiffness, float damping) {
+	float f = stiffness * pen - damping * dot(v, n);
+	return (f > 0 ? f : 0) * n;
+}
+
+vec8 Scene::evaluate(const vec8 &X, const vec8 &V) const {
+	vec8 W(0.);
+	vec3 p = vec(X(0), X(1), X(2));
+	vec3 v = vec(V(0), V(1), V(2));
+	vec3 F(0.);
+
+	for (size_t s=0; s<max_primitives; s++) {
+		const float *a = slots[s].params;
+		switch (slots[s].kind) {
+			case PLANE: {
+				vec3 n = vec(a[0], a[1], a[2]);
+				float pen = a[3] - dot(n, p);
+				if (pen > 0)	F += contact(n, pen, v, a[4], a[5]);
+				break;
+			}
+			case SPHERE: {
+				vec3 d = p - vec(a[0], a[1], a[2]);
+				float dist = d.norm();
+				float radius = a[3];
+				if (dist == 0)	break;		// direction indeterminée
+				if (radius >= 0 && dist < radius)	F += contact(d / dist, radius - dist, v, a[4], a[5]);
+				if (radius < 0 && dist > -radius)	F += contact(d / -dist, dist + radius, v, a[4], a[5]);
+				break;
+			}
+			case BOX: {
+				// a l'interieur, sortie par la face la plus proche
+				float pen = INFINITY;
+				size_t axis = 0;
+				float side = 1;
+				for (size_t i=0; i<3; i++) {
+					float d = p(i) - a[i];
+					float depth = a[3+i] - fabs(d);
+					if (depth < pen) {
+						pen = depth;
+						axis = i;
+						side = d < 0 ? -1 : 1;
+					}
+				}
+				if (pen > 0) {
+					vec3 n(0.);
+					n(axis) = side;
+					F += contact(n, pen, v, a[6], a[7]);
+				}
+				break;
+			}
+			case SPRING: {
+				for (size_t i=0; i<N; i++)	W(i) -= (i < 3 ? a[8] : a[9]) * (X(i) - a[i]) + a[10] * V(i);
+				break;
+			}
+			case PATH: {
+				// point le plus proche sur la ligne brisée, et la direction de la trajectoire en ce point
+				// bornes verifiées par set(), converties seulement une fois dans la reserve
+				if (!(a[0] >= 0 && a[1] >= 1 && a[0] + a[1] <= max_points))	break;
+				size_t first = a[0], count = a[1];
+				float best = INFINITY;
+				vec3 closest(0.), tangent(0.);
+				for (size_t i=first; i<first+count; i++) {
+					vec3 A = vec3(points[i]);
+					vec3 B = vec3(points[i+1 < first+count ? i+1 : i]);
+					vec3 AB = B - A;
+					float len2 = dot(AB, AB);
+					float t = len2 > 0 ? dot(p - A, AB) / len2 : 0;
+					t = t < 0 ? 0 : (t > 1 ? 1 : t);
+					vec3 c = A + t * AB;
+					float d2 = dot(p - c, p - c);
+					if (d2 < best) {
+						best = d2;
+						closest = c;
+						tangent = len2 > 0 ? AB / sqrtf(len2) : vec3(0.);
+					}
+				}
+				vec3 e = closest - p;
+				float dist = sqrtf(best);
+				float pen = dist - a[4];
+				if (pen > 0) {
+					// seule la vitesse transverse est amortie: le mouvement le long de la trajectoire reste libre
+					vec3 vt = v - dot(v, tangent) * tangent;
+					F += contact(e / dist, pen, vt, a[2], a[3]);
+				}
+				break;
+			}
+			default:
+				break;
+		}
+	}
+	W(0) += F(0);
+	W(1) += F(1);
+	W(2) += F(2);
+	return W;
+}
+
+};
@@ -0,0 +1,68 @@
+#ifndef _SCENE_H
+#define _SCENE_H
+
+/*
+	scene haptique évaluée sur la carte a chaque periode de controle, sans attendre l'ordinateur
+	l'ordinateur envoie la scene une fois (messages SCENE et PATH de protocol.h), puis seulement les parametres qui changent.
+
+	la scene est un tableau fixe d'emplacements, chacun tenant une primitive et ses parametres, plus une reserve commune de points
+	pour les trajectoires: aucune allocation, la memoire occupée est connue a la compilation.
+
+	evaluate() donne l'effort generalisé dans l'espace de X (forces en x,y,z, couples sur les rotations et la pince)
+	que la carte ramene sur les moteurs par la transposée de la jacobienne (mci).
+	les longueurs sont en mm, les raideurs en unité d'effort par mm (ou par rad), les amortissements par mm/s (rad/s).
+*/
+
+#include "model.h"
+#include <stdint.h>
+#include <stddef.h>
+
+namespace scene {
+
+enum Kind : uint8_t {
+	EMPTY = 0,
+	PLANE = 1,		// normale(3) d raideur amort: le point reste du coté dot(n,p) >= d
+	SPHERE = 2,		// centre(3) rayon raideur amort: rayon negatif pour une cavité dont le point ne sort pas
+	BOX = 3,		// centre(3) demi-cotés(3) raideur amort: boite pleine alignée sur les axes
+	SPRING = 4,		// pose d'attache(8) raideur raideur_rotation amort: ressort et amortisseur sur les 8 composantes
+	PATH = 5,		// premier_point nombre_points raideur amort rayon: guide le long de la ligne brisée, libre dans un tube de ce rayon
+	kinds
+};
+
+static const size_t max_primitives = 16;
+static const size_t max_params = 12;	// parametres par primitive, suffisant pour SPRING
+static const size_t max_points = 64;	// points (x,y,z) partagés par les trajectoires
+
+struct Primitive {
+	Kind kind;
+	float params[max_params];
+};
+
+class Scene {
+public:
+	Scene()		{ clear(); }
+
+	/// vide tous les emplacements et les points
+	void clear();
+	/// ecrit count parametres a partir de first dans l'emplacement slot
+	/// si la primitive change de nature, ses parametres sont d'abord remis a zero; EMPTY libere l'emplacement
+	/// retourne faux (sans rien modifier) si l'emplacement ou la plage de parametres n'existe pas
+	bool set(uint8_t slot, Kind kind, uint8_t first, const float *values, uint8_t count);
+	/// ecrit count coordonnées dans la reserve de points, a partir de la coordonnée first (3 par point)
+	bool set_points(uint8_t first, const float *values, uint8_t count);
+
+	/// effort exercé par la scene sur l'effecteur a la pose X, de vitesse V
+	vec8 evaluate(const vec8 &X, const vec8 &V) const;
+	/// aucune primitive active: rien a calculer
+	bool empty() const	{ return active == 0; }
+
+	const Primitive & primitive(size_t slot) const	{ return slots[slot]; }
+
+private:
+	Primitive slots[max_primitives];
+	float points[max_points][3];
+	size_t active;	// emplacements non vides
+};
+
+};
+#endif
@@ -0,0 +1,78 @@
+#include "scheduler.h"
+
+/// vrai si l'instant a est atteint a l'instant b, malgré le debordement de l'horloge
+static bool reached(uint32_t a, uint32_t b)		{ return int32_t(b - a) >= 0; }
+
+int Scheduler::add(const char *name, Function run, uint32_t period, uint32_t deadline) {
+	if (count >= max_tasks || !period)	return -1;
+	Task &t = tasks[count];
+	t.name = name;
+	t.run = run;
+	t.period = period;
+	t.deadline = deadline ? deadline : period;
+	t.release = clock();
+	count++;
+	reset_stats();
+	return count-1;
+}
+
+void Scheduler::set_period(int task, uint32_t period, uint32_t deadline) {
+	if (task < 0 || size_t(task) >= count || !period)	return;
+	tasks[task].period = period;
+	tasks[task].deadline = deadline ? deadline : period;
+}
+
+bool Scheduler::poll() {
+	uint32_t now = clock();
+	// apres un depassement, les taches moins prioritaires pretes passent avant une nouvelle execution de la tache en retard
+	size_t first = overran < count ? overran+1 : 0;
+	overran = max_tasks;
+	for (size_t i=first; i<count; i++)
+		if (reached(tasks[i].release, now)) {
+			execute(i);
+			return true;
+		}
+	for (size_t i=0; i<first; i++)
+		if (reached(tasks[i].release, now)) {
+			execute(i);
+			return true;
+		}
+	return false;
+}
+
+void Scheduler::execute(size_t i) {
+	Task &t = tasks[i];
+	uint32_t start = clock();
+	t.run();
+	uint32_t end = clock();
+	
+	uint32_t time = end - start;
+	uint32_t latency = start - t.release;
+	t.runs++;
+	t.total_time += time;
+	if (time > t.worst_time)			t.worst_time = time;
+	if (latency > t.worst_latency)		t.worst_latency = latency;
+	bool late = !reached(end, t.release + t.deadline);
+	if (late) {
+		t.overruns++;
+		overran = i;
+	}
+	
+	// prochaine activation, sans rattraper en rafale les periodes entieres deja passées
+	// apres un depassement, strictement apres la fin: sinon la tache serait aussitot prete a nouveau
+	t.release += t.period;
+	if (reached(t.release + t.period, end) || (late && reached(t.release, end))) {
+		uint32_t missed = (end - t.release) / t.period + late;
+		t.skipped += missed;
+		t.release += missed * t.period;
+	}
+}
+
+void Scheduler::reset_stats() {
+	for (size_t i=0; i<count; i++) {
+		Task &t = tasks[i];
+		t.runs = t.overruns = t.skipped = 0;
+		t.worst_time = t.worst_latency = 0;
+		t.total_time = 0;
+	}
+}
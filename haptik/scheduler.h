@@ -0,0 +1,63 @@
+#ifndef _SCHEDULER_H
+#define _SCHEDULER_H
+
+/*
+	ordonnanceur coopératif a plusieurs fréquences
+	chaque tache est une fonction courte appelée periodiquement; poll() lance la plus prioritaire des taches dont l'activation est passée.
+	la priorité est l'ordre d'ajout: ajouter les taches de la plus rapide a la plus lente.
+	aucune tache n'est interrompue: une tache trop longue retarde les autres, ce que mesurent les compteurs de depassement.
+	une tache qui depasse son echeance n'est réactivée qu'a la limite de periode suivant sa fin, et les taches moins prioritaires
+	qui attendent passent une fois avant elle: une tache toujours trop longue ne bloque pas les suivantes.
+	
+	l'horloge est une fonction en µs (micros() sur la carte, une horloge simulée sur l'hote), les calculs supportent son debordement sur 32 bits.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+class Scheduler {
+public:
+	typedef unsigned long (*Clock)();
+	typedef void (*Function)();
+	static const size_t max_tasks = 4;
+	
+	struct Task {
+		const char *name;
+		Function run;
+		uint32_t period;		// µs entre deux activations
+		uint32_t deadline;		// µs apres l'activation pour terminer
+		uint32_t release;		// prochaine activation
+		
+		unsigned long runs;
+		unsigned long overruns;	// executions terminées apres l'echeance
+		unsigned long skipped;	// activations sautées parce que la precedente n'avait pas encore demarré
+		uint32_t worst_time;	// pire durée d'execution
+		uint32_t worst_latency;	// pire retard entre activation et demarrage
+		uint64_t total_time;	// pour la durée moyenne
+	};
+	
+	Scheduler(Clock clock) : clock(clock), count(0), overran(max_tasks) {}
+	
+	/// ajoute une tache de priorité inferieure a toutes les precedentes, retourne son numero ou -1 s'il n'y a plus de place
+	/// l'echeance par defaut est la periode
+	int add(const char *name, Function run, uint32_t period, uint32_t deadline=0);
+	/// change la periode d'une tache, a partir de sa prochaine activation
+	void set_period(int task, uint32_t period, uint32_t deadline=0);
+	/// lance au plus une tache, retourne faux si aucune n'etait prete
+	bool poll();
+	
+	void reset_stats();
+	size_t size() const					{ return count; }
+	const Task & task(size_t i) const	{ return tasks[i]; }
+	
+private:
+	/// execute la tache i et calcule sa prochaine activation
+	void execute(size_t i);
+	
+	Clock clock;
+	Task tasks[max_tasks];
+	size_t count;
+	size_t overran;		// derniere tache terminée apres son echeance, max_tasks si aucune
+};
+
+#endif
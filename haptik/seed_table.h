@@ -0,0 +1,4102 @@
+// genere par host/make_seeds (2048 poses, 285 rejetées hors de l'espace de travail), ne pas modifier
+static const size_t seed_count = 2048;
+static const int16_t seed_q[seed_count][8] = {
+	{-5841,-7974,-5366,-2602,-3085,-1852,-3227,-6043},
+	{-3492,-4149,-1899,-4977,-4555,-4173,-4238,-2835},
+	{-3412,-2347,-2992,-5180,-2305,-3450,-6230,-4603},
+	{-4047,732,-594,-2853,-5939,-7616,-8108,-2538},
+	{-3077,-587,-1315,-691,-3765,-4799,-4238,-2027},
+	{-3024,-8001,-9079,-5234,-3559,-352,-3348,-2608},
+	{-1308,-3935,-1211,-1320,-3082,-2842,-2447,-835},
+	{861,277,-2545,-4044,-3617,-2034,-2228,-2135},
+	{748,-2811,-2655,-7399,-8335,-3049,-3482,-362},
+	{-483,-1796,-3843,-4345,-4882,-2956,-1800,455},
+	{636,-1096,-3012,-9401,-7601,-2535,-2667,1101},
+	{-1938,-984,-751,-1517,-7625,-3257,-3261,268},
+	{845,-3369,-2653,-6731,-3392,-1026,-2258,580},
+	{1417,-992,-1935,-4768,-2687,-1011,-2100,-56},
+	{3211,-668,-1700,-7544,-5241,-1067,-1623,2295},
+	{3042,379,-1094,-5459,-3479,-514,-1996,3420},
+	{-7570,-6844,-6688,-1015,-4191,-2044,-1608,-3098},
+	{-2706,-6989,-9223,-3500,-2705,623,-416,-5130},
+	{-4687,-6892,-5677,-1372,-2935,-697,448,-1600},
+	{-6415,-5183,-7032,-1931,-4516,-972,-1324,-4606},
+	{-2420,-7242,-6712,-3742,-2704,-205,1393,-4009},
+	{-2076,-5953,-5977,-3336,-2826,-204,84,-1026},
+	{655,-3850,-3761,-6498,-2336,-518,346,442},
+	{960,-371,-1180,-2521,-3770,-1429,-1010,-34},
+	{1288,-1357,-2320,-6045,-4419,95,-940,1529},
+	{1270,-1406,-1516,-3882,-5335,-816,-1543,2745},
+	{1250,-1022,-1011,-1624,-5636,-453,-1118,2467},
+	{1593,-188,-1113,-4265,-5982,-1894,237,2525},
+	{2340,-2221,-2296,-3246,-5876,66,1326,3574},
+	{3227,-4752,-3728,-9326,-8760,-662,9,3024},
+	{3047,-920,-3498,-7980,-6515,-463,576,2819},
+	{3985,-729,-1005,-8628,-5607,-157,-666,3508},
+	{1260,-2109,-1675,-2210,-6383,904,770,3041},
+	{-5718,-8465,-7831,-896,-3493,2011,1520,-860},
+	{-1262,-6750,-5673,-3481,-2732,2124,1118,749},
+	{-363,-4833,-6616,-4567,-8843,1596,1049,1089},
+	{-272,-4021,-6848,-4262,-5276,1398,752,-1276},
+	{1860,-6058,-6783,-5036,-4229,2773,2675,1461},
+	{-60,-4151,-3751,-3196,-3027,1241,378,622},
+	{1761,-585,-2636,-1428,-2335,1778,1805,2175},
+	{3341,-5336,-4011,-6063,-4229,1460,2695,2617},
+	{1911,-4845,-3514,-4254,-5567,1260,2120,2852},
+	{2198,-4781,-3544,-2646,-7882,2645,1835,4203},
+	{2574,-104,-960,-600,-3051,2654,2686,4812},
+	{3235,-3163,-3080,-4050,-5278,2275,2568,3173},
+	{4720,-1495,-1594,-4764,-2485,1721,1751,4053},
+	{3546,-904,-2448,-2972,-3316,2989,2100,4003},
+	{3367,652,-605,-71,-2181,2474,2885,4682},
+	{-1997,-9064,-4933,-1537,-2299,2107,2928,-1303},
+	{1336,-8790,-8750,-5057,-4594,4500,4786,2818},
+	{2944,-5912,-5386,-5823,-8573,2688,3291,3578},
+	{2830,-3970,-8589,-6259,-3960,3701,3876,2956},
+	{3036,-5158,-5449,-5064,-6821,3399,3713,3169},
+	{3234,-5096,-7388,-7163,-4034,3913,4058,3563},
+	{3621,-4193,-2841,-2613,-3359,4088,4577,3441},
+	{4624,-1881,-5442,-5813,-5332,2946,3054,3578},
+	{3696,-4338,-3300,-4601,-6217,1609,3165,3852},
+	{3102,-6519,-11536,-6655,-6076,3948,4193,3991},
+	{2468,-5221,-5788,-3962,-2302,4534,5448,3961},
+	{3099,-2465,-5090,-3346,-5237,3463,3515,4659},
+	{3481,-2783,-3490,-1876,-3311,4557,4380,5689},
+	{3819,-4067,-2961,-2156,-3639,4226,4044,4491},
+	{4619,-3295,-4535,-2553,-3612,5850,6419,6701},
+	{4210,179,-1891,-4009,-5501,2146,3449,6433},
+	{-4085,-1662,-2344,-2258,-2138,-6759,-4061,-3114},
+	{-5431,-3712,-2662,-211,1365,-1480,-918,-4602},
+	{-5946,-3171,-1267,-3668,-684,-4751,-6583,-7308},
+	{-5403,242,-985,-982,-945,-6828,-8774,-6048},
+	{-5158,-2191,-2125,-684,913,-2022,-1323,-6042},
+	{-3126,-5163,-7168,-686,668,-129,-109,-5715},
+	{-4751,-1780,-1955,-580,-118,-1171,-3221,-4158},
+	{-2208,-1644,-1443,-1980,-872,-7564,-3512,-3726},
+	{-396,-3776,-5609,-3443,-1108,-1975,-143,-3595},
+	{-1255,-2013,-4709,-3080,-1480,-864,-761,-1770},
+	{-4332,-1966,-1235,-2205,-1492,-2374,-2065,-2477},
+	{-889,-296,-1193,-948,668,-1360,-2546,-2454},
+	{-788,331,-668,-3595,-1636,-3953,-3135,-2396},
+	{-35,-2814,-1461,-2144,919,708,-162,-921},
+	{-497,-1161,-911,-2344,-1238,-1684,192,-43},
+	{253,-379,-1197,-1983,-395,-924,-1564,-1906},
+	{-3271,-4528,-6420,-272,-1573,142,505,-997},
+	{-5472,-7863,-3129,-808,1021,1506,1503,-4361},
+	{-2948,-7035,-5334,-1349,1078,1250,650,-3472},
+	{-3122,-4651,-5548,-1840,-59,1979,645,-1533},
+	{-612,-5331,-5433,-3568,-65,2716,1422,-1105},
+	{69,-8044,-10475,-4811,-1531,3031,3379,-1958},
+	{-42,-5063,-5173,-2919,668,1425,2203,-1450},
+	{-384,-4906,-5597,-5987,-1968,1563,521,-543},
+	{-244,-2396,-3034,-2279,-14,1308,2071,-525},
+	{305,-4158,-2551,-870,-1413,2016,2204,1168},
+	{883,-3034,-2262,-1191,631,1839,1511,-26},
+	{393,-1907,-2575,-862,641,1873,513,271},
+	{2091,-597,-772,-2526,-2,-479,1020,1024},
+	{2973,-1399,-1896,-1394,1069,3036,3616,1571},
+	{2951,-676,-981,-2349,185,3002,2308,3031},
+	{4480,-64,-1068,-1913,569,2772,3800,3810},
+	{2898,-1961,-2004,-1980,-1206,3179,4835,4450},
+	{-1957,-4809,-6230,-203,-1649,3455,3375,920},
+	{1699,-4566,-6548,-2101,-1341,5342,4422,2861},
+	{2017,-2838,-4525,-1099,-1328,5372,4516,2701},
+	{2471,-2986,-6157,-4166,-1674,3778,3097,2361},
+	{4159,-4085,-5344,-5080,-1436,3672,4883,2846},
+	{3005,-2636,-4576,-1301,-93,4991,4190,2674},
+	{3123,-2222,-2900,-1472,661,4712,4635,2037},
+	{1658,-4643,-2978,-385,-1491,3715,4550,3174},
+	{1907,-3185,-5701,-1926,-614,5043,4596,3626},
+	{3519,-2481,-3728,-1242,1612,5244,4856,3282},
+	{3548,-1760,-4265,-2748,-720,4453,4382,4357},
+	{3881,-806,-649,-670,360,4385,3565,4541},
+	{4705,-725,-1214,-1822,-1569,4270,4256,6150},
+	{4251,-238,-1483,-497,1401,5101,4739,4156},
+	{4697,743,-1268,-1401,-493,3635,3181,4491},
+	{259,-4880,-5565,-223,-798,4475,4961,2318},
+	{676,-7139,-9433,-2906,-2011,5321,5786,2796},
+	{2139,-3946,-3863,-751,-735,4407,5044,1951},
+	{1983,-3663,-4499,-456,2381,5239,5232,701},
+	{2263,-4694,-5858,-1765,1644,6026,6027,2062},
+	{3453,-3776,-5301,-2282,61,4259,5428,1455},
+	{3280,-3756,-2781,-2234,-558,4115,4980,2950},
+	{3419,-3445,-3536,-1585,-703,4916,6173,3249},
+	{4051,-2516,-2539,-2813,-856,4515,5745,3658},
+	{2139,-5295,-4726,-1717,-967,4934,6455,4160},
+	{3258,-4589,-9977,-3163,-744,6359,5919,3687},
+	{3441,-2681,-2200,-169,-496,5176,5138,4917},
+	{3725,-4046,-4835,-2479,-398,5795,5907,4917},
+	{4602,-3097,-2999,-816,40,6162,6083,5111},
+	{4716,-2893,-2009,-858,-323,5595,6631,5804},
+	{4630,-1084,-2060,-1388,523,5039,5868,3753},
+	{1022,-587,-1748,-49,-475,2429,2326,3121},
+	{-8131,-3256,-1692,2292,988,-685,-2628,-7041},
+	{-6165,-1611,-1126,3443,2534,-399,-1820,-7845},
+	{-8247,-839,-1578,3504,2499,-682,-2891,-10019},
+	{-5163,-4917,-4684,1510,3294,411,96,-7776},
+	{-4963,-4572,-3452,1537,2085,466,545,-8800},
+	{-3841,-4068,-2982,1027,2360,2035,934,-6233},
+	{-5151,-2681,-3094,1735,2615,-95,372,-5549},
+	{-3365,-2164,-2121,1691,2687,-653,-79,-5346},
+	{-7194,-5177,-6004,2945,3226,2709,1209,-5098},
+	{-3786,-4579,-2548,194,-681,304,-17,-1519},
+	{-4830,-3205,-3050,2130,3201,289,1004,-4149},
+	{-2376,-2606,-4879,1012,71,2141,1403,-3616},
+	{-1270,-1328,-879,336,-247,-700,-745,-992},
+	{-1384,-961,-1615,2025,981,1268,830,-649},
+	{-661,-204,-1011,890,1235,1074,-835,-1264},
+	{-1510,-2617,-1286,1383,379,2091,1498,675},
+	{-6839,-5711,-5952,1352,1383,1784,2453,-3654},
+	{-5680,-3749,-1947,1840,1310,655,1686,-3709},
+	{-5226,-3331,-3847,4112,3339,3008,1893,-5592},
+	{-3918,-4135,-4675,1918,2496,2009,1666,-3645},
+	{-2565,-5058,-3969,220,481,2635,2262,-4133},
+	{-2694,-3591,-3260,1418,3159,1879,2340,-3853},
+	{-1030,-1334,-3546,1952,1728,2398,1838,-2890},
+	{-2479,-1935,-3119,3663,3040,3051,2224,-2858},
+	{-7662,-5643,-6463,2777,1619,2652,2372,-2772},
+	{-7430,-5477,-4356,1472,1685,389,1852,-2087},
+	{-4264,-3690,-3368,1767,1220,2004,1990,-2378},
+	{-3622,-2576,-1625,2213,3029,133,1811,-1659},
+	{-2863,-3836,-2912,728,1880,1932,2785,-1057},
+	{199,-1654,-1718,1180,786,3122,2503,979},
+	{-2304,-1625,-832,2609,3401,686,2291,-1223},
+	{-686,88,-1058,1562,2765,3257,1656,-546},
+	{-3063,-4709,-2734,1456,3311,4128,3327,-3143},
+	{-3249,-4421,-2885,3436,2710,4068,3120,-842},
+	{-3626,-1718,-1195,4446,3083,4061,3465,-984},
+	{-2463,-7100,-5267,520,2839,3991,4030,-3160},
+	{-890,-5564,-7108,482,2304,5279,4286,-1911},
+	{-2452,-4432,-4061,2143,595,4002,3051,-1315},
+	{105,-3665,-4845,1259,2708,4538,4212,-588},
+	{-2007,-1280,-2921,2962,2420,3310,3030,168},
+	{-687,-8473,-6032,143,-1219,4501,3290,1585},
+	{-970,-4775,-5087,125,302,4207,3413,197},
+	{-1081,-4042,-3276,1055,1486,4158,2844,860},
+	{-74,-2676,-2542,737,-926,3277,2270,1394},
+	{458,-6424,-3899,-20,-2669,3844,3813,1821},
+	{103,-3071,-3445,858,19,3596,3472,1006},
+	{1141,-2031,-1492,216,1775,3925,3185,837},
+	{1782,-1766,-1601,2040,244,5226,4405,3398},
+	{-1605,-8776,-6519,435,1631,3945,4607,-2481},
+	{-6218,-7392,-8712,2723,2963,5143,4534,-2353},
+	{-417,-4408,-4557,1209,2046,4058,4812,1296},
+	{26,-2847,-3459,1375,1382,5479,5083,2610},
+	{419,-5247,-6740,637,3372,5634,6126,-181},
+	{1318,-2225,-2206,958,2752,3875,4685,446},
+	{1407,-1192,-643,3009,2279,4468,4950,1872},
+	{561,-2791,-3180,1730,793,6092,5827,3236},
+	{3234,-3278,-3485,503,1742,7665,6836,4914},
+	{3357,-363,-862,3183,3106,7401,7396,5398},
+	{3289,380,-595,947,55,5434,5319,5099},
+	{3383,-1820,-1603,1419,1199,5672,6576,5370},
+	{4103,-771,-949,184,2169,5729,5559,4022},
+	{4678,-735,-1513,-24,2474,7190,7414,5015},
+	{3444,-549,-895,905,1871,5279,5187,4489},
+	{-2770,-6527,-5820,1397,3430,4204,3890,-3203},
+	{-9549,-7431,-5020,5055,5586,5412,3454,-6084},
+	{-10019,-6891,-5632,2986,4152,1715,1423,-9637},
+	{-7697,-1234,-1213,2934,3599,-2774,-2085,-11675},
+	{-7692,-5607,-3948,4354,3847,4815,2965,-6578},
+	{-6086,-1821,-1016,2766,4000,-1985,-1775,-8490},
+	{-5876,-1518,-1279,4249,3984,2269,821,-6987},
+	{-3128,-860,-2360,3479,3500,3039,1466,-5093},
+	{-7700,-2960,-1249,6711,5487,4691,3178,-5041},
+	{-4692,-4564,-3905,3707,4759,4974,3196,-2462},
+	{-5889,-3094,-2008,3770,3616,3048,3497,-2569},
+	{-4480,-1701,-2128,5552,4394,3629,2857,-1368},
+	{-3471,-933,-661,3562,3604,2225,4,-2431},
+	{-2548,-2266,-2994,3441,4348,2578,2774,-3192},
+	{-1341,-1579,-1132,3441,3832,4414,2671,-1550},
+	{-210,-602,-862,3624,5157,5097,2952,246},
+	{633,-1313,-1355,2154,4156,3013,3616,-493},
+	{-7821,-7195,-6796,3000,3690,3833,4028,-7298},
+	{-6349,-6530,-2472,4864,4265,4479,4326,-3703},
+	{-6657,-3206,-961,5051,5640,3635,3662,-10241},
+	{-5492,-5644,-3380,2866,4620,4046,4163,-4820},
+	{-4707,-8812,-8039,1551,3700,5162,4667,-4988},
+	{-3234,-3215,-4280,4038,3977,4726,4253,-3676},
+	{-3867,-2502,-1513,5027,5006,5049,4631,-4169},
+	{-2152,-3152,-3506,4685,5445,5055,5273,-3586},
+	{-7571,-8943,-5064,3896,4102,4515,5108,-3407},
+	{-2198,-3396,-4058,4046,4554,5406,4770,-2350},
+	{-2119,-847,-1046,5695,5002,4466,4038,-555},
+	{-1864,-3738,-3702,2942,3616,3838,4526,-521},
+	{468,-1879,-2754,2366,3676,3445,3758,-1392},
+	{682,-1729,-1278,3006,3623,4450,4623,953},
+	{158,-1039,-868,3585,3786,4551,5589,2113},
+	{-188,-1027,-754,4605,5936,5517,5665,37},
+	{-5387,-6556,-4538,3835,5725,5884,5264,-6444},
+	{-4120,-3601,-1012,5987,6785,6139,5789,-2563},
+	{-3462,-3094,-931,5074,6062,5703,5616,-1632},
+	{-3332,-3996,-2524,3462,6079,5792,4379,-4791},
+	{-2177,-4360,-1472,4797,5871,5965,5699,-1399},
+	{-2453,-4166,-6709,3578,4224,5568,4348,-1455},
+	{-2961,-2028,-1411,5265,5691,6449,4770,-1617},
+	{-5975,-5109,-2953,6092,5492,6128,5124,-1233},
+	{-2154,-1659,-1521,5530,4670,5946,5648,176},
+	{-809,-1107,-758,5354,5741,5662,5593,-626},
+	{-704,-693,-946,5385,5538,5518,5300,135},
+	{145,117,-881,4245,4593,5817,5806,1857},
+	{1806,-2255,-2182,1803,3943,6133,4800,2317},
+	{2193,-1442,-764,3618,4597,6534,5858,2601},
+	{1780,654,-603,4052,4328,5689,5067,940},
+	{-638,-3265,-3181,3637,5287,6563,5951,-1020},
+	{-2602,-5139,-3082,4476,7690,7441,6416,-3362},
+	{-1941,-4596,-4078,5470,7693,7497,7138,-2165},
+	{-3046,-2505,-1101,6487,7836,7414,6342,-1483},
+	{-1249,-5702,-6326,3757,6322,7292,7464,-2059},
+	{-1152,-3340,-2955,3870,6280,6506,6660,-2398},
+	{808,-3252,-4136,2235,4378,5941,6514,-503},
+	{-957,-2684,-756,5658,6982,6624,6744,-1429},
+	{-804,-1784,-805,7416,8562,8980,7945,884},
+	{-241,-2781,-1602,5445,6898,7790,6672,894},
+	{-764,-1600,-1975,3533,4335,5937,6110,915},
+	{206,-628,-1495,4960,5380,6157,6273,2184},
+	{1614,-2227,-1509,2624,5850,7759,6725,1251},
+	{1752,-1767,-2257,4042,5030,7455,7774,2796},
+	{2350,-883,-1082,3988,3915,7475,7075,4412},
+	{1737,-414,-1395,5286,5768,7909,7175,2785},
+	{-4085,-2661,-586,3261,3615,2908,2427,-4896},
+	{-5894,-45,440,-844,-2650,-4297,-3864,-2482},
+	{-3646,51,-217,272,708,-2252,-5788,-3302},
+	{-2653,992,1650,1762,703,-5206,-3466,-2375},
+	{-2142,1654,1223,-5260,-2499,-6534,-8056,-3226},
+	{-488,-431,-66,-4330,-3693,-6345,-5044,-1829},
+	{1565,753,1842,-3875,-3527,-5135,-4158,-1164},
+	{-1362,2330,2027,607,-929,-3257,-5225,-1258},
+	{-891,2141,2121,224,-822,-4779,-4672,-574},
+	{-777,143,745,-217,-4972,-3629,-4003,266},
+	{-814,1156,-215,-3205,-2547,-3098,-4336,29},
+	{-1256,1479,1614,-709,-2571,-5106,-4212,416},
+	{175,1805,1661,-1080,-5195,-3357,-3663,1563},
+	{2904,1087,-202,-9226,-8731,-3016,-6009,3364},
+	{895,1437,596,-3771,-2439,-2482,-5139,1031},
+	{1606,1758,-199,-4789,-6043,-3087,-3747,1685},
+	{719,397,1972,-3288,-2298,-3857,-3392,-659},
+	{-2103,-1152,512,-337,156,-2433,-828,-981},
+	{-2334,287,351,359,-1124,-4672,-2899,-2599},
+	{-2460,1517,1616,1104,842,-3042,-3005,-1714},
+	{-745,263,-488,-2811,-741,-1786,-3267,-2681},
+	{-523,806,2194,-711,330,-3712,-3270,-1599},
+	{1956,1099,1366,-3460,-1483,-2855,-2162,-1583},
+	{2535,1388,2142,-2042,-1274,-2942,-2340,501},
+	{891,-228,1315,-1148,-753,-1810,-516,840},
+	{808,709,944,-587,-3143,-1912,-381,2103},
+	{767,1171,74,-588,-3085,-2654,-1695,1812},
+	{1804,2205,-141,-8442,-6218,-3308,-2919,2254},
+	{1879,1677,1484,-2724,-1746,-1559,-1288,2338},
+	{3168,474,1736,-3100,-4959,-1982,-561,2043},
+	{3066,782,1267,-3003,-6183,-3806,-1548,2869},
+	{2881,1558,2334,-3376,-3800,-2734,-459,3699},
+	{4469,2036,1329,-4331,-3390,-1146,-1000,3243},
+	{-559,-1856,-145,-147,-37,-135,464,-1666},
+	{110,-1715,-305,-281,534,-426,-53,-1036},
+	{230,1204,1339,761,625,2,1094,658},
+	{423,225,1310,498,565,350,1753,2085},
+	{1452,1143,2232,1835,527,-33,469,1228},
+	{1129,1577,1245,1435,706,1078,1471,1609},
+	{706,1610,2028,1158,-45,-608,639,2265},
+	{1357,894,1044,1623,977,1002,1863,2267},
+	{2061,-880,-215,-1427,-5798,691,622,3407},
+	{1318,197,761,1392,-1357,2152,981,2577},
+	{2630,547,-77,-2155,-3410,1030,1084,3084},
+	{2878,2229,2102,904,-2308,402,120,4387},
+	{4645,797,-519,-5690,-2825,1958,1278,4860},
+	{3583,911,165,-3796,-2129,-313,-159,3124},
+	{2918,992,-48,-3562,-4531,-30,182,4266},
+	{2402,-374,-203,399,-406,2856,1961,3808},
+	{1806,-545,941,521,-76,1418,2531,2650},
+	{2597,651,789,-572,-1185,2154,3550,4106},
+	{2179,1655,2678,2211,514,2282,2365,2168},
+	{3043,-1715,-57,-61,-1141,2458,3160,2542},
+	{3591,1177,1207,1112,-44,2517,2815,3855},
+	{4571,1344,2608,-392,-42,2073,2864,3987},
+	{4665,1442,2112,-2034,-4255,601,2689,4220},
+	{4726,1468,279,-908,-604,3334,2249,4824},
+	{3774,783,-223,-634,-1128,3771,4907,5409},
+	{4026,1005,1261,1082,-4,4258,3495,4863},
+	{2495,2178,1376,195,-1904,2091,2590,4855},
+	{4092,375,113,481,246,4502,6058,6466},
+	{4298,-658,-585,-1660,-2493,3255,4990,5726},
+	{4159,-335,-384,539,249,6120,5953,5412},
+	{4689,459,452,-2123,-4052,889,2665,5328},
+	{2411,698,-227,240,998,3998,3899,2893},
+	{-6022,-330,122,3077,2333,1080,207,-2610},
+	{-7125,16,401,3189,2969,-1041,-2223,-5127},
+	{-4556,1039,769,1468,1890,-4184,-4417,-8115},
+	{-3860,730,-204,1398,1381,-2298,-3063,-5763},
+	{-3335,-53,448,720,1308,-3362,-2638,-4572},
+	{-1384,902,1134,1117,2777,-2204,-1884,-3819},
+	{-1606,1561,1504,3138,4105,456,-170,-3906},
+	{563,2136,1657,9,1282,-2830,-3259,-2418},
+	{-2499,-387,530,949,1514,-1851,462,-1779},
+	{-3665,-64,1035,3356,3354,282,533,-1461},
+	{-1549,2242,2115,2237,1814,-876,-727,198},
+	{-1092,1443,683,1739,1188,-1174,-1280,-1734},
+	{489,-22,728,713,1655,490,527,-735},
+	{-526,989,2101,2105,2107,301,442,611},
+	{280,1511,2653,1160,3912,801,-243,-1775},
+	{-453,1614,2796,3386,3292,-952,719,-192},
+	{-91,-609,1004,2560,1589,2674,2598,103},
+	{-521,519,777,2896,2573,2461,2227,836},
+	{-3396,849,2044,2521,2743,-709,998,-329},
+	{885,-1145,678,1477,1305,1690,1816,972},
+	{2189,-77,-143,318,2087,2212,1801,560},
+	{2873,573,-38,668,2446,1228,2417,440},
+	{1740,1671,1289,1142,3061,1715,1427,93},
+	{258,1143,1293,1359,1871,76,1118,999},
+	{-546,-1627,-578,1642,2091,2599,4102,1732},
+	{782,2012,2293,1764,1137,2053,1352,2219},
+	{324,2222,1936,1237,1035,1263,1333,1690},
+	{1222,2267,2696,2238,1957,1898,1158,1883},
+	{2181,857,2659,2830,2404,1781,2470,2121},
+	{1717,1021,1869,671,1986,965,2641,2581},
+	{3563,1611,2196,1659,1866,2329,2581,2225},
+	{-160,-170,713,2993,1867,2753,3220,-5},
+	{319,392,1828,3598,5800,4064,3365,-816},
+	{1563,462,-454,3450,3635,5375,4212,1850},
+	{752,1248,74,3479,2618,2939,2320,105},
+	{1886,1562,1524,2649,4192,3419,2880,446},
+	{2551,549,776,3199,4022,5248,4474,1575},
+	{3151,1964,1123,2755,3121,4408,4218,2883},
+	{3307,2274,1585,1749,2996,3441,2666,1864},
+	{1699,1407,1308,3244,2563,3315,3025,3068},
+	{2592,502,1225,2477,1697,3759,3928,3510},
+	{2874,926,1433,2785,2714,4408,3912,3452},
+	{2181,1482,1538,3206,1585,4150,4456,3327},
+	{3157,1600,1625,2321,2559,4593,3518,4364},
+	{3890,935,352,597,2845,4968,3890,4071},
+	{4401,1570,1501,1534,2643,5102,4047,4953},
+	{3263,1852,2666,2735,2400,3527,4308,4665},
+	{4277,1680,2018,2130,2357,3884,4511,4681},
+	{1967,-796,-112,1360,3109,3581,4617,2203},
+	{1992,-596,-544,2364,3650,5255,4901,603},
+	{1856,-155,98,3562,2581,5381,4525,2193},
+	{2354,604,1234,1701,2394,2859,4582,3172},
+	{3786,-645,-234,2603,2982,5893,6377,3300},
+	{2966,1138,1412,2566,3750,4139,5338,3112},
+	{4444,1351,1303,1451,3048,4901,4889,2788},
+	{2993,999,443,2761,2506,5583,5241,3536},
+	{2765,-13,194,2356,3355,4852,5644,3922},
+	{3614,1211,2288,3044,3232,5335,6246,5034},
+	{3489,2303,2077,2311,2031,4765,4587,5033},
+	{3778,1535,2094,3242,3654,5461,6193,4759},
+	{4170,891,-455,2495,3406,5812,6234,3717},
+	{4194,1129,1572,1473,2116,4529,5723,4238},
+	{4221,1563,875,1406,2811,5300,4512,3992},
+	{-6404,692,518,3601,2368,-2297,-2617,-4030},
+	{-8345,-1384,314,6088,5463,1916,11,-6778},
+	{-6336,-234,1053,3719,5252,-15,-570,-9133},
+	{-7566,1437,1275,3740,2486,-5357,-8056,-9012},
+	{-6314,1881,3136,5243,5503,-1794,-3982,-8512},
+	{-4138,-886,539,4134,5498,2415,755,-5216},
+	{-5766,201,1499,5914,5802,1357,-547,-7140},
+	{-4253,1963,3011,4503,3854,-1606,-1780,-3438},
+	{-6357,119,1095,3776,1579,-1781,-3325,-3230},
+	{-3375,1349,1470,3691,2853,-126,-771,-1311},
+	{-3557,1878,2167,4111,2955,-2905,-2294,-3185},
+	{-5231,1895,2608,4604,4170,-149,-512,-2894},
+	{-2764,440,1865,5378,4836,2121,757,-2663},
+	{-1876,1046,1353,3935,2473,937,-828,-2010},
+	{-859,1880,2586,4229,3772,2175,1204,-618},
+	{-1067,2148,2417,4707,3850,1699,298,-445},
+	{-3248,-1659,-289,3924,3090,2372,1373,-2983},
+	{-2881,-2465,-297,4179,3169,2586,2223,-3192},
+	{-3826,-1129,-204,4190,5262,1501,2690,-3417},
+	{-2960,1390,1300,4931,5420,1964,2019,-2522},
+	{-2575,114,447,4250,3263,2661,2144,-1965},
+	{-1765,-194,1,4895,4347,2945,2865,-1606},
+	{-1536,-81,732,4035,5154,2020,1959,-3620},
+	{-860,599,1021,5203,5134,3300,3109,-999},
+	{-859,1960,780,4611,5015,3498,2313,-953},
+	{-846,1585,2473,4532,4322,3006,1908,235},
+	{142,1647,2604,3822,1970,1597,1746,868},
+	{-2615,2309,3343,5881,4987,2731,2248,-129},
+	{178,1419,1280,3635,4173,3967,2452,442},
+	{307,922,1749,4659,4862,3754,3503,-129},
+	{1213,1706,2845,4343,4984,2985,2554,424},
+	{1519,2113,2769,4012,5127,3388,3261,811},
+	{-3115,724,1811,6706,5722,4077,2283,-3311},
+	{-1335,-10,-177,5370,4864,4230,4139,-369},
+	{-1152,159,-66,4929,5223,4788,4683,-991},
+	{-1298,289,529,5824,5813,5776,5907,545},
+	{41,1118,2354,6759,5580,5092,3798,792},
+	{272,447,-386,4578,5615,5500,4425,-411},
+	{782,695,2247,5469,4672,4543,4578,311},
+	{657,1834,2328,6573,5699,5679,4435,932},
+	{-168,689,1425,4745,4325,4215,4650,1187},
+	{-868,-1362,-393,5444,3692,6134,5198,1442},
+	{390,410,198,4725,4924,4179,4934,2015},
+	{777,1413,1421,6043,4721,6165,5155,1879},
+	{1073,909,1112,4275,5164,6247,5487,2444},
+	{2327,763,2481,4656,4135,5159,5405,2660},
+	{2224,914,1256,3731,5118,6838,5561,2849},
+	{1260,1875,2173,3622,2133,4105,3485,3334},
+	{4107,1826,1735,3915,4350,6745,6004,3442},
+	{530,-2490,-428,4198,5105,6300,6472,464},
+	{201,-1428,25,6526,5606,8225,7569,2759},
+	{-771,-147,1,6597,5432,7222,6496,1465},
+	{1401,-217,505,4695,5080,5587,6191,520},
+	{1740,-1071,458,4525,5079,7014,7071,2506},
+	{2778,-96,1505,5059,5499,7376,7292,2889},
+	{2592,1017,828,3695,5763,6895,6232,2290},
+	{2707,1039,2908,5682,5829,6118,6551,3001},
+	{3513,922,1409,4598,4629,6746,7287,3758},
+	{3081,1348,2382,3613,4628,5986,6658,3962},
+	{3804,1612,2639,4924,5287,6407,7547,4548},
+	{4084,1543,3025,3978,3371,5988,6694,5204},
+	{4729,1076,267,4526,5545,9835,8972,6413},
+	{4177,1358,524,5297,4597,8079,8280,6098},
+	{4716,1837,417,5007,5497,8482,8115,5243},
+	{3990,2019,575,4872,5835,8194,7616,4792},
+	{-2818,739,2601,5637,6873,4051,3028,-2562},
+	{-3455,1612,3982,6586,6165,845,659,-4430},
+	{-2029,1630,3001,5470,7090,2413,1808,-3244},
+	{-1981,1206,2379,6841,6999,3644,3235,-3089},
+	{-1280,-67,783,5049,7023,5555,3926,-2373},
+	{-303,1259,1644,5384,6523,4346,3623,-1957},
+	{-705,1541,400,6295,5868,3942,3129,-2880},
+	{-2657,1007,2574,5298,6196,1594,2581,-1358},
+	{-142,1307,2037,4353,6264,4302,3100,-1024},
+	{-988,1507,2360,6865,6247,5548,5265,-647},
+	{-435,1519,648,5933,6208,5664,4674,-981},
+	{361,1978,1684,5966,6441,6270,5179,793},
+	{384,521,2601,6718,6204,4967,5087,-99},
+	{585,2067,2268,5008,6017,5829,4395,1403},
+	{570,2271,1665,6329,6792,6314,4562,131},
+	{-2296,842,3175,8204,8373,5640,5449,-248},
+	{-1547,-1710,243,6724,6894,6490,6104,77},
+	{-877,230,1674,6825,8489,6749,5949,-1074},
+	{-755,814,3036,8172,8486,6288,6451,1},
+	{50,-189,112,4756,6985,5909,5771,-1251},
+	{1657,786,579,5391,7012,6138,5874,228},
+	{1539,1526,824,6111,6572,6903,5910,-278},
+	{2170,2151,1597,6511,7357,6090,5734,248},
+	{1200,1532,2516,7066,8551,6678,6582,368},
+	{451,1056,2644,7197,7468,6979,6522,1527},
+	{-429,1324,2497,6912,6735,5093,5684,1826},
+	{911,1560,1756,6790,6423,7171,6729,1178},
+	{1275,-87,782,4558,6591,6781,5723,1259},
+	{1907,-221,-166,4322,6274,5438,6109,761},
+	{2172,2133,2700,6759,6369,6440,6105,1833},
+	{1846,2248,3693,6660,7271,5641,5737,1804},
+	{-760,-1875,-432,6109,6483,7183,6574,757},
+	{-1585,-1385,-366,7247,8237,7560,6906,-201},
+	{-2096,-1248,-165,7569,7018,8096,7934,982},
+	{-2215,-540,747,7345,6861,7681,6481,546},
+	{-29,433,978,8574,9167,8667,6841,-46},
+	{-1,-1019,-300,6332,8550,8237,7601,-1003},
+	{9,918,371,7200,7502,8396,7051,652},
+	{2715,1539,1130,6004,7419,7723,7910,1863},
+	{1984,154,528,6316,6912,7999,6969,2051},
+	{1840,-157,1465,7102,7603,8120,7872,2892},
+	{-927,785,1412,7462,6501,7411,6988,2152},
+	{1773,1549,2770,7811,7093,7790,7966,3748},
+	{2371,253,-482,5734,6465,8037,7526,3031},
+	{2567,-328,-164,4530,6712,8670,7221,3400},
+	{2825,73,750,5077,6417,7255,6858,2335},
+	{2619,1134,738,5780,7938,8869,7924,2222},
+	{678,-467,548,6367,7611,7580,8022,2456},
+	{221,-961,1013,7691,8257,8621,8206,2139},
+	{1044,-39,1085,7059,8364,8166,8227,2128},
+	{800,2285,3865,9734,10445,9299,8155,710},
+	{2244,984,2225,7467,7779,8301,8027,2071},
+	{2671,817,1597,5960,8900,9645,8086,2337},
+	{2709,1345,1657,7387,8678,8746,9342,2773},
+	{2829,1733,1656,6881,8719,7904,8026,2018},
+	{2170,2255,3055,7994,8719,8963,8791,3340},
+	{2620,1102,2206,7366,8377,10313,9361,4182},
+	{1190,1347,2504,9257,8500,10306,9733,3920},
+	{3436,1833,2244,5792,7557,7788,8569,4014},
+	{3605,2080,3885,9140,9414,11184,11235,5484},
+	{3987,-232,434,4465,7099,8901,9039,3892},
+	{4186,1554,2810,6652,8057,9002,8674,4834},
+	{4089,1743,967,5859,7678,10189,8719,4560},
+	{-2292,2331,3193,-488,1374,-4752,-6683,-4146},
+	{-3943,2617,1738,60,-2095,-8894,-8432,-1520},
+	{-1275,2855,4133,-1369,-1822,-7547,-7445,-1813},
+	{-2416,4806,4449,2321,-271,-10353,-10583,-3227},
+	{-423,2396,2204,-3034,-2204,-9489,-7973,-1324},
+	{1565,2384,1531,-2709,-3605,-5729,-7617,94},
+	{613,3504,3488,-1223,-1517,-5024,-8423,-478},
+	{-81,3952,1952,998,-158,-5732,-7955,-2857},
+	{2985,3461,3596,-3809,-1257,-5836,-6816,646},
+	{1792,2945,1160,-4255,-6094,-5757,-7261,1608},
+	{2519,3756,4700,-2657,-4695,-11384,-6984,1796},
+	{2387,4746,4497,-1863,-4794,-11193,-7381,1554},
+	{3495,4716,4108,-3846,-4431,-6521,-5914,2985},
+	{3739,2968,3137,-5937,-4921,-7269,-6373,1296},
+	{4057,5935,4761,-2027,-2159,-6016,-8766,2455},
+	{4536,6091,4233,-6070,-7170,-7557,-8245,3419},
+	{4018,4688,4384,-2762,-2769,-4247,-5665,2837},
+	{-147,2500,3727,952,-288,-6415,-3572,-181},
+	{1701,2898,3040,-1468,-1461,-3176,-3945,558},
+	{1394,3343,3862,-1289,-1785,-6973,-3523,1429},
+	{2179,3382,1251,-2747,-2807,-4016,-5045,1189},
+	{2266,2495,2411,-3504,-3058,-6479,-3389,-152},
+	{3746,2633,2490,-3432,-4952,-5134,-2665,2433},
+	{3765,3613,3353,-2749,-2687,-3082,-882,2412},
+	{2119,4936,4854,495,-525,-3087,-2174,2486},
+	{2896,3276,2868,-3633,-4973,-4373,-4359,2598},
+	{2209,4272,3977,-3399,-4024,-5670,-3421,2770},
+	{1889,5201,4286,-79,-3808,-6164,-5527,3534},
+	{3130,5020,4832,-1834,-3719,-4822,-2729,3685},
+	{3291,3485,3443,-3136,-4399,-3816,-1933,4155},
+	{3981,4391,4245,-2363,-4520,-3477,-1506,4952},
+	{3138,4427,4612,-1091,-2193,-4612,-3209,3005},
+	{4488,6073,4626,-37,-2104,-3047,-2661,4478},
+	{2619,3609,3219,-648,-309,-588,-2076,2177},
+	{2673,3678,3401,-1621,-1838,-2976,-3917,2215},
+	{2565,4928,4835,-637,-548,-2187,-2195,2907},
+	{3057,2993,2225,-1357,-1592,-537,-847,2273},
+	{4570,3189,2190,-2934,-3043,-1059,-1009,2927},
+	{3383,4674,4585,-2472,-275,-2605,-3279,2370},
+	{4330,4890,3206,-2083,-2487,-2691,-3449,2329},
+	{1791,3605,2628,1408,-610,-526,-567,3278},
+	{2978,2568,2355,-1601,-5530,-2889,-2473,3495},
+	{3779,4324,4511,-407,-1453,-1596,-964,4196},
+	{2216,5003,4562,2086,-935,-2742,-2254,3321},
+	{4134,3428,2334,-765,-166,473,-784,3869},
+	{4755,2473,3560,-2505,-4234,-3029,-1524,4098},
+	{4521,3427,2584,-3950,-3707,-2824,-870,4257},
+	{4567,4244,3343,-1265,-1095,45,-494,4592},
+	{3451,2497,3045,-1855,-1920,-1593,-453,1352},
+	{2176,2368,2567,-202,-2043,-2234,-415,1878},
+	{3745,3485,4332,-719,-1783,-1896,-213,4152},
+	{3356,3849,2450,189,-42,181,-261,3358},
+	{4209,2727,2397,-3050,-1425,-993,649,3607},
+	{4526,2517,467,-1013,-337,2102,2227,2940},
+	{4602,2517,2420,-614,-1103,932,628,4292},
+	{4658,3727,3930,-601,-706,92,964,3280},
+	{4535,2761,1920,-573,-830,1926,1651,4339},
+	{3907,2549,1852,-1663,-3459,-388,1378,4954},
+	{4243,3504,3654,1973,-382,2512,1735,5413},
+	{4004,3622,2608,1024,-110,780,1608,4455},
+	{4264,2388,730,-1782,-4641,1050,1372,5055},
+	{4581,2478,929,-6598,-9382,-866,-444,5488},
+	{4508,3518,2510,-610,-3060,1152,842,5216},
+	{4329,3905,2602,690,-1387,2010,2465,5337},
+	{-1385,2443,3139,-1415,-11,-8938,-8188,-3426},
+	{-5659,3144,2134,2691,1513,-10347,-10139,-6267},
+	{-8546,3222,4287,2494,2111,-6299,-6150,-5783},
+	{-3490,3689,4690,3556,4274,-3953,-5607,-9545},
+	{-3387,3905,4079,3541,2877,-4366,-7695,-7589},
+	{-2737,2619,2426,2413,3267,-4202,-4782,-10266},
+	{-1109,2726,2873,-749,84,-4913,-5428,-3529},
+	{-1048,4145,2690,3521,2541,-3740,-5108,-3801},
+	{141,4630,4294,449,221,-7102,-6886,-2904},
+	{-1658,2610,2606,1387,184,-3146,-5516,-2375},
+	{-1700,3824,2520,704,58,-5907,-6435,-2109},
+	{-1373,4561,4941,2906,3084,-3213,-4779,-2047},
+	{-711,4512,4290,2388,2810,-4448,-5224,-2788},
+	{1359,4875,4602,1088,1020,-3875,-5042,372},
+	{-247,4940,4747,3362,1468,-4003,-4507,361},
+	{341,5222,4679,2068,348,-5802,-9328,-740},
+	{-1080,2527,2421,1604,2188,-5390,-4473,-5582},
+	{-5078,3009,2990,3691,2678,-2687,-2999,-3306},
+	{-2520,3166,1674,2549,1767,-1751,-2265,-2319},
+	{-3386,3363,3172,3649,3323,-2001,-4338,-2745},
+	{-946,3481,3778,2260,2812,-1879,-1570,-1962},
+	{1059,2563,2461,1261,2198,-2541,-1879,-1988},
+	{1092,3449,3426,849,1398,-1870,-2630,-1184},
+	{328,4841,4199,2638,2001,-4576,-3809,-1572},
+	{-2660,3160,3951,1947,1831,-5656,-3398,-886},
+	{-2766,3055,2159,2186,458,-5666,-3749,-34},
+	{1091,3701,3480,2327,1450,-2655,-1650,-238},
+	{1013,3863,3174,190,915,-3767,-3983,-439},
+	{1312,4718,4107,425,1560,-2551,-4068,-759},
+	{1453,3466,4217,1109,1458,-3543,-2733,-218},
+	{3848,4685,4966,-937,9,-2463,-1513,3253},
+	{1707,5146,4103,1974,539,-2156,-1290,2876},
+	{2628,5787,4912,2723,1878,-839,-1210,1029},
+	{-1828,2601,1011,2931,2124,-712,-2169,-4041},
+	{1012,3165,2117,3606,2434,1045,74,41},
+	{-150,3379,3836,3054,3192,-92,-1386,444},
+	{1276,4856,4287,3391,3073,-214,-1470,-168},
+	{2535,2744,1278,818,646,576,-808,1239},
+	{2598,3582,3880,2161,2878,-601,162,780},
+	{2337,3686,2292,1357,1253,234,-1382,1093},
+	{2061,3668,4434,3660,3225,639,449,1879},
+	{3365,2756,3240,-811,1323,435,974,2334},
+	{1908,4032,2538,2455,2182,1103,464,2001},
+	{3118,5193,4772,1301,696,-812,-2166,3655},
+	{3621,4696,4280,1487,1228,0,765,4393},
+	{3710,3213,3061,-360,1729,1582,202,3787},
+	{4758,3299,3360,-389,835,516,352,2885},
+	{4656,5166,4436,46,1263,757,-347,4633},
+	{4284,3732,4331,2183,385,1262,1029,4796},
+	{-166,2698,3427,3233,4809,1776,1568,-1198},
+	{1873,3348,2967,2184,2880,1212,2045,1500},
+	{1976,3834,3695,3330,4486,3243,2535,1717},
+	{2284,2512,2850,3375,2408,3170,3398,2629},
+	{3306,2367,2739,3744,2078,4141,4093,3623},
+	{2659,2682,1761,1252,1165,1457,1581,1565},
+	{3276,3341,4379,3646,5031,2542,2177,1655},
+	{4154,3788,3447,3722,4758,5289,5444,3681},
+	{3172,2528,1857,3135,1609,5335,5841,5996},
+	{3941,3647,3595,3251,636,4231,4218,5498},
+	{3545,3747,2565,2436,1376,2973,3013,3698},
+	{4083,3239,3157,3590,3513,4754,5602,4292},
+	{4548,2919,2492,1737,1905,4534,3636,4557},
+	{4742,3669,4473,3782,3933,4826,5254,3955},
+	{4763,4551,3441,1662,2758,3355,2758,5145},
+	{1912,3938,4375,3811,5382,1657,-7,548},
+	{-9114,3250,4734,4679,4587,-4510,-4183,-6907},
+	{-5869,3486,4498,6542,4516,-2073,-2809,-4089},
+	{-5444,3614,4326,4519,1475,-3470,-5572,-4332},
+	{-4577,3765,4238,4661,1730,-6494,-10609,-4132},
+	{-2421,3561,3273,4799,4714,-2797,-3982,-6675},
+	{-3705,3686,4328,4669,2462,-2759,-3454,-3349},
+	{-2219,4232,4561,4616,5421,-2122,-3389,-4491},
+	{-2890,4566,4981,5079,4173,-4989,-3743,-3198},
+	{-4061,2859,2821,5399,3541,-1897,-2619,-2541},
+	{-2567,4071,3605,4278,2184,-3027,-3720,-2788},
+	{-4606,4665,3932,5180,3853,-3192,-2978,-2533},
+	{-1142,4429,4809,5187,4701,-1140,-3863,-2917},
+	{-1135,4430,3961,4120,4662,-781,-3116,-2437},
+	{-1097,4947,4236,3903,2811,-1134,-2943,-1673},
+	{1113,5938,4922,4699,4044,-2418,-2922,-1493},
+	{768,5355,4614,4165,2394,-1643,-2452,547},
+	{-3194,2992,3595,5459,4079,-1740,-2240,-3193},
+	{-5592,3510,4474,5362,5400,-702,-2075,-4465},
+	{-2877,4482,4927,6641,4745,-96,-2067,-2592},
+	{-2639,2559,2093,4697,4217,-1577,-2048,-5696},
+	{-1249,2476,2737,4730,5142,984,1667,-3122},
+	{-1239,4035,4398,5168,4802,-884,-2416,-2699},
+	{-1589,4769,4648,4183,5063,180,-2393,-2508},
+	{-1686,2877,2921,5821,5000,522,749,-1388},
+	{-2114,2691,2133,4222,3111,962,1689,693},
+	{-2000,3554,4538,4197,4688,-2558,-650,-656},
+	{-1566,4050,3712,5253,4446,360,1298,1076},
+	{-1311,3345,3755,5097,3402,-651,-1343,-1153},
+	{-953,3337,3922,3870,4519,422,999,-426},
+	{1405,4019,3918,4479,5356,447,385,-887},
+	{2056,5244,4246,4414,4523,1175,513,424},
+	{1974,5366,4487,4341,4491,1654,555,-267},
+	{558,2956,1903,5799,5240,4089,3927,1594},
+	{-856,3172,3016,5106,5135,2794,649,-1118},
+	{201,3533,3461,5340,4766,1906,775,-245},
+	{685,3397,3278,3928,2501,2531,988,795},
+	{1512,3410,2449,4643,4317,3236,2734,1816},
+	{1664,3811,3242,4822,5352,3164,2826,911},
+	{1096,5250,4386,5675,5074,2785,1781,1282},
+	{1044,3450,3780,5485,3778,4136,3119,1847},
+	{2272,2724,2149,4165,4239,4761,3872,3349},
+	{2093,3704,4377,5204,3882,3523,3417,3014},
+	{2009,4976,4701,5796,5523,4378,3027,2062},
+	{2504,3407,3618,4749,4676,4840,3453,3493},
+	{2621,3689,4313,4094,3219,2668,1656,2982},
+	{3012,5016,3899,4690,3911,2900,3235,4049},
+	{3921,5104,3927,3997,3955,2968,2614,2408},
+	{1961,3328,2873,5273,4917,4132,3977,873},
+	{2396,2760,3463,3980,4227,3174,4165,3112},
+	{2703,2823,2965,4394,5588,3252,4101,1270},
+	{2420,3076,2015,5430,5145,5692,4598,1439},
+	{2766,3143,3105,4099,3643,4182,4354,2606},
+	{4086,2684,3697,3848,4653,4778,4532,3118},
+	{3480,3225,2412,4126,5074,4323,4181,2964},
+	{3586,3298,2751,4063,5336,5830,4618,3040},
+	{4048,3613,3331,4262,4272,4633,5148,3140},
+	{2723,2698,3512,5547,5087,5190,4443,3603},
+	{1839,3402,3676,5564,5325,4841,5620,3601},
+	{1359,4079,3223,5319,4131,3896,4130,3264},
+	{4129,2758,4472,5427,5103,5030,5549,4532},
+	{4741,2403,1786,4287,5223,7063,6614,5086},
+	{4526,2669,2167,4948,4530,6543,6766,5280},
+	{4240,4157,4867,4930,5252,4290,5292,4104},
+	{3131,2909,2801,5987,5649,5955,5708,3481},
+	{-3747,3069,4476,6834,6254,1471,-264,-5256},
+	{-2424,3240,3104,6624,6361,2240,124,-3295},
+	{-425,4237,4577,5042,6507,2140,860,-1723},
+	{-160,3063,3932,7345,7376,4931,3423,-1177},
+	{192,3173,4237,5721,7052,3510,2024,-1375},
+	{10,3688,3487,6270,7343,4820,2940,-774},
+	{909,4514,3826,6232,6458,2365,1992,-985},
+	{-786,3378,3262,5771,6880,4325,1988,-329},
+	{473,3314,3375,6390,6888,3964,2779,-149},
+	{1130,4157,4736,7126,5884,3770,3554,1096},
+	{1041,4761,3956,7554,7068,3630,2871,501},
+	{1165,3435,4566,7886,6560,5689,4347,1503},
+	{1687,3470,2984,4672,5882,4610,2921,1286},
+	{1519,4004,3936,6842,6018,4497,4274,1191},
+	{1223,4536,4828,6723,6279,4842,3185,517},
+	{3114,3527,3754,4538,6012,3990,4497,1588},
+	{456,2837,4263,7392,9018,5982,5508,-9},
+	{726,3103,3569,6906,8142,5759,5115,988},
+	{-112,4207,3886,7665,7064,5438,5150,1891},
+	{1905,3106,2536,4840,6196,5185,4754,1199},
+	{3922,3466,3440,5288,6481,6122,6191,2579},
+	{2673,4104,3576,5543,5709,5024,4530,2565},
+	{3451,5270,4493,8117,7876,5870,5222,1826},
+	{2638,2831,3437,6474,6071,6101,5995,2579},
+	{101,3541,4138,8996,7836,6270,6102,2581},
+	{4039,3774,4460,5948,5885,6229,6406,3846},
+	{2504,3885,3530,6221,5702,5112,5295,2980},
+	{4054,3547,4452,6115,7469,6407,6223,3067},
+	{4120,2662,3281,4493,5957,5448,5254,2936},
+	{4554,4998,3788,5978,5886,6083,5186,3367},
+	{4304,5014,4774,7192,5852,6284,5709,4468},
+	{4633,3837,4236,5552,5952,6460,6610,5471},
+	{799,3358,2901,7341,7827,6680,5233,1409},
+	{2191,3415,4017,6530,7527,6770,6079,2578},
+	{1347,4764,4426,8648,8414,6552,5440,2038},
+	{2592,3730,4563,7429,8661,6727,6666,3064},
+	{2935,2339,1391,6259,7049,7199,7190,923},
+	{2643,2507,3039,5344,6722,6793,5851,2185},
+	{3087,3935,4959,6862,8440,6493,5304,2253},
+	{3396,4332,4966,8806,9196,8789,7401,3220},
+	{2546,3346,3729,7418,8826,8139,6710,3265},
+	{662,3372,3370,7493,6483,6800,6431,3345},
+	{3563,3536,4315,6365,6478,6848,6178,4701},
+	{4198,4092,4001,5869,7048,6911,5686,4271},
+	{4245,3620,3564,7041,6394,7847,7480,6340},
+	{4210,3950,2682,5539,5823,7582,7346,5248},
+	{4764,4684,4206,6547,6423,6570,7317,5961},
+	{266,2409,3640,9952,9552,8860,7554,1114},
+	{2310,3013,3009,8275,9369,9374,8771,2829},
+	{2783,3196,3258,8795,9988,10600,8892,3579},
+	{3017,3238,3984,8045,9794,9144,7773,2303},
+	{3339,3746,3890,8574,9158,8533,8537,2583},
+	{3792,2588,3313,7589,8415,7969,7796,2882},
+	{4450,3624,4730,9921,12391,11006,10133,3342},
+	{4378,4471,4190,8462,9457,7996,7716,2774},
+	{4748,2760,3460,6431,8366,8420,7997,3678},
+	{3678,3841,4495,8630,8753,8460,8338,3864},
+	{3175,4088,4512,10001,10780,10824,9051,4571},
+	{4045,4500,4730,9014,9794,9526,9322,3848},
+	{4164,2661,3820,7803,6589,7992,8152,4934},
+	{4321,2609,2230,5727,6322,9472,8827,6037},
+	{4381,2986,3090,8441,9470,9996,10504,5898},
+	{4758,4229,3390,8150,8270,9137,8920,5507},
+	{1581,4637,4981,7106,7854,4430,2700,1033},
+	{-3729,4178,4990,3463,2414,-7604,-5575,-2276},
+	{-3309,4462,5267,3154,379,-5966,-7733,-2440},
+	{-1043,4751,5105,4621,3803,-2635,-5713,-2590},
+	{-452,5271,5084,2996,1012,-5213,-8599,-1642},
+	{1186,4271,5239,1448,11,-7581,-5340,-666},
+	{-86,4492,5094,2998,3471,-3161,-5699,-1671},
+	{381,4954,6394,3543,2805,-3700,-4745,-1438},
+	{-43,4639,5092,1913,946,-6250,-5122,87},
+	{2060,3944,5409,688,-1663,-8220,-6227,1035},
+	{1471,5018,5747,1618,-1421,-7977,-6272,1327},
+	{1386,5792,6737,2944,-61,-5607,-5034,1115},
+	{2353,4321,5041,-1504,-5468,-10777,-4812,2124},
+	{2604,5323,6322,1289,-2342,-6773,-6546,2161},
+	{3794,5457,5368,-2586,-1334,-8302,-8661,969},
+	{3380,7280,6453,2346,1869,-3239,-4891,1459},
+	{-4540,3123,5005,4210,4085,-4392,-4734,-4653},
+	{-3561,3798,5724,5351,4295,-5344,-4067,-4342},
+	{-426,4627,5412,3419,2386,-4339,-3913,-1648},
+	{-3519,5129,5374,4616,3299,-3434,-3969,-2768},
+	{1466,5141,6008,3851,4253,-2261,-2592,-1305},
+	{1526,5093,5383,3394,3438,-2140,-1081,78},
+	{2720,5865,5344,2134,2180,-3694,-3503,-13},
+	{2805,6505,6435,3133,3569,-2160,-1646,-461},
+	{-158,5276,5374,3968,1689,-2911,-3866,179},
+	{1937,4136,5583,2216,495,-4287,-3458,1401},
+	{3643,5465,5622,-1069,609,-3738,-4020,1465},
+	{1846,6389,6335,4505,3154,-2277,-651,3067},
+	{3831,7095,5888,2913,1391,-2822,-2941,2054},
+	{4714,5924,5469,-834,650,-2463,-3301,3525},
+	{4508,5969,6560,1478,899,-3747,-3100,2480},
+	{4034,6338,5440,2687,2654,-2206,-2210,939},
+	{212,5468,5777,3793,3008,-2096,-483,1768},
+	{-234,4875,5086,4341,1282,-1405,-2690,522},
+	{299,5589,6597,6352,3831,-1108,-2011,507},
+	{-6,6145,6752,5702,3736,-1674,-1001,355},
+	{832,5570,6585,5945,4297,-1318,-1864,-67},
+	{1092,4746,5992,3440,3435,-1977,-2817,-1119},
+	{1241,5807,5199,2944,3724,-716,-2098,686},
+	{2791,6366,6191,4423,2633,-1471,-1541,2089},
+	{4162,4746,6101,2005,1036,-1083,-770,2841},
+	{2152,5225,5842,4388,1531,-393,-722,3023},
+	{3678,6177,5508,1736,-288,-1371,-1393,3177},
+	{3651,6376,6437,2448,1638,-1502,-2940,3162},
+	{4118,5845,5609,2842,1176,-360,-156,4050},
+	{4767,6639,6127,2420,-291,-1355,-1234,4986},
+	{4516,6848,5812,1536,1177,-14,-1121,4366},
+	{4183,7121,6388,4328,3249,257,-1308,3057},
+	{3770,6395,7235,3647,4017,-763,-75,2765},
+	{1118,4264,4995,4980,3230,1419,1331,1003},
+	{829,5082,5088,3793,3363,-137,973,2151},
+	{1952,5635,5501,3745,3120,-435,522,2281},
+	{2019,5159,5410,5087,4282,2845,2466,3072},
+	{3483,5971,7452,6488,4272,1529,1331,3316},
+	{3513,6090,5676,4535,3265,852,255,2524},
+	{4508,6649,6185,3778,3369,341,852,3725},
+	{2621,5143,5092,5368,3438,1829,1771,3990},
+	{3784,5572,5362,1947,278,-179,115,5093},
+	{3637,6185,5975,4322,3984,2091,2595,4915},
+	{3762,6208,5507,5557,4015,2897,2859,4034},
+	{4153,5972,6455,4671,3863,1633,1720,4534},
+	{4280,4985,5470,2617,2285,-176,1908,4962},
+	{4566,5854,5984,4328,3382,1688,1415,4419},
+	{4575,6724,7345,5476,4238,1606,1954,4824},
+	{3377,7040,7189,4542,4298,1472,1694,4161},
+	{-2852,4191,5223,4827,5307,-5691,-3945,-4103},
+	{-7153,4525,5966,6687,6122,-1723,-2922,-6031},
+	{-3214,4941,5657,5660,5353,-2831,-2708,-4837},
+	{-2533,3792,5926,5861,4702,-2106,-2423,-3611},
+	{-1404,5279,6455,5669,6443,-2316,-2874,-3974},
+	{-978,6422,6153,5582,5310,-2187,-4358,-2261},
+	{28,6755,6037,5532,4571,-2016,-3894,-3111},
+	{-533,5753,7335,6151,6565,-406,-1435,-2116},
+	{1066,5479,5985,4497,4995,-657,-727,2},
+	{664,6020,6277,5370,4565,-1633,-1059,369},
+	{1031,6832,6459,5167,4945,-2173,-1991,-1978},
+	{2095,7745,7948,5899,6794,-357,-873,-1080},
+	{2301,7354,7561,6774,7194,721,-1111,37},
+	{2980,8040,7617,6519,4688,-885,-921,2418},
+	{3701,8387,8827,6093,5441,-614,-997,1943},
+	{583,5260,6463,5343,6629,868,-502,-1132},
+	{-3766,3735,5187,5057,5709,-1945,-321,-2137},
+	{-1163,4190,5206,5112,5450,-133,1158,-270},
+	{-237,5087,5969,5696,6519,1097,814,-1388},
+	{-131,4810,5430,5508,4603,307,412,-700},
+	{128,5801,6462,6634,6524,-47,731,177},
+	{1755,6235,7009,5481,6782,865,356,-99},
+	{2685,7621,7901,6937,7766,1395,853,348},
+	{967,4978,5597,6603,4350,1245,516,1534},
+	{2103,4804,5201,5708,4689,1308,2103,2605},
+	{1028,4822,5611,5124,5133,80,1406,1912},
+	{1241,7023,6690,6180,5448,327,562,1581},
+	{2499,6308,6865,5296,4433,506,870,2393},
+	{3407,7250,8308,6145,5257,-125,1255,3016},
+	{4505,7882,8146,6456,7532,1546,1722,2381},
+	{2927,8002,7370,6033,4609,569,283,3809},
+	{2944,7661,7735,6923,6824,1596,1914,3326},
+	{-656,4179,5493,6058,7960,2673,1201,-2015},
+	{610,4275,5248,6735,5572,2344,1831,1765},
+	{-498,5214,5413,6817,7106,2012,1471,-1094},
+	{632,5997,5389,6385,6094,2855,1738,945},
+	{1741,4332,5237,5215,4865,2650,1837,1466},
+	{1567,5424,6698,6597,4970,1816,1092,1551},
+	{2591,5918,6028,6015,6834,2807,1545,1860},
+	{2053,5260,5309,5220,5804,3170,1866,2087},
+	{1883,5339,6145,5425,5102,2462,1739,2666},
+	{2614,5547,6199,5076,4803,1904,1307,3080},
+	{1880,6622,7019,6454,6057,2462,1818,2276},
+	{3402,7608,7662,6125,5148,1987,1529,3749},
+	{3754,6547,7862,6285,6246,2162,2058,2876},
+	{4046,6806,6592,4340,5358,2132,1286,3495},
+	{4217,7852,7333,6558,6928,2362,1816,2359},
+	{1386,5792,6141,6366,5714,2244,2126,1244},
+	{2585,4676,5210,4956,7059,4845,3128,2029},
+	{1740,5488,6125,6946,8048,3045,2288,276},
+	{2880,6268,6322,6870,7001,3274,2622,1369},
+	{3563,6046,7003,6349,4939,2775,3710,3503},
+	{4752,5429,5719,6976,8918,6617,6395,2956},
+	{4728,5819,6556,5596,5616,3877,4086,3173},
+	{3578,7073,6233,6411,6462,3084,2708,3329},
+	{4248,7106,7430,6671,6863,2844,3035,3558},
+	{4376,5752,5615,5805,6585,5269,4090,4053},
+	{4307,5944,7041,6226,5949,2990,3835,4156},
+	{3832,6858,8054,6216,6531,2854,2281,3704},
+	{4497,5651,5268,6891,7267,7063,7521,5327},
+	{4651,4916,5268,5094,7072,5720,5482,3756},
+	{4762,6796,6971,5489,5439,2664,2926,3883},
+	{4720,8179,7478,5792,6672,3833,2283,4662},
+	{1866,6849,7308,7009,8039,1108,367,-1372},
+	{-6110,5699,6655,8100,5213,-4271,-6767,-4340},
+	{-3047,5821,6901,8764,6256,-645,-2230,-2297},
+	{-2757,6409,7021,8096,6309,-1041,-3296,-2569},
+	{-2673,6373,6914,7299,4930,-1898,-3874,-1489},
+	{-2356,5840,8073,8538,7004,-2186,-2358,-2874},
+	{-270,6793,7597,7722,7835,-174,-2025,-3383},
+	{-1014,7388,8894,9432,7773,-262,-1521,-1763},
+	{-1903,6069,6675,7125,4984,-622,-1491,-1042},
+	{412,6254,7151,7707,6304,1903,615,75},
+	{187,7156,7724,8397,7317,1190,532,-439},
+	{772,7225,8963,8686,7088,-642,-332,603},
+	{840,7449,8772,8760,6295,1208,346,986},
+	{1501,7597,8328,7306,7559,-317,-1829,-804},
+	{3509,8709,8836,7407,7890,1074,399,408},
+	{4078,9166,8022,7140,6129,723,52,2241},
+	{1885,8750,8896,8720,7138,446,1010,2896},
+	{-836,5242,7330,8478,7426,1429,1858,-546},
+	{-401,6004,6218,7503,6684,2395,2132,981},
+	{443,7406,7787,7966,7649,2169,1219,115},
+	{852,5942,7480,8313,8407,3060,2224,1117},
+	{1336,5501,6247,7955,7650,2999,2752,1203},
+	{1718,6878,7968,7787,8155,2456,1894,-923},
+	{2618,7500,6831,7594,7630,2285,1649,-694},
+	{784,8323,9360,10683,8252,3403,2547,2126},
+	{637,5670,5369,8311,6975,3177,3303,2508},
+	{1838,6676,6618,7618,5988,3202,2478,2698},
+	{2708,7285,8695,8945,8313,2471,3171,2625},
+	{3373,7686,7231,7287,6270,2154,1876,2333},
+	{4334,6685,7380,7323,6598,3365,4235,4301},
+	{3558,7835,7563,7960,7888,3215,2635,2244},
+	{4695,7940,7930,8178,8467,3022,3686,2302},
+	{2055,6626,7118,7796,7228,3403,3164,3444},
+	{220,4898,5831,9667,8104,5102,3904,1740},
+	{-166,5903,6037,8518,8029,3930,2770,994},
+	{1720,6309,6196,8364,8112,5111,3504,1370},
+	{1721,4246,5097,7438,5651,4557,3152,2064},
+	{3116,5985,6389,7912,7414,4504,3544,2207},
+	{2833,6451,5533,7507,7706,4605,3625,2077},
+	{2986,7384,7406,8601,8495,5272,3385,1487},
+	{2888,8226,8597,8089,8446,3550,2800,2432},
+	{2389,6255,6284,7476,6334,3887,3579,3349},
+	{3445,8915,9850,9488,6715,3455,2750,4071},
+	{3913,9731,10177,10544,8373,4052,4034,5100},
+	{4111,6784,7851,8679,6479,4702,4095,4579},
+	{4457,7968,7983,7497,7180,4759,3822,5465},
+	{4370,9065,10178,9734,8294,3628,2632,4231},
+	{4683,9592,9225,7681,7670,3501,1756,3717},
+	{3811,6115,6599,8246,6261,5325,4168,4385},
+	{1728,3580,5657,7909,7264,4875,4919,2405},
+	{1210,4020,5601,7791,7201,4586,5350,1474},
+	{1676,4468,5204,8562,6442,5095,4234,2975},
+	{2028,4042,5297,8443,6991,5350,4760,2933},
+	{2794,4418,6012,7981,6542,5431,5406,2621},
+	{3061,6314,5411,8226,8258,6253,5804,3261},
+	{2696,7477,9043,10168,8358,4540,4196,2816},
+	{2045,4822,5992,9454,7624,6686,5290,3320},
+	{1683,4701,5817,9745,7883,6803,5479,3441},
+	{2928,5108,6128,8568,7930,6757,6962,4022},
+	{3844,6791,7214,7916,6349,5300,5474,5657},
+	{3867,7285,8749,9453,7921,5328,4811,4525},
+	{4239,5288,5169,7499,7681,6320,6711,5182},
+	{4756,5779,5812,7676,8164,6909,7678,5924},
+	{4205,9035,8675,8728,8165,5253,4229,4795},
+	{3841,5706,5859,7133,8677,6145,5776,2912},
+	{1567,7499,8441,9407,9970,4975,3689,1369},
+	{2192,8094,9967,10710,9574,3419,3144,1688},
+	{2463,9529,9822,9369,8980,1612,-394,163},
+	{3141,7062,7800,7835,9675,4713,2767,2391},
+	{3343,6600,7354,8598,9888,5251,4008,2237},
+	{4398,8509,9513,8386,8988,4141,3469,1816},
+	{3822,8936,9190,11039,10683,6272,4097,2506},
+	{2573,9418,9958,10600,9367,3957,2788,2631},
+	{2516,7360,8890,10842,8808,4228,3601,2853},
+	{2925,8659,8639,8735,8768,4072,2819,2741},
+	{2113,9086,9299,10078,8738,3059,2647,3263},
+	{4052,9660,12084,12985,11005,4315,4128,3818},
+	{4675,8194,8452,8669,8860,5409,4070,3172},
+	{4413,9122,8999,9735,9619,5273,3297,2908},
+	{4091,9272,10365,10292,11161,4645,3912,3367},
+	{3851,9010,9049,10035,10012,5270,4226,2218},
+	{155,4668,5887,9640,9484,6147,4951,1685},
+	{347,5329,6192,8386,9168,5865,4665,825},
+	{3085,6368,7104,8695,9106,6010,4932,3190},
+	{3159,7256,7391,8428,9564,6242,4338,2751},
+	{3175,7504,7934,9556,8849,6083,5463,2807},
+	{4240,8111,8585,8819,10169,6093,5027,2674},
+	{3857,8602,9132,9737,10653,6204,5270,2739},
+	{3530,7933,9135,10816,9336,4914,5204,3607},
+	{3489,7351,8041,8616,8905,4532,5615,4013},
+	{3379,7568,8748,11041,9133,6067,4845,3824},
+	{3327,8340,9865,12388,10879,6232,5283,4067},
+	{3693,8301,9921,10787,9915,5377,4765,3841},
+	{4102,7485,6893,9393,8706,5778,5674,4686},
+	{4640,9367,9734,10315,8976,5297,5085,6203},
+	{4385,9678,11192,11191,10220,4199,4279,4544},
+	{3517,9670,10459,11143,12507,6643,4401,2402},
+	{2547,4120,4993,8822,9487,7019,6508,980},
+	{3341,5972,6791,9776,10594,7198,6040,1377},
+	{3005,8296,8393,10423,11025,7076,5069,2164},
+	{3416,4189,5720,9436,9848,7581,6994,2400},
+	{3712,6178,7950,10803,11992,7990,6974,3274},
+	{4087,6763,8132,9730,10443,6828,6269,2058},
+	{4540,6996,7503,10754,11642,8266,6777,2917},
+	{2964,5660,6567,9331,9774,7125,6790,3342},
+	{3488,6796,7213,9811,10196,6864,6496,3392},
+	{3707,7149,7576,10309,9347,6826,5588,4409},
+	{3846,7779,7708,9919,8753,6807,6456,5091},
+	{4159,6722,7662,8354,9729,6732,5461,3630},
+	{4341,8917,10224,12709,11005,6877,5530,4537},
+	{4499,9449,9944,10209,9441,6651,6447,6046},
+	{4672,10624,11413,12346,13200,8064,6170,4010},
+	{1830,4783,5899,10140,9583,7254,7114,3485},
+	{2300,4013,5267,9350,11506,9998,8501,2321},
+	{3071,5360,5150,9096,10613,9196,7767,3192},
+	{2779,6092,7000,9544,9544,6910,7627,4803},
+	{3397,5099,6128,10198,10463,8946,8235,4613},
+	{4258,3692,5629,10626,9959,9501,9220,4749},
+	{4197,4445,5784,11355,10924,10429,9744,4246},
+	{3778,4846,5591,8816,10778,9973,9348,3837},
+	{3140,5797,6885,8877,9111,6928,7702,4829},
+	{3025,5690,6494,11177,10408,9191,8708,5423},
+	{3917,6706,7992,12499,11110,10254,9936,5529},
+	{4472,7358,8055,12872,11780,10128,9279,5904},
+	{4683,6975,8357,12737,11148,9378,8850,4913},
+	{4701,6139,7660,11532,10055,9537,8812,5031},
+	{4730,6674,8144,11411,10518,9046,9395,4878},
+	{4766,6978,7176,10015,9320,7753,8486,7079},
+	{4770,1736,1699,-835,808,2891,2810,4312},
+	{4862,3398,3586,-7328,-6494,-5580,-5144,3680},
+	{4971,4049,4189,-5306,-6826,-8758,-9104,3727},
+	{4820,5479,4472,-3909,-3644,-3932,-3825,4642},
+	{5034,3845,4323,-9393,-8824,-8139,-5104,4052},
+	{5931,1821,1963,-6592,-2958,-353,795,4668},
+	{5616,1870,2262,-3148,-1282,-158,295,3962},
+	{5309,2218,2867,-4589,-6684,-2721,-603,4873},
+	{5061,4320,4267,-4702,-5582,-3750,-2029,5028},
+	{5580,4396,3611,-5641,-5418,-2055,89,5950},
+	{5244,5090,3560,-939,-4280,-1981,-726,6526},
+	{5208,5205,3431,-5040,-6012,-2742,-1750,6192},
+	{5843,5569,4141,-8129,-4443,-2907,-2763,5175},
+	{6341,4036,4194,-1819,-1384,59,941,5160},
+	{6691,4566,3771,-3309,-2472,-2209,-73,5172},
+	{6237,4916,2816,-5359,-7138,-1471,-867,5724},
+	{7505,5323,4199,-3411,-1232,820,1035,5982},
+	{5162,-650,-2219,-7190,-3973,2173,2360,4222},
+	{5178,-123,-2901,-7780,-5353,1212,1835,5178},
+	{4785,363,-287,-3469,-2405,1463,3146,4291},
+	{5340,501,704,-3966,-4464,526,1059,4590},
+	{6288,216,-733,-7972,-5632,881,2613,5132},
+	{5910,826,-256,-4670,-6772,1428,3052,5843},
+	{6573,4088,3352,-4517,-3704,-696,1055,4322},
+	{5367,2852,3583,-1587,-1250,855,2746,5876},
+	{5972,1806,615,-4083,-6319,1330,3398,7612},
+	{4932,2699,2869,232,-1654,1647,2130,5929},
+	{6189,4176,3306,-1909,-1414,1407,1573,6326},
+	{6442,1622,-122,-3803,-4735,1677,3034,6677},
+	{6893,3058,311,-9689,-5760,454,1080,6831},
+	{7102,4530,2776,-1848,-2962,1111,1771,6485},
+	{7628,5210,3660,-1621,-1319,1612,2454,5895},
+	{5995,-965,-1749,-7050,-6641,2301,4452,6850},
+	{4882,-956,-2171,-2800,-2359,4917,4355,5111},
+	{4951,-603,-583,-3385,-2138,3585,3622,4570},
+	{4807,-389,-946,-3934,-2123,2954,4003,5568},
+	{5153,-724,-2391,-5851,-3936,3247,3282,5246},
+	{5665,-2619,-4849,-6578,-5905,3813,4474,5524},
+	{5316,-2005,-1038,-4813,-5655,2323,3604,4475},
+	{6090,-416,-520,-5490,-1853,3476,4155,4792},
+	{5581,915,1631,-1318,-1103,2609,4124,5780},
+	{6093,-117,-2744,-5218,-4551,3877,4266,7147},
+	{6021,707,114,-3262,-3382,2939,4962,6783},
+	{5663,3013,1491,-1042,-1360,3057,2621,6314},
+	{6299,1054,988,-3307,-1874,2803,4617,6466},
+	{6587,1552,211,-6067,-3675,2525,3521,5817},
+	{6924,1581,-1416,-3847,-2329,4825,4794,7177},
+	{7760,3480,999,-4039,-2487,3325,3801,7844},
+	{6540,919,-1195,-4076,-1577,5088,5326,6291},
+	{4870,-4708,-5275,-5424,-2057,4859,5901,5320},
+	{4882,-3714,-4130,-6601,-6641,3916,5431,5931},
+	{4805,-2578,-6521,-4265,-2312,5523,5382,5169},
+	{5130,-5378,-7564,-5880,-2497,6022,5786,5614},
+	{5257,-1154,-2637,-893,-1467,5637,6130,5445},
+	{5753,-612,-1068,-2423,-2962,4723,5575,5394},
+	{6367,563,-1155,-2175,-2387,5309,6316,6165},
+	{5202,-4973,-4513,-4628,-3979,5450,7116,6289},
+	{5249,-2623,-3755,-5699,-5374,4096,5855,7046},
+	{5323,-306,-1972,-246,-1924,6531,7234,7887},
+	{6631,-214,263,-1173,-2059,4933,5986,6938},
+	{6683,1450,-454,-1889,-3601,5498,6254,8478},
+	{7811,-163,-960,-3173,-1868,6381,7976,7853},
+	{7422,619,-961,-3453,-3515,5490,6483,7389},
+	{7227,1229,78,-2072,-2904,4831,6097,7156},
+	{5144,261,-1968,-2016,-942,5543,4670,4923},
+	{5037,2696,1982,-1047,424,1707,1839,3203},
+	{5063,2744,3444,1327,447,1665,2933,4225},
+	{5063,2877,1915,-1496,-118,1553,1449,4394},
+	{5182,897,592,-2297,-67,2769,3411,4915},
+	{5465,3475,2707,1384,2815,3238,3685,3970},
+	{6195,3870,4141,-1729,498,506,130,4742},
+	{6394,6005,4349,-437,-614,402,489,4638},
+	{5579,2268,2416,-700,-358,2738,3690,5356},
+	{5414,2969,3207,-77,-267,2856,2695,5946},
+	{5805,3566,2706,1272,820,2677,3644,5403},
+	{5644,4121,3438,796,-647,1750,2233,6393},
+	{6281,2973,2445,-677,117,2537,3043,5372},
+	{6321,4381,3385,-749,927,2624,2627,5668},
+	{6951,4606,4254,845,1973,3718,2805,6718},
+	{7573,5682,3941,-682,-821,1726,1368,6656},
+	{5081,1714,-169,-36,-305,3551,3705,4858},
+	{5082,-2362,-1298,-494,-616,5067,5195,5540},
+	{4859,2549,2349,334,2335,2928,3742,3642},
+	{4948,2715,2713,1473,2890,2735,3731,3823},
+	{5945,1207,-34,-1454,-602,3791,5192,5325},
+	{6044,1634,1804,-859,-65,4332,4539,5727},
+	{6221,2950,1547,624,442,4927,5354,5608},
+	{7275,3938,3358,316,1783,3343,3716,5676},
+	{7611,4191,2346,-1004,-456,4117,4556,5889},
+	{5274,884,895,-201,271,4730,6734,7247},
+	{5620,2230,1380,158,213,3692,3979,5969},
+	{5203,3125,2167,363,569,4386,4205,6677},
+	{6210,3331,3240,-333,664,4301,3817,6617},
+	{7454,1460,852,-1604,-542,4755,5402,6462},
+	{6399,2342,2464,76,-411,3088,4522,6493},
+	{7741,4668,4369,-1466,712,3334,4630,7142},
+	{8291,3814,3422,-268,637,5226,6120,8143},
+	{5148,-1835,-3547,-1891,863,5309,6523,3796},
+	{4905,-1030,-2164,-2559,308,6302,4941,5892},
+	{5594,1486,1163,245,1693,5814,5763,5910},
+	{5983,367,-554,-1193,676,6160,6002,5593},
+	{6963,52,61,-2227,-516,5476,6024,6261},
+	{6339,933,-219,-911,-829,5323,4991,6436},
+	{6336,2336,1427,1474,1929,5706,6097,6009},
+	{6270,1342,2038,1434,1009,5610,5762,7033},
+	{6836,1085,1453,810,1319,5966,6806,7378},
+	{6274,1953,1102,542,198,6211,6577,8345},
+	{5766,2857,2678,1212,971,5432,5035,7132},
+	{7063,1650,726,-1119,-476,5464,6292,7706},
+	{7981,4693,3355,963,1619,5592,4807,7764},
+	{9510,4833,3449,-427,936,5728,6697,8596},
+	{9703,5094,3389,-521,1029,6482,7248,9222},
+	{7877,2109,1036,-618,1261,7106,7354,8649},
+	{6050,-742,-2972,85,2166,8588,8390,7015},
+	{6604,-5,-266,1211,2055,8512,7968,7513},
+	{6384,1027,1201,1231,2571,7163,7848,7332},
+	{6661,-2709,-2227,-1719,2248,7573,7626,6380},
+	{7616,582,-648,161,2645,8553,8312,7657},
+	{7533,1562,1116,1231,2801,8749,8837,7800},
+	{9344,3364,2379,-68,1400,6913,7934,7863},
+	{6426,137,162,-693,266,5857,7552,7958},
+	{6500,-683,-1300,-992,-405,6623,7756,8337},
+	{7133,1192,621,-735,-538,6605,7871,8548},
+	{7606,1999,2186,1114,1962,7950,8360,8367},
+	{7821,2565,2246,396,1792,6770,7489,8073},
+	{7925,659,-315,312,2210,8687,8981,8488},
+	{8319,877,-292,-877,1354,8689,9720,8824},
+	{9960,4031,2536,-89,841,6854,8251,8930},
+	{4982,484,448,1503,3134,6883,6416,5033},
+	{5190,3405,2822,3472,3510,5142,4624,4518},
+	{5463,4538,4426,1559,2621,3635,4768,5681},
+	{5495,4877,3795,2891,3387,4820,4877,5389},
+	{5690,3708,4036,3093,2573,4378,4317,5117},
+	{5855,3257,4075,1854,1590,2837,2955,5190},
+	{6369,4561,3689,3287,3574,4559,5102,5397},
+	{5978,5661,4239,3594,3106,3771,3438,4695},
+	{4947,2433,2844,1953,1545,4462,4779,5728},
+	{5803,3357,2559,1847,1779,4932,4775,5938},
+	{5095,3759,3854,2011,486,3524,4550,6094},
+	{5530,4732,4238,2644,2713,5266,5470,6890},
+	{6067,5084,4359,2093,2252,4741,3941,6073},
+	{6638,3656,3659,2376,914,4841,5308,7732},
+	{6892,4090,4418,2114,258,3310,4465,7120},
+	{6421,4825,4233,1724,1563,3553,4176,6113},
+	{5786,3391,3048,2232,1268,5651,5493,7394},
+	{4975,-1132,389,2389,1801,6202,6738,5001},
+	{4867,396,761,1507,831,5576,6846,5834},
+	{5260,2257,2726,2791,3237,5467,6161,5609},
+	{5550,3505,3802,3888,3752,5031,5511,4904},
+	{5958,2574,1574,2636,3073,5440,6204,4788},
+	{5748,2602,2130,2755,3327,5577,6964,6369},
+	{6521,2969,3722,3575,3785,5871,6693,5833},
+	{6094,2555,1988,2816,2494,5614,6572,6524},
+	{6561,2620,2770,1981,1995,5514,6962,7186},
+	{6449,3193,3337,1906,409,5689,6282,7785},
+	{5373,3377,2097,3419,2961,5813,6130,6953},
+	{8568,6479,4390,2602,2742,6326,6394,8298},
+	{9781,4886,3517,2182,2783,6457,7855,8220},
+	{9440,5679,4220,1557,2999,6171,6980,7752},
+	{9237,6202,4059,2905,2683,6506,6695,9048},
+	{7444,3177,1886,1811,749,6578,6708,7909},
+	{5016,1076,1380,4202,3224,7897,7484,6073},
+	{6152,1228,-703,2189,3098,6799,6904,4813},
+	{5469,2578,1737,3688,3387,7708,8428,7439},
+	{6327,3752,2722,3183,3191,6737,7288,6299},
+	{7074,2145,1007,2103,3311,7762,8435,7118},
+	{6806,2172,3246,4048,3799,7216,7438,6842},
+	{7835,3271,1926,2136,3388,7602,8123,6759},
+	{6790,2201,1739,2224,2326,7548,7980,7677},
+	{6759,1212,1702,2505,590,7066,6621,7929},
+	{6544,1500,724,1901,988,6627,7662,8337},
+	{6932,3458,2005,3268,2315,7144,7557,8281},
+	{7964,4454,3391,2954,2906,7515,8292,9170},
+	{9159,4643,4296,2944,1988,6897,7827,9049},
+	{9649,5231,3906,2473,3452,7394,7612,8701},
+	{9524,5297,4065,2559,3878,6773,7678,7896},
+	{8423,3306,2960,3177,2235,7667,8571,9035},
+	{6724,771,-622,2088,3059,8981,9389,8501},
+	{6544,2274,2109,4136,3842,8826,9931,8200},
+	{6882,2574,2882,4298,3921,7514,8769,7486},
+	{7106,1501,1764,2085,2121,7676,8798,7416},
+	{8281,2072,720,1771,3610,9304,9178,8920},
+	{8537,2624,3012,2008,1442,7106,8661,8662},
+	{7730,3172,2479,2958,3930,9028,8668,8150},
+	{8983,2725,1407,2390,3817,9455,10098,9016},
+	{9008,3020,1276,2174,3822,9749,10461,9333},
+	{8041,3278,2722,2628,1582,7785,8752,9293},
+	{9340,4765,4314,2544,3534,8469,9307,10267},
+	{9692,4603,3721,2880,3084,8419,9848,11018},
+	{10585,3716,2080,2179,3974,10460,10849,10698},
+	{10057,4449,2834,3196,3788,10404,11262,11489},
+	{10790,5084,3817,2710,2486,9704,10962,11525},
+	{4845,905,236,2512,3982,6032,7061,5050},
+	{4846,1787,1093,3135,4296,6118,5884,4325},
+	{5316,2170,1618,2432,4260,7333,7029,5556},
+	{5745,3068,2439,3040,4105,5321,6149,5230},
+	{5792,4350,3972,5606,7026,8414,7020,5448},
+	{6033,3613,2441,3963,4413,6272,6756,5421},
+	{6053,4274,3978,4571,5670,6838,5656,5718},
+	{6282,5033,3282,5244,5070,6776,6286,5470},
+	{6984,3674,2541,2730,4020,5734,6618,5819},
+	{5347,4041,3652,5380,4178,6408,7128,7378},
+	{6127,4899,4307,5190,4390,6870,6850,6878},
+	{6144,5176,4198,5631,6087,7462,6434,6260},
+	{6535,4849,4028,3936,5244,8011,6968,7536},
+	{7716,4271,4344,3480,5699,7499,6843,7108},
+	{8351,4632,4387,3664,5073,6718,7322,7197},
+	{6664,4662,4258,4494,4158,6038,7066,7883},
+	{7077,3406,3868,4194,5566,6987,7363,5562},
+	{5501,1550,-363,3292,4414,7968,7728,4478},
+	{5573,3757,2826,5309,4903,7228,7518,6558},
+	{5538,4543,3822,7296,7478,8865,8775,4868},
+	{5595,4070,3533,6725,8574,8813,8267,5282},
+	{6786,3859,4032,5061,7139,8232,8254,5286},
+	{5651,3873,3506,7018,7033,8705,8660,5543},
+	{5819,4262,3107,6927,6455,8642,8459,6053},
+	{5101,2943,3051,4903,4776,7521,8689,7088},
+	{6986,2981,3653,5578,4046,8860,8282,8260},
+	{7292,3176,3727,5296,5847,8689,10234,8823},
+	{7613,3697,3973,4221,4109,8058,8809,7322},
+	{8282,5506,4143,4109,4180,8186,8701,9320},
+	{8887,3925,2668,3096,4270,8500,8974,8556},
+	{8384,4265,4419,5127,6161,8698,8561,7766},
+	{9102,6226,4461,4284,4916,8289,8059,7679},
+	{5103,2678,3168,6067,8413,8909,8673,3961},
+	{5572,1693,1236,4529,6061,9733,8779,6541},
+	{5291,2188,1720,5845,6622,9932,9928,6306},
+	{4909,3144,4007,8291,8376,8916,9632,5562},
+	{6001,1953,667,2443,4549,8917,8038,6265},
+	{7248,3451,3783,4393,6498,8959,8891,6374},
+	{6373,3489,2993,5909,6800,9420,9070,5733},
+	{6177,3973,2984,7520,8884,9948,9798,6094},
+	{6666,3246,3919,6400,7908,9501,10010,6915},
+	{8272,3688,2533,3536,4412,9160,8870,9159},
+	{8190,4447,4451,5629,5410,9292,9202,9085},
+	{7118,4937,4016,7008,5964,9491,9626,8247},
+	{8420,3442,3995,5194,6776,9591,9789,8208},
+	{8580,3632,3458,4810,6265,10265,10015,8333},
+	{8932,4787,3761,4605,5722,9081,9479,8704},
+	{9467,5201,4377,4463,4911,9175,9962,8969},
+	{5698,4316,3132,7669,9000,10960,10034,5817},
+	{4856,384,796,3989,4557,9105,10100,6931},
+	{5572,2189,2655,6292,7502,10315,11066,6982},
+	{5173,2959,2385,7659,8952,11047,11306,6288},
+	{6946,3727,2520,6295,6576,10575,10751,8364},
+	{7175,1033,365,2536,5088,9246,10405,6954},
+	{7165,2764,3323,6103,6633,9406,11024,8891},
+	{7639,3631,3242,5054,7531,10930,10070,7248},
+	{10375,5390,3878,3941,5132,9644,10266,9027},
+	{7882,2839,1057,3438,4255,10485,11007,9325},
+	{7520,4365,4217,7326,8440,12025,12055,9093},
+	{8512,4882,4178,5196,6177,9125,10093,9376},
+	{9682,5640,4203,5944,6283,10481,11381,11643},
+	{9762,4006,3132,3055,5678,10906,10419,10007},
+	{9722,4188,4065,4200,4323,9649,11814,11269},
+	{9799,4907,3943,5388,5258,11030,11478,11732},
+	{7107,4554,4496,2088,4078,5494,5042,6974},
+	{5353,4247,4689,-5658,-2620,-3705,-3274,3567},
+	{4819,4865,4645,-6459,-2764,-4720,-3719,2628},
+	{4853,5389,5840,-2548,-6212,-10722,-4726,3954},
+	{5366,5930,4805,-7404,-5608,-7621,-7866,3379},
+	{5597,5039,5742,-309,1751,-916,-1392,3687},
+	{6317,5489,4823,-4959,-4825,-7387,-6516,4141},
+	{5955,6726,7023,-58,-95,-2651,-1099,4242},
+	{6252,6751,7059,968,1326,-1813,-2021,4324},
+	{5688,5429,5691,-135,-968,-2620,-1181,4736},
+	{5280,6144,5880,790,-119,-1070,-1143,5093},
+	{4860,6282,5534,1257,-2214,-2545,-2351,5451},
+	{5965,6800,5884,-607,-3953,-2535,-1381,6974},
+	{6577,5761,4707,-3137,-2696,-1522,-2042,5264},
+	{6894,6447,5484,-3461,-1800,-2417,-1323,4637},
+	{6629,6459,5965,-1278,-2940,-2578,-2773,5779},
+	{5593,6144,6930,1768,1379,-1320,-1051,4647},
+	{5328,5672,5843,1551,2451,92,1871,4944},
+	{4978,5710,4839,363,-59,71,-872,4565},
+	{4783,6507,5478,1834,2370,-102,-207,3770},
+	{5458,4180,4620,-4138,-2795,-1536,-656,4842},
+	{5625,4003,4555,-3635,-4002,-2738,-756,4873},
+	{5458,6114,6007,2360,1467,-215,1081,4397},
+	{5602,6297,6706,1523,2254,-536,694,4967},
+	{5627,6142,6071,1257,-467,338,92,5323},
+	{6466,5483,4781,-2646,-3008,-355,1483,7481},
+	{5344,6031,6019,1162,-2875,-908,-987,6188},
+	{5475,6778,5036,-24,-497,-982,-815,5514},
+	{6967,6745,6056,-214,-830,-55,1299,7415},
+	{7097,6131,6532,221,-1912,-1581,-445,6686},
+	{6976,6428,6554,874,-1580,466,1623,6672},
+	{7854,6767,6281,-369,-1304,-446,696,6811},
+	{6219,4922,4829,21,773,481,765,4356},
+	{4919,5159,6003,3341,1716,1210,2305,4442},
+	{5939,5701,5767,3694,2365,2603,2783,5761},
+	{5449,6002,5385,4112,2405,2614,2902,5826},
+	{6346,5612,5688,605,2744,1127,1791,4537},
+	{6627,5223,4959,234,185,1012,1481,5636},
+	{6606,5651,5305,2370,1489,2668,3151,5784},
+	{7582,5847,5405,-2084,496,1885,2434,6231},
+	{6222,5665,5484,2116,751,2876,2878,6238},
+	{6772,4947,5367,1177,-203,1524,2901,6833},
+	{6051,5973,5433,1039,-432,923,852,6978},
+	{6599,5975,6484,1853,1412,1458,2527,6361},
+	{6949,5522,6737,3281,1184,1829,2617,6467},
+	{7518,5286,5302,308,-950,2065,3212,7710},
+	{7313,6661,6484,452,1009,867,310,6698},
+	{7618,6820,4896,-324,-1291,664,887,7351},
+	{6668,5689,5867,3419,2390,3247,3634,6199},
+	{5811,5557,6609,3932,2490,2929,3997,5670},
+	{6329,5971,5901,2896,1733,2170,3659,6365},
+	{5964,6803,6191,3332,1373,2997,3671,7639},
+	{6892,6191,5617,2099,2628,3091,3974,5412},
+	{6999,4117,4556,91,-186,2222,4174,7719},
+	{7032,5431,6734,4173,1810,3097,3878,6501},
+	{7097,5479,5064,786,1731,4196,4103,7559},
+	{9009,5463,5007,1252,1074,4410,5323,8293},
+	{7834,5660,5004,2280,413,4009,5211,8961},
+	{7241,5950,5060,2263,371,2653,3878,8544},
+	{7915,6464,6184,3273,2801,5584,4887,8362},
+	{8189,5674,5293,-62,-789,2561,4774,9421},
+	{8346,6173,5980,2623,2725,4941,5728,8735},
+	{9352,6278,5515,2577,2448,5744,6555,8488},
+	{9596,6628,6180,781,83,2608,4771,9591},
+	{6619,4404,4585,2564,2883,4582,5010,5303},
+	{5031,4296,5154,3223,4872,3636,2934,4244},
+	{5396,4695,5111,1521,3399,2767,2670,3457},
+	{5024,5598,6477,4423,3122,1466,1742,3965},
+	{5497,5738,5265,3621,4741,2136,2745,3487},
+	{6330,6340,6979,5322,6246,4460,4127,4480},
+	{5642,6601,6913,4757,5590,2884,2848,3366},
+	{6205,6798,7579,5360,7034,4653,3952,4412},
+	{5095,5668,6438,2901,3312,1564,1249,4574},
+	{5782,5024,4674,3393,4603,4318,3431,5056},
+	{4888,5524,6078,4634,4198,2928,4213,4935},
+	{5355,5894,6733,4899,4141,3331,3507,5354},
+	{6194,6533,5159,3219,3243,4007,3266,5734},
+	{6563,4770,4745,2242,3414,4159,4753,5198},
+	{6248,6352,4869,4569,4919,4446,4078,5446},
+	{6513,6492,6908,4923,4482,3944,4166,6630},
+	{8844,6030,5934,2171,3074,4494,4932,7269},
+	{5838,4981,5255,5439,3631,6317,6200,6500},
+	{5890,5494,5711,4222,4404,4156,5214,6365},
+	{5974,6121,5964,5455,6775,5644,6163,5241},
+	{6530,5584,5555,3713,5711,5359,5586,5467},
+	{6808,5095,4730,2649,4531,4718,5213,4636},
+	{7034,6033,5556,4952,5367,4413,5536,5225},
+	{6887,6857,5305,5103,4790,6100,5633,6073},
+	{7572,5666,5859,2986,3553,4589,4939,7098},
+	{8366,4690,4676,3268,3119,6437,6421,7987},
+	{7197,5042,4713,4179,3074,6004,5909,7780},
+	{7127,6667,7048,5437,3947,5008,5304,8172},
+	{8414,6055,6348,4439,5497,6111,6211,7430},
+	{8888,5307,5770,3867,3338,6568,7040,9457},
+	{8423,6103,5353,2608,3134,5441,5854,8067},
+	{8536,6867,7199,3809,4709,5343,5116,7809},
+	{9694,6390,5617,1902,4157,6582,7403,7971},
+	{7638,5648,5458,4152,5185,7827,8145,8075},
+	{7576,6299,4501,3713,4219,6596,6255,7000},
+	{5970,6318,5689,5465,4449,6801,7059,8062},
+	{7942,3468,4504,4265,3439,6893,7901,7419},
+	{8296,4891,5095,5477,4499,8331,8509,8333},
+	{8760,4935,5152,4619,5838,7867,8304,7526},
+	{7950,6104,5531,4428,4649,7158,6156,8033},
+	{9738,6013,5496,3125,3854,6939,7780,8393},
+	{7786,6147,5042,4454,5038,7165,6927,8405},
+	{8908,6460,4602,3855,4026,7671,7834,9302},
+	{8929,6830,6957,5418,7270,8689,7695,8613},
+	{8933,6322,6193,4562,6404,7653,8065,8552},
+	{10042,5976,6074,3466,3532,6689,7938,9829},
+	{9318,6306,4983,2890,3447,7172,7381,9816},
+	{9521,6549,4717,3728,4275,8493,8517,9064},
+	{9722,5815,5600,3053,3150,6803,8745,9900},
+	{9474,5002,5054,3231,3137,8060,8831,9891},
+	{8181,5585,5592,4614,5266,7834,8836,8886},
+	{9986,5810,4940,4876,6418,9698,10022,10203},
+	{10386,5449,6195,5424,5236,8919,9507,9752},
+	{10579,5001,5084,3810,6623,10289,10033,9623},
+	{10515,5724,5970,4998,6165,9616,9634,10115},
+	{10693,6196,6707,5405,7779,10544,10125,10108},
+	{8690,6200,6063,5428,4668,9338,9389,10250},
+	{9386,4962,4977,4665,4246,9686,9958,10454},
+	{9182,4968,5116,4548,5120,8422,10449,10796},
+	{9247,5019,4938,4976,5772,10749,10418,10561},
+	{10267,6728,5823,4807,4831,9052,10214,12396},
+	{10396,5636,5130,5271,5204,10249,12520,13255},
+	{10610,6428,5955,2977,3744,7657,9216,11344},
+	{11258,6456,5365,4461,6053,11082,11024,10968},
+	{5201,5526,4853,5482,5302,5884,4701,5109},
+	{4832,4983,4601,7774,8126,8542,7139,4204},
+	{5119,6462,6428,7064,7196,5423,3987,4105},
+	{5094,6865,7073,5736,6416,3820,2756,3597},
+	{5352,6411,6705,6332,5982,5930,5561,5999},
+	{5531,4234,4768,6791,7445,7103,7542,4277},
+	{5871,4916,5776,6252,6395,5859,6155,5134},
+	{5871,5096,6222,5699,5076,4974,5481,5587},
+	{5387,4326,4604,6277,7120,7837,6703,6004},
+	{5032,4643,5460,7302,5710,7172,6423,6327},
+	{4876,5578,5335,6704,5719,6409,6447,6473},
+	{4785,6288,7106,9754,7928,8135,7386,6433},
+	{5785,6670,7239,8543,7778,7139,6250,6417},
+	{5983,5211,5832,6792,6256,7593,7696,6626},
+	{8042,6551,6724,6211,4570,7419,7825,8849},
+	{7699,6743,6149,7036,6081,7928,7445,8048},
+	{6121,5112,5362,6378,4539,7827,7853,7291},
+	{5687,4955,6071,8390,6855,9056,8654,6376},
+	{5702,6198,7764,9351,7964,8184,8457,6099},
+	{6447,6239,5901,6164,5814,7351,8122,8081},
+	{6548,5919,5395,7217,8090,8846,8323,7515},
+	{7982,4471,5714,5638,4456,7706,8088,8084},
+	{7319,6018,6379,7251,6820,8809,9246,8131},
+	{7749,6681,6993,8061,7914,8150,8418,7814},
+	{6363,6709,6352,7995,7542,8414,8747,8337},
+	{7946,5742,7037,7918,7136,8363,9127,8440},
+	{6783,5960,6378,7128,7210,8407,9847,8480},
+	{7939,5993,4915,6069,5000,7774,7894,8941},
+	{8436,6783,6774,5796,4900,8224,8579,10240},
+	{8868,6181,5920,5496,4745,7528,8942,9387},
+	{9127,6308,6112,5661,6283,8852,10765,10395},
+	{8999,6619,6688,7309,5825,8864,9192,10150},
+	{9069,6494,6550,7723,8059,9159,10349,9150},
+	{5003,3252,4769,7275,7395,9169,9664,6305},
+	{7120,4388,5246,6993,5971,9642,9804,7911},
+	{6902,6523,7851,9518,7674,9288,8698,7649},
+	{7144,5352,5528,7488,7288,9350,10021,8479},
+	{8163,5324,5054,6122,6967,9469,9562,8360},
+	{8724,5725,4776,5962,7523,9415,9660,8765},
+	{8538,6132,4825,7409,7786,10468,10147,7993},
+	{8272,6379,7249,8708,7375,9262,9124,8765},
+	{9415,4634,5450,5803,4318,9826,10111,10394},
+	{7967,5769,6158,6697,6038,9456,9434,9512},
+	{8684,6843,7511,8833,7092,9394,9215,9198},
+	{9452,5779,5683,5635,4557,10094,10092,11049},
+	{9587,5590,5220,5858,5455,10035,9343,9814},
+	{10519,6437,5288,6637,7339,10636,10411,9826},
+	{10687,6506,7351,5836,5443,9511,10181,10203},
+	{6013,3850,4720,6865,7122,9651,10413,7998},
+	{5581,3558,4588,7671,7489,9672,10685,7077},
+	{6947,5095,5359,8038,7807,9876,10452,8971},
+	{7230,5155,4566,8134,7595,10579,10958,9470},
+	{7746,4503,4672,7286,7200,10758,11849,9822},
+	{8632,5070,5691,8173,7804,10821,11088,9692},
+	{7815,5426,5369,6980,6900,9386,10973,9808},
+	{9003,5683,4763,7208,7449,11851,11849,10321},
+	{9655,6243,6436,5893,5960,9447,10480,10508},
+	{9107,5706,6428,7082,5623,10646,10689,10685},
+	{9867,5765,4811,6378,7655,11580,10860,10637},
+	{10754,5819,6713,7696,7523,12356,13829,12746},
+	{10838,6595,6607,7088,7355,11931,11523,10872},
+	{11746,6002,5103,5871,7777,12239,12607,11883},
+	{11398,6600,6123,6725,7813,12655,13189,11557},
+	{11353,6643,5825,5584,6591,10474,11965,11134},
+	{7101,6791,7352,6635,8220,6390,5847,5333},
+	{5074,4783,4808,6883,8309,8792,8483,5069},
+	{5405,6576,6351,9797,10558,9075,8709,5139},
+	{4886,6859,7375,11718,11972,10475,8402,5222},
+	{5502,5488,4694,7645,8376,7175,7021,3456},
+	{6030,5945,5573,9408,9764,10006,8903,5753},
+	{5513,6475,7602,10918,10124,9833,9155,5404},
+	{6378,6536,6598,8349,10208,8637,8960,5318},
+	{6289,6314,7310,8438,10068,8693,7938,6076},
+	{5680,5087,4982,9215,9450,10021,9205,6253},
+	{5718,5885,5759,7283,8349,8980,8292,6314},
+	{5809,6686,6531,9538,8726,8871,8628,6292},
+	{6512,6468,6555,6541,9011,8556,7064,6234},
+	{7341,4586,5638,6741,9028,10221,9466,7237},
+	{6594,6011,7142,8760,9193,9429,8998,6571},
+	{7313,6839,7709,10122,8494,9085,9189,8644},
+	{6648,4335,5422,7623,9392,9701,9549,6637},
+	{5091,4508,4714,9235,8596,9231,9619,6228},
+	{4937,5936,5964,10431,10475,9838,9829,6413},
+	{5255,6841,7531,10681,11127,10210,9643,5087},
+	{5287,6157,6236,10113,10883,9763,9963,5885},
+	{5654,4712,5595,9126,9609,9837,9728,5662},
+	{5694,5645,5654,9449,9602,10440,9827,5664},
+	{6215,5740,5857,10197,10128,10609,9745,6228},
+	{7024,6374,5259,8104,9238,10250,9617,6468},
+	{6044,5884,6387,8463,9439,8653,9952,7495},
+	{5540,6407,6744,11396,10428,10643,11004,7220},
+	{5683,6808,8027,10826,11188,9662,10010,6872},
+	{6395,5641,7396,11573,9818,10459,10259,7077},
+	{8205,5032,5502,6660,8975,10261,10259,7572},
+	{6860,5830,5883,9343,8559,10210,9904,6971},
+	{6803,6283,6896,9535,10974,10247,10794,7445},
+	{9715,6786,6302,8191,9956,10689,11324,8617},
+	{5566,4788,4769,9633,11903,11683,9857,5560},
+	{4926,5032,5257,9966,12129,11123,10194,3587},
+	{5375,6334,7142,11135,12216,11351,10131,5379},
+	{5843,5728,6758,10550,12034,10841,9956,4377},
+	{6325,6053,5943,11307,10406,11208,10648,6993},
+	{6873,6486,6835,10758,13157,11415,10877,5736},
+	{6065,6500,6220,8903,11035,10959,9860,5802},
+	{7319,6713,8092,11949,11131,10999,10593,7477},
+	{6890,4120,4781,9668,10199,12276,11380,8149},
+	{8302,5704,5776,7899,9417,11014,11486,8316},
+	{8352,6478,7791,9592,9356,10863,10682,8289},
+	{8906,6184,5326,7836,9602,12271,11129,9072},
+	{9624,5832,6388,7608,8678,11067,11004,9074},
+	{8922,5997,6213,8384,9106,12449,11436,9598},
+	{10579,6761,6566,7097,8248,10941,11156,9188},
+	{7870,6798,7166,10568,12187,12563,11505,7805},
+	{5776,6119,6701,12520,12397,12902,11525,6950},
+	{5823,6202,8424,13479,12321,11662,11804,6277},
+	{5586,6671,6911,11846,12272,12185,11673,7450},
+	{6686,4799,6132,11059,11155,13059,12569,8047},
+	{7929,5494,5630,8945,11135,12706,12227,7226},
+	{8312,5523,4899,8442,9604,11969,12242,8606},
+	{7170,6242,6604,10352,9980,11868,12142,8085},
+	{7717,6063,6510,8720,9872,11332,11973,8915},
+	{8246,4157,5514,8441,8646,11581,11980,9664},
+	{7633,5952,5182,9620,10083,12215,12727,9163},
+	{7286,6535,6661,9867,9224,11435,11608,9805},
+	{9157,6177,6429,8430,9429,12850,12291,10592},
+	{9519,5766,5591,8418,8762,11862,12379,10885},
+	{11355,6461,5627,7241,9173,13527,12268,11454},
+	{9723,6866,5958,9102,10976,14036,14656,10155},
+	{5950,6869,5463,1069,-1128,714,1622,6805},
+	{5519,7664,6216,2110,1545,-835,-408,3646},
+	{5192,7967,6918,2048,2064,-1076,-2106,2972},
+	{5454,9601,8115,4696,3209,-691,-928,3450},
+	{5583,7995,7521,3245,1687,-1397,-1167,4737},
+	{7109,6984,6326,-2476,-3393,-3647,-2870,5401},
+	{6969,8023,7075,597,-65,-1971,-1377,5512},
+	{5869,8525,7566,2973,2089,-1372,-2289,4073},
+	{6848,7202,7939,1218,-263,-2887,-2769,5545},
+	{6480,6881,7135,1352,340,-156,-352,6319},
+	{6065,7112,7753,2061,-1005,-1368,-1323,5911},
+	{6270,8022,7380,1633,-1002,-1733,-1908,5964},
+	{6913,8619,7813,2322,1077,-931,-725,5677},
+	{7096,7580,7401,74,-3617,-3039,-1435,7211},
+	{7825,8505,8163,1459,-1143,-1224,-791,7394},
+	{7724,8661,7856,252,252,-935,-498,5914},
+	{6811,7111,6890,-565,-1304,-1298,-289,6165},
+	{5968,7340,5773,2548,1959,972,773,3899},
+	{5642,7456,7715,2582,-269,-1025,-202,5732},
+	{6133,7527,7446,2117,3027,-435,19,4005},
+	{6560,8188,8288,4230,2966,-446,1309,5722},
+	{7221,6968,5999,1853,1685,918,1350,6010},
+	{7061,7019,5405,-309,259,517,370,6145},
+	{7274,7524,8346,2320,2119,80,140,5582},
+	{7676,9386,8587,2702,2024,303,362,6384},
+	{6678,7002,6794,471,-522,243,1977,7785},
+	{7418,7190,7159,-502,404,85,-170,6411},
+	{7566,7385,7721,115,48,366,2588,7905},
+	{7761,8266,8530,2287,2035,660,273,6535},
+	{7808,7832,7511,186,537,20,355,6911},
+	{8415,8552,7012,-748,-2252,-388,654,7988},
+	{8005,9232,7777,1671,35,-4,17,7376},
+	{6224,7207,6350,1486,1895,1010,-569,5719},
+	{7049,7853,7653,2825,2022,1313,3055,6776},
+	{7456,8260,6864,4077,2989,2488,2118,6556},
+	{7135,8949,7341,4009,3181,1793,1409,5456},
+	{7479,9615,8363,3898,3020,1268,1931,6681},
+	{8370,7524,6336,1315,1192,1439,2441,6860},
+	{8196,8664,8113,1868,2533,2067,2182,7224},
+	{8396,9707,8092,3563,2724,2153,2547,6955},
+	{7249,7582,6884,1930,1397,2049,1395,7876},
+	{7569,7031,5707,68,-974,1432,3152,9133},
+	{6908,7217,6609,1649,-141,1456,1321,7898},
+	{7433,8321,6805,3592,2671,2460,3121,8006},
+	{8683,8939,8164,3467,1134,1668,3022,9291},
+	{8916,7743,6584,1599,1109,2631,2375,8236},
+	{10072,8569,6551,935,657,2623,3242,8023},
+	{10156,9522,7340,2030,1364,3362,3273,8641},
+	{7706,7135,6384,2115,1356,3131,3311,8813},
+	{8734,7028,5854,1443,622,4296,4968,9160},
+	{7487,7488,7442,2061,2806,2086,3752,7432},
+	{8515,7683,7775,1899,1723,2254,3573,8901},
+	{9066,7461,5957,516,1818,4145,4137,8092},
+	{11431,7350,6120,1853,3202,6429,7379,9388},
+	{9306,8222,6449,1520,2622,4555,4701,8487},
+	{9306,8314,7783,1314,2177,2252,3622,8299},
+	{8621,7525,6576,3860,2149,4700,4750,9410},
+	{8742,6927,6375,3863,3231,5996,7578,10945},
+	{8961,7301,7475,3308,3027,5542,6869,10139},
+	{9476,9157,8113,1431,1892,3255,4124,9558},
+	{9574,8278,8041,1904,2621,4459,5815,9756},
+	{11566,8720,7810,2386,2183,4915,6689,10369},
+	{10996,9269,7417,2367,1556,4603,5246,9757},
+	{10058,9609,7936,2822,2423,3486,3481,9484},
+	{10076,9098,8180,1962,3275,3510,3738,8967},
+	{5248,7640,7546,5145,4660,972,1301,4293},
+	{5617,8057,7551,4407,3994,488,-261,4203},
+	{5875,8173,7504,4719,4772,1215,774,4222},
+	{5915,6963,7310,4783,4200,2134,2144,5420},
+	{7466,8268,7243,4594,4862,3702,3967,5169},
+	{6783,8736,8544,5485,5940,2995,3103,5092},
+	{5956,8995,8489,4738,4010,1160,119,5282},
+	{8121,8099,7966,3055,3450,2102,3055,5992},
+	{6538,7722,7084,3929,3297,1981,2894,6295},
+	{5806,8283,7228,3887,3499,2385,1805,6050},
+	{7487,8425,7832,4607,5209,5070,4210,6957},
+	{7737,8919,8474,4215,5372,3074,2436,6677},
+	{8108,7240,6890,1979,3788,2739,3480,6238},
+	{8510,7684,7590,2414,4240,4068,3123,7667},
+	{8115,8220,6819,3368,3967,4413,4275,7743},
+	{8676,7931,6623,2296,3463,4969,4402,8712},
+	{7062,7111,6241,5125,3962,4864,5638,8106},
+	{7344,7330,7701,4645,4815,4026,5347,7425},
+	{6409,7669,7011,4604,4194,3535,4587,7171},
+	{7448,8221,7790,5237,4377,3827,4907,7872},
+	{8386,7406,5839,3077,3972,4994,4790,7693},
+	{8119,7837,7754,4209,4245,3980,5310,8356},
+	{8618,7912,6801,3655,4336,5159,4831,7652},
+	{9213,8215,7826,3647,4969,4194,5063,8366},
+	{8748,6900,8097,5554,4532,5512,6057,8497},
+	{7990,8000,8216,5473,4961,4672,6737,8853},
+	{9034,8633,8520,4524,3619,3861,4424,8670},
+	{9890,7882,8513,4884,3595,4837,6206,9888},
+	{11265,8257,8069,3667,3588,5255,6742,10142},
+	{10020,8550,7246,4738,4629,5476,6231,8857},
+	{11375,9649,8611,2247,3285,4126,5499,9222},
+	{6200,7065,6960,5265,5786,5569,5156,5832},
+	{8432,7451,7895,5178,6767,5685,5614,6945},
+	{8069,7515,6668,5486,5809,6551,6076,6768},
+	{8209,7578,7771,5296,5517,6101,6584,7928},
+	{8870,7142,7115,5016,6555,6838,5912,8325},
+	{10167,7206,6780,4228,5220,7707,7797,9253},
+	{8913,7309,7273,5029,4748,6185,7303,9587},
+	{11138,8937,7613,4438,5163,7156,7589,9397},
+	{10864,8952,7923,3828,4474,5700,5970,9600},
+	{8662,6897,6815,5334,3590,6792,7299,10000},
+	{8718,7786,7208,4363,3312,5714,7234,9977},
+	{10000,9222,8075,4968,5085,7770,7844,10880},
+	{11156,9714,8335,4826,5591,8023,7473,11054},
+	{11636,8030,6488,2242,3420,6215,6930,10431},
+	{11782,9094,7537,3386,4267,5757,6343,10308},
+	{13140,10331,8005,3934,4520,7204,7591,11804},
+	{9669,7023,6694,5084,4166,7895,8154,9405},
+	{9094,7013,7282,5258,5279,7682,9868,11025},
+	{9142,7289,7277,5057,5203,7344,9265,10241},
+	{10401,7942,7403,5466,6991,10181,9183,11264},
+	{11218,8218,6255,4496,4562,8061,8366,10639},
+	{12157,6881,6226,4972,6697,9475,10293,10206},
+	{12532,7470,5713,3796,5053,8742,9370,10913},
+	{11878,8935,7591,5255,5199,7683,8583,11129},
+	{9814,7522,6565,4830,4968,7681,8942,11267},
+	{10920,7396,6843,4479,4127,7947,9418,11793},
+	{11658,7603,7312,4512,4728,9217,11831,13924},
+	{11675,8191,6661,4945,6039,9638,9415,11795},
+	{12488,7563,5926,5188,7188,12747,12817,12616},
+	{14504,7776,6827,5286,5054,10494,12685,14425},
+	{13075,8345,6817,4084,5606,9041,10213,11844},
+	{13117,8750,7292,4271,4116,8128,9638,12183},
+	{9547,7075,7071,5554,5593,7767,9491,11429},
+	{4843,7241,7590,6320,6509,2654,3994,4734},
+	{6016,7745,7534,6538,8008,6318,6068,5166},
+	{4882,8609,8533,7267,6908,2360,3521,5805},
+	{6211,8637,8385,8160,6528,5401,5189,6088},
+	{7118,7103,7939,6477,6421,5295,5109,6075},
+	{6597,7780,6931,5591,5889,4535,3919,5892},
+	{6698,9351,8614,6282,6328,3326,2010,5814},
+	{5754,8860,7924,5684,3999,1654,1805,6197},
+	{6653,7510,7820,7895,6758,6225,5907,7523},
+	{5958,7726,7905,7383,6779,5461,5236,7179},
+	{5938,8117,8459,6187,4817,3295,3717,6650},
+	{7341,8933,8415,5866,4364,3526,4147,8495},
+	{7676,8441,7996,5755,6446,5077,4071,6684},
+	{8162,9228,7821,6554,6304,4733,4730,6498},
+	{7998,10162,8654,7272,6116,5213,5188,6863},
+	{6563,7887,8516,9157,6756,6675,6132,7898},
+	{5405,7309,7438,9021,7449,6602,6187,6203},
+	{7411,7407,7176,6926,5506,5977,6523,8106},
+	{7271,8136,7676,7513,7022,7119,7543,8041},
+	{7712,8116,8353,6951,7534,7022,7138,6967},
+	{7887,7073,6337,6266,6149,6782,7112,6910},
+	{8117,8128,7989,6462,6437,5915,6585,7840},
+	{8369,9520,8590,7759,7517,6194,6489,7093},
+	{8721,8736,8377,6907,7950,6532,7341,8306},
+	{8621,7231,7635,6308,4416,6919,6760,9529},
+	{6453,7525,7443,7195,6392,5662,6757,8431},
+	{7097,7732,7303,6654,4694,6192,6545,9003},
+	{8787,7842,7747,6605,5066,6733,7872,9685},
+	{10264,7269,8426,6290,5123,7233,7840,10132},
+	{9952,8315,8251,6423,6104,7100,7784,9037},
+	{9509,8464,8242,6489,7941,6450,7461,8380},
+	{9426,7651,7804,5832,7414,7365,7484,7957},
+	{7606,6933,6540,6777,7769,7426,6784,6622},
+	{6966,7505,7912,8427,6938,7741,7927,8163},
+	{7235,7897,6964,7498,7525,7493,6701,7256},
+	{7796,6882,5846,5781,6474,7907,8505,8071},
+	{8321,6921,5711,7633,7948,9323,9613,8572},
+	{9797,6996,8221,7521,7270,8692,9170,9689},
+	{8511,7887,8278,7398,6272,7373,8314,8829},
+	{11048,9819,8443,6890,7972,9264,9542,10370},
+	{9422,6928,6764,7408,6256,9014,9806,10787},
+	{9012,7197,7612,7181,6559,8519,9560,10521},
+	{9569,7419,6808,6258,5390,9042,8905,10704},
+	{9614,8246,7812,6722,4590,7844,8487,11097},
+	{11056,8032,7170,6147,4312,8596,9394,12562},
+	{9622,8072,7219,6987,5508,8164,9108,10957},
+	{9987,8088,7483,6361,6914,9212,8907,11071},
+	{11770,9534,7972,7202,7554,10442,10000,10964},
+	{8732,7067,6118,8124,7976,10368,10578,9380},
+	{9396,7418,8489,8782,7780,9383,10249,10063},
+	{9614,7677,7702,8647,7935,9208,10450,10576},
+	{9758,7151,8044,9023,7954,10290,11003,10365},
+	{10090,6933,6516,6242,7434,9014,10334,10194},
+	{12495,8192,6631,6505,7549,11489,11695,10794},
+	{12259,8218,6156,5916,6090,10867,10879,10750},
+	{13057,8871,8198,6117,7461,9362,10100,11187},
+	{11886,7137,6429,6527,7260,11859,12139,12117},
+	{10939,8718,8023,6360,5837,8792,10402,12438},
+	{12034,9241,7858,6204,5876,10252,10182,11348},
+	{12516,6951,6269,6814,7083,12528,14312,14129},
+	{12970,7833,7683,6002,6821,10906,12018,12388},
+	{12794,7964,6787,6395,6450,11503,13070,12906},
+	{12755,8797,8171,6858,7682,11966,11451,11714},
+	{9927,8076,7672,7912,8011,10534,11167,10026},
+	{5390,7278,7750,10160,8803,8503,7304,5934},
+	{5281,7666,7675,7432,8479,7054,5981,5485},
+	{5720,8467,7771,9091,9763,6206,5948,4080},
+	{5790,8467,8291,8632,8176,5340,5738,6269},
+	{6210,7796,7719,9327,9099,7559,7396,6148},
+	{8478,8394,7607,6938,8219,7069,7590,5914},
+	{8021,8477,8051,8751,9223,8018,7792,6429},
+	{7252,8729,8662,8021,8061,6795,5724,6510},
+	{6490,7225,8607,9562,8247,7391,7242,7411},
+	{5909,7562,8032,9131,9868,7554,7754,6569},
+	{6611,9098,8544,7078,8572,6474,4615,6707},
+	{6699,7748,8558,8410,8074,6752,7281,7297},
+	{8644,8458,7516,6425,8057,8108,7166,8539},
+	{8060,8956,7776,7799,8473,6870,6676,6717},
+	{9024,9389,8195,7664,8484,7943,7812,8234},
+	{5682,7196,7891,10096,10999,9002,7837,6201},
+	{6179,7175,7662,9408,10797,9267,10174,6849},
+	{4783,7643,7778,11536,10812,9671,9319,5993},
+	{6567,7815,7487,9134,9717,7747,8119,6046},
+	{6783,7723,7063,9775,10392,8101,7963,4635},
+	{8053,7135,7855,8681,10101,9438,9095,7641},
+	{7842,7605,7399,8924,9315,9123,7961,6910},
+	{6795,8040,8349,9724,8464,9063,8293,7266},
+	{8980,7235,5984,7052,8099,8706,8510,7842},
+	{7949,8517,8029,8210,8624,7251,8020,8156},
+	{7932,8706,7756,8901,8976,9332,8772,8020},
+	{8530,9402,8631,8752,8670,8222,8312,8320},
+	{8612,7137,6760,6774,8069,8007,8311,8011},
+	{10468,7868,7350,7097,8993,9083,9561,9008},
+	{9341,8176,8573,9180,9624,9656,9927,8963},
+	{8802,8458,8587,8542,10388,8572,9165,8054},
+	{8820,7564,8396,9978,8117,9675,9570,9566},
+	{5560,7206,7675,11934,11540,10778,9486,7015},
+	{6106,7822,8082,12490,11652,10405,10442,7628},
+	{5631,8118,7795,11797,11798,10985,9522,5179},
+	{8163,8790,7948,9910,10918,9704,9524,7504},
+	{8453,7045,6473,9562,10888,10321,10469,6411},
+	{8813,8127,8123,10783,11089,10951,10927,7483},
+	{8384,9010,8374,10888,11624,9822,9930,7110},
+	{7315,7132,6932,8127,8082,9877,9124,7854},
+	{7586,7172,6660,9436,9031,10344,10667,8337},
+	{8626,7764,7137,9092,8530,9937,9212,8017},
+	{7030,8005,8198,10544,10095,9813,9514,8350},
+	{9510,9695,8592,10161,10255,10353,10504,8263},
+	{10496,7572,6930,7147,8777,10324,10331,9419},
+	{9569,7650,7722,6522,8979,10694,9397,9391},
+	{10863,8950,7660,8381,8104,10470,10098,10403},
+	{8792,7639,7174,8710,9801,11680,10929,8604},
+	{6706,7097,7066,11190,12152,12494,11975,7308},
+	{7486,7343,7802,11876,13324,11856,11677,6284},
+	{8088,7428,6488,10676,12055,13237,12622,7609},
+	{8422,7543,7368,11014,10766,12236,11200,8535},
+	{10069,6889,6839,8120,8830,10651,11237,9597},
+	{8595,8753,8543,9794,10710,10611,11651,9311},
+	{10013,8879,7553,8392,9443,11335,10955,9518},
+	{10386,6971,6406,7564,8334,11007,11664,9674},
+	{8127,7083,7229,10217,9472,12416,13227,10725},
+	{8537,7629,8491,10360,8993,11902,11210,10360},
+	{8678,8620,7836,9173,8084,10132,11231,11650},
+	{9891,7095,7116,8163,8114,11980,12504,11067},
+	{11810,6958,7117,6896,9241,12496,11995,11348},
+	{10543,6961,6411,7900,8950,14377,13959,12025},
+	{10875,7336,7260,6352,8958,11308,11147,9951},
+	{8256,9687,8663,9578,9986,9476,9065,8520},
+	{6967,8739,8855,7370,5955,4027,3724,6179},
+	{5739,9026,9048,5742,6352,1392,753,3025},
+	{6239,10292,9671,8108,6378,2441,2881,6780},
+	{7042,9049,9451,5375,3863,670,807,5970},
+	{7174,8038,9501,5950,4289,3113,3482,6277},
+	{7387,8970,9680,4760,3161,257,1335,6373},
+	{8554,10020,9725,4905,4081,497,2250,7288},
+	{8405,8939,9492,2707,1060,-1058,608,7323},
+	{7796,8835,9202,4555,2278,1208,2220,7861},
+	{8192,9406,8913,4222,4117,2890,3233,7350},
+	{7118,9449,8962,6602,4540,3363,3493,7677},
+	{8564,9241,8969,4238,3474,1423,2495,7534},
+	{8830,8015,8781,3552,3471,2826,3410,7946},
+	{9443,10065,9602,2725,1469,376,2130,8558},
+	{10341,10689,9276,3950,2965,2729,3592,10096},
+	{10399,12281,11606,5782,6148,2952,3737,7197},
+	{7021,9000,9063,6629,5616,4313,5853,8528},
+	{6630,9444,9111,7238,6086,3318,4503,7406},
+	{6926,10023,9914,8002,6289,4449,3983,8074},
+	{7916,10026,9041,6296,4828,4270,4525,7176},
+	{8323,8025,8797,4834,4480,3689,3928,6649},
+	{8126,8199,9364,6168,3806,4146,5113,7820},
+	{9990,11528,11722,6558,5863,3769,4460,8729},
+	{9019,9544,8829,4803,4641,4219,4472,8818},
+	{10952,10059,9217,2947,3170,3970,5450,10943},
+	{10882,10389,9858,3948,2778,2447,3797,9440},
+	{9856,11600,11007,5847,3429,3597,4043,9728},
+	{10975,11239,10587,5414,5469,3998,4457,9436},
+	{11022,10624,10747,5719,5889,4369,5107,9192},
+	{13726,12724,11189,4282,4474,3439,4801,10851},
+	{14254,13265,11156,4704,4085,4070,5014,11720},
+	{9599,9545,10383,6154,4991,4511,5497,8848},
+	{9511,8377,9092,5834,4896,5419,6214,9527},
+	{8968,9173,9565,6133,4828,4732,4897,9400},
+	{8522,9333,9945,5919,5223,4715,5650,8676},
+	{9556,11156,11606,7803,5656,4918,5062,9320},
+	{9721,9313,8714,3158,5018,4929,3765,9608},
+	{10147,9704,9984,4197,5890,4738,4195,8439},
+	{10501,10310,8665,3728,3972,4563,4438,8834},
+	{8765,8552,8729,5735,4604,5701,5507,9628},
+	{9133,9171,9481,5392,4526,5216,6343,10302},
+	{8696,9737,9112,6302,4370,5082,6213,10414},
+	{10346,10598,10479,6393,5111,5086,4824,10357},
+	{10750,9675,9654,5590,4611,5898,6201,10709},
+	{10916,12321,11360,6644,5292,4940,6249,10812},
+	{13466,13009,12087,6493,6252,5125,5848,10798},
+	{13646,13125,11160,5994,6174,5714,5829,10996},
+	{9337,10963,10040,6472,4667,5312,6432,11390},
+	{8537,9005,9006,7684,6286,6858,7715,9264},
+	{9349,9534,8751,6382,5968,7230,6459,8559},
+	{9054,10355,9277,7276,5379,5904,6841,10494},
+	{10185,9659,9829,5395,5857,5626,6685,10152},
+	{11018,9420,9591,6914,5993,7208,8452,10306},
+	{11391,10242,9059,5247,6371,6226,6773,10385},
+	{11496,10468,9769,6185,5656,6884,7501,10520},
+	{10321,8884,9107,5406,3926,5838,6663,10642},
+	{11322,9284,9573,6141,5456,8209,9345,11359},
+	{10135,9935,9717,6484,5163,6932,7053,11556},
+	{10959,10308,9558,7477,5522,8722,9407,12735},
+	{11663,10980,10974,6819,6252,8194,8818,12355},
+	{11757,9469,8738,6581,4863,8902,10303,12716},
+	{12563,10679,9815,6326,5134,8495,10543,15008},
+	{13289,14592,14605,8177,6146,5713,7415,13059},
+	{11004,12050,11357,7647,6388,6384,6382,11643},
+	{5048,8067,8775,7840,6503,2976,2176,4139},
+	{5059,8618,9203,7444,6957,2373,1595,4464},
+	{5130,8851,9646,7656,6752,3072,3176,5226},
+	{5683,9954,9677,7846,7102,2571,2793,5112},
+	{5998,9159,10245,8090,6762,3697,3801,4868},
+	{6208,10040,9764,8169,8377,2953,2420,4513},
+	{7571,10341,11218,7416,6827,2039,2300,5572},
+	{7617,8356,9002,7327,7082,5018,4647,6281},
+	{7807,9005,9310,6803,7752,5524,4528,6725},
+	{7147,9716,9779,7607,7528,4177,3722,6709},
+	{7541,10224,9372,7125,6733,4631,4092,6683},
+	{7892,9006,9222,7018,6848,5384,4805,6542},
+	{8765,11056,11209,7867,7929,3194,3477,6617},
+	{9064,11243,10332,7023,6480,2641,3250,7120},
+	{10177,11615,10595,6656,6410,3294,3394,7843},
+	{9478,9916,9244,5534,6476,4112,4944,7875},
+	{7596,8822,8705,7080,7126,6222,5852,8145},
+	{7081,9051,9689,7328,9149,6115,5283,6085},
+	{8471,9519,9284,6818,7193,4340,5468,6958},
+	{8947,8499,8771,5884,7287,6263,6013,7472},
+	{9923,9730,9352,6816,8126,6615,7099,8992},
+	{9288,9996,9908,7461,7168,5878,6113,8219},
+	{10276,12514,11780,8292,8306,4136,5092,7562},
+	{11573,12033,11486,6737,6975,5626,5882,9137},
+	{8970,9915,9787,8057,7254,5994,7335,9816},
+	{10198,10187,10467,6282,6489,5639,6615,9811},
+	{10764,11549,11998,7392,6502,6004,7628,11347},
+	{11196,11013,10461,5065,6464,6568,5698,10738},
+	{12576,12618,11245,6469,6898,4935,5311,9687},
+	{11908,13170,13559,8258,6900,5580,5413,10459},
+	{12271,13527,13043,7518,7898,5571,5282,9760},
+	{9044,9390,9447,7622,6746,6626,6787,8293},
+	{10087,9222,9622,6374,7422,7158,6709,9221},
+	{8888,9377,8723,7462,7404,6797,7160,7572},
+	{10084,10244,10371,6564,8273,6840,6539,7811},
+	{10113,10735,9565,7206,6905,6813,6130,8868},
+	{10475,9724,8736,6019,6872,6636,7117,8453},
+	{10482,10557,9383,8040,8525,8139,7147,9423},
+	{11115,11537,10974,7137,8645,6826,6709,9427},
+	{10938,10951,10699,6111,7990,6838,6139,9838},
+	{10751,10112,10020,6814,7813,8130,7269,10934},
+	{10316,10745,9869,7360,7258,7554,7562,11467},
+	{10737,10781,10469,6293,7200,7602,7045,10326},
+	{10903,9590,9941,6526,7788,7969,7715,10596},
+	{11649,12184,12239,7939,7880,6661,7410,11254},
+	{12709,12805,12563,7248,8632,7180,6850,11158},
+	{12076,13971,12878,8118,8446,6933,6453,10303},
+	{12302,11888,10691,5848,6454,7890,7877,12228},
+	{9734,9530,9221,7991,7387,6650,7964,9787},
+	{9480,10149,10200,8213,8939,7274,7978,9759},
+	{9480,10433,9238,8108,8646,8159,8123,8838},
+	{11746,9748,9813,7291,8326,9359,9572,9828},
+	{11846,10104,9404,6646,7788,8618,9001,10874},
+	{12055,11057,9511,6451,7000,7746,8150,9783},
+	{12056,12049,11529,7898,8344,7441,7956,10114},
+	{12305,11592,11687,7292,8482,8672,8548,11310},
+	{11026,9256,8795,7836,6665,9309,10992,12257},
+	{10412,9734,8753,7993,7833,9336,10411,11813},
+	{11758,11744,11905,7625,8532,8242,9026,11351},
+	{11883,9409,8823,6683,7231,9408,10999,12630},
+	{13942,11170,9438,5680,6434,9791,10311,12652},
+	{13454,12677,11256,7092,6400,9033,9574,13256},
+	{12753,13948,13213,8192,6766,6868,8158,12528},
+	{8412,9641,9166,8299,8251,8190,8006,8986},
+	{5353,8812,9515,9174,7729,3636,3871,4725},
+	{5617,9551,8843,8350,7933,3322,3206,4973},
+	{5531,11608,11259,11253,9818,4243,2840,3959},
+	{6139,10884,10491,8478,6684,1376,1886,5536},
+	{6319,11113,11822,11881,10019,5943,4921,5903},
+	{8001,12208,10945,9293,8634,4670,4066,5988},
+	{7314,12334,12025,10728,9792,4772,4890,5838},
+	{8295,10751,11920,9146,8260,5647,5162,6812},
+	{7145,10529,10668,8854,7094,3082,3767,7211},
+	{6243,10915,12028,11556,9180,5422,5093,7102},
+	{7045,11828,11455,8689,6570,2808,3505,7231},
+	{7251,11331,10846,9369,7863,4893,5062,7254},
+	{7399,10632,11449,9615,8893,4864,4454,7171},
+	{7549,11244,11923,9795,6977,4140,4049,7690},
+	{7531,11620,12322,10921,9257,4708,5124,7202},
+	{5439,10360,10763,9796,9332,4978,5274,5679},
+	{4998,8860,9052,9846,8276,5817,6228,6125},
+	{5218,9265,10343,10074,9403,5466,6376,5676},
+	{5333,9750,10211,9660,8938,4684,5802,6309},
+	{6782,9701,10103,9012,7573,5036,6186,7123},
+	{7527,9579,8740,8359,7825,6039,5480,6594},
+	{7141,10310,10244,8948,9497,5914,6356,6813},
+	{6958,10348,12136,10677,9776,5626,5352,5537},
+	{6702,9525,10038,9424,8711,5696,6207,7962},
+	{7956,10099,10541,8704,7542,5829,6120,8256},
+	{8721,10367,10918,8449,7819,5545,5865,8827},
+	{8818,10753,12250,10068,8146,6136,6759,8623},
+	{9114,12910,12552,10152,8562,5271,6214,8588},
+	{9719,12785,11360,9385,8690,6002,6218,8780},
+	{12471,13174,13796,8562,6389,5055,6284,11712},
+	{11965,13757,12097,8710,7878,5624,5820,9616},
+	{8968,11528,11392,10305,8854,6184,6236,8770},
+	{5785,7591,8722,8706,8793,6774,6927,4705},
+	{6220,9829,10522,11151,9749,6671,6320,7588},
+	{4947,10444,10939,12201,10003,6822,6711,5905},
+	{7000,8475,8996,9571,8715,7613,6506,6576},
+	{7417,9642,10020,9235,9804,7159,6755,7587},
+	{7641,10100,10000,9904,9390,7162,6262,6970},
+	{9743,10889,9883,8408,8814,6607,6525,7066},
+	{6829,9398,9225,9638,7927,6681,6878,7600},
+	{8218,11149,11115,9519,9886,6194,5547,7940},
+	{8894,11267,12011,9301,9188,6501,6474,8903},
+	{7572,11518,11827,10693,8274,6498,6851,8171},
+	{10090,11758,11619,9195,9978,6910,6484,7953},
+	{11233,12352,12415,8416,6492,6350,6655,11949},
+	{12071,13107,13090,8356,8682,6595,5848,10393},
+	{11637,14124,13914,9626,8877,6828,5865,10431},
+	{9249,11593,10612,8702,9690,8074,6933,9017},
+	{6422,8166,9031,10079,9972,7272,7530,6645},
+	{6894,8491,10017,11158,9205,8494,8476,7813},
+	{6411,8499,8992,9668,9158,7133,7096,5779},
+	{7587,9424,9224,8431,7749,6425,7027,7347},
+	{8749,8885,9693,10388,9444,9757,9260,8772},
+	{8704,9840,9560,10598,9107,8762,9028,8818},
+	{10837,12118,11125,8636,9535,7116,7347,8694},
+	{10600,11426,12139,9215,8755,7142,7173,9313},
+	{9424,10134,10753,8552,7290,7823,7605,10477},
+	{9616,11073,10851,9931,9356,8766,9272,9689},
+	{8872,11468,11318,9759,8316,7820,7621,10448},
+	{9723,9871,10130,10108,8957,10342,9485,10025},
+	{9964,8473,8816,8432,7719,8871,10586,11053},
+	{10209,10163,11273,8927,6339,8097,8272,10748},
+	{10174,10530,9574,8750,8905,8245,8107,9398},
+	{7764,11029,11584,9624,10065,4998,5382,6306},
+	{4811,9350,10035,9752,10487,5324,3785,3809},
+	{5045,10496,11050,11127,11575,6189,4588,3317},
+	{4893,11616,14459,14324,11422,4617,4129,4022},
+	{5381,9950,11173,11447,12014,5552,4860,3649},
+	{5446,10777,11544,11905,11722,5163,4371,3837},
+	{6519,11361,11004,11005,10440,6059,4991,4397},
+	{6055,11924,12702,12297,11181,5239,4825,4477},
+	{5437,8934,9477,9947,10069,5815,5219,4704},
+	{5267,10888,11508,11530,10397,5835,4966,5622},
+	{5130,10932,11258,12482,11133,6358,6090,6780},
+	{5180,11421,11829,11565,10275,5357,6041,6487},
+	{6611,12164,11976,12704,11630,6817,5863,6034},
+	{6811,10655,10910,10821,10686,5628,5762,4852},
+	{7479,11647,12834,12691,10468,6175,5338,6895},
+	{8616,13218,14266,12461,10361,6361,6015,8036},
+	{9302,11667,12118,9937,11449,7563,6138,7679},
+	{6099,8427,8678,9491,10812,6785,7020,5178},
+	{5995,8729,8700,10388,10687,7421,6735,4740},
+	{5909,9496,10916,12484,11500,7597,7196,5503},
+	{6180,11288,11862,11987,11029,6731,6827,6047},
+	{6655,10433,10828,10891,12077,6946,7269,5730},
+	{7768,12147,13065,11251,11013,6199,6229,5788},
+	{7849,12226,12998,12323,13429,7071,6255,5427},
+	{6013,10832,11083,12255,10726,7779,7726,6603},
+	{7489,10250,10777,10593,11575,7135,7778,7345},
+	{6719,10513,11424,12679,10279,7392,6930,7990},
+	{7972,11579,12746,12055,11240,7597,8539,8393},
+	{8109,10769,11873,10788,10118,6963,7494,9137},
+	{10138,10988,11382,9046,10236,6800,6423,8146},
+	{8492,12675,13114,11363,11231,7453,6594,7192},
+	{9183,13368,14104,11821,11885,7085,7217,7582},
+	{5345,9438,10455,11319,12031,7801,6854,4940},
+	{5213,9699,10934,12650,13559,8254,6756,5339},
+	{5801,9935,11249,12877,12280,8058,7027,5423},
+	{5667,10868,13567,15408,13511,8343,7798,6007},
+	{6494,14519,14758,14749,12774,7825,6647,6679},
+	{6683,7978,8836,9968,11288,8037,7459,5496},
+	{6703,9397,9682,11042,10756,9677,8143,6810},
+	{7331,9540,10314,10061,10701,8284,7261,6750},
+	{7683,11612,11411,11799,10272,8583,7680,7026},
+	{5959,9428,9883,11040,10614,8043,7582,7324},
+	{7122,9682,9690,10217,10210,8505,7563,7552},
+	{7294,11560,11323,12183,12204,8423,7176,7134},
+	{7428,11895,12696,12128,11051,7951,7367,7452},
+	{7561,9787,11009,11381,11727,8522,8256,7431},
+	{7660,10071,9976,9676,11020,8265,7393,7426},
+	{8448,12099,11612,11598,10264,7997,7759,8319},
+	{6061,9843,11446,13189,12795,8944,8451,4888},
+	{5870,7830,9301,10964,10633,8995,8914,5636},
+	{4834,8075,9152,13480,12592,11053,9339,5835},
+	{5163,8290,9736,12626,13047,9799,8582,3699},
+	{5929,8928,9284,11572,11559,9882,9623,6516},
+	{6631,7508,9422,14182,14354,13453,12729,6299},
+	{5945,8755,9705,13932,14484,11812,9807,5581},
+	{7345,9518,10634,11955,12681,9916,9663,6228},
+	{5031,9742,9714,12131,11061,8922,8555,6861},
+	{6059,8265,9535,10966,10246,8862,9295,7251},
+	{5501,8331,9216,11545,11780,9707,9480,6866},
+	{5968,8668,9918,12454,10987,10188,9710,7494},
+	{6117,10616,11007,13649,12960,10792,9952,7566},
+	{7002,9292,10208,12129,12612,10861,9980,6903},
+	{8321,10275,10482,10146,10188,8553,8524,8788},
+	{9432,10660,10098,9667,10589,8738,9058,7491},
+};
+static const int16_t seed_X[seed_count][8] = {
+	{-220,1073,12495,1022,2218,-319,-154,-23},
+	{-1170,-945,12229,-2020,2216,1397,1050,786},
+	{-344,-867,12571,-1167,1323,-762,370,-1473},
+	{179,-1695,12301,-205,-745,-2546,1323,351},
+	{652,-132,13335,2122,-1813,-1587,-378,1165},
+	{-1310,1320,12343,1331,2949,-2449,-508,-1656},
+	{-1151,-158,13715,-1024,2995,1537,-1793,1969},
+	{33,466,13148,2009,-2787,-1097,1766,-1903},
+	{-2331,758,12582,2537,1851,139,519,-689},
+	{-394,-93,13723,-841,-2571,-1090,-1397,190},
+	{-1744,-497,13056,-840,-686,-1609,574,-458},
+	{-924,-58,13232,1828,249,-2033,616,1969},
+	{-2423,-106,13159,-1576,2923,498,199,-906},
+	{-1672,382,13810,1339,1224,-444,-39,-1916},
+	{-3008,349,13735,1362,1208,-379,17,-1589},
+	{-2895,-659,14547,-688,1667,-2222,-1947,-1420},
+	{974,1478,12635,1530,-1691,-1224,-765,1981},
+	{-144,2387,12733,2408,647,-1015,-694,-1501},
+	{598,1518,13164,212,-1157,259,-139,1865},
+	{997,1762,12016,1705,-1849,-1852,1503,672},
+	{536,2385,12507,2085,-992,2610,645,179},
+	{-353,1139,13541,-936,-168,43,-768,289},
+	{-1122,213,13973,-2971,-928,1826,-1372,-763},
+	{-765,717,14114,2704,-1037,-213,-112,-143},
+	{-2320,180,13311,-444,1369,-1382,1756,-842},
+	{-2747,-792,13557,-2347,2994,-1690,52,1356},
+	{-2097,516,14390,2300,1040,-2282,-1503,1387},
+	{-1085,86,14004,353,-2969,266,1150,1116},
+	{-2163,1111,14829,634,-899,53,-1807,1770},
+	{-3659,1044,13145,-305,2001,1209,-313,276},
+	{-1844,630,14066,-155,-2930,-663,221,-630},
+	{-3937,239,13369,158,2342,230,1721,-1169},
+	{-2423,1140,13916,1155,1260,-1909,911,1801},
+	{88,2230,12829,-334,-24,-2627,1149,1601},
+	{-1704,1100,13291,-2426,2711,-1369,1213,412},
+	{-1511,2410,12859,1820,-755,-2543,856,548},
+	{-726,2654,12875,2921,-1281,-1785,603,-892},
+	{-2240,3167,13669,2728,1455,-438,-1393,-1208},
+	{-1736,1356,13582,79,2157,-970,734,-130},
+	{-653,1520,14829,894,-2441,-2082,173,-111},
+	{-2748,2189,13938,-106,1347,2811,-662,-16},
+	{-2596,1598,13839,-703,1253,793,479,1412},
+	{-3456,2103,13499,1757,2748,-2978,340,1975},
+	{-2060,1075,15551,-121,-327,-2942,-84,1610},
+	{-2891,2533,14243,2462,1137,-34,-366,120},
+	{-3479,1474,15047,1224,2447,822,-1773,-1702},
+	{-2847,1776,14947,1749,672,-2806,-666,-834},
+	{-1429,1590,16209,1961,-2644,-2026,-1422,1451},
+	{-494,2847,13049,679,1679,1916,1580,1309},
+	{-2213,3565,13389,-750,412,-375,1786,580},
+	{-3181,3067,13468,1461,842,66,493,924},
+	{-1622,2832,14065,-661,-2617,-1419,898,-1092},
+	{-2874,3564,13739,2940,559,-286,-351,193},
+	{-2663,2856,14114,-959,-412,-422,614,-824},
+	{-2964,3766,14169,2753,2783,1019,1008,177},
+	{-2594,2734,14725,2556,-2347,-1509,-1831,-1607},
+	{-2934,2344,14425,840,423,2001,-1178,1371},
+	{-2672,3508,14141,283,-1331,-1288,-1279,-81},
+	{-1920,2742,14759,-2581,-876,593,925,541},
+	{-2238,2646,14767,788,-2376,-2903,-774,635},
+	{-3109,2269,15426,-1121,917,-2722,-633,1384},
+	{-3469,3178,14642,1990,2945,-787,-220,636},
+	{-3197,3693,15664,-518,-1206,-1727,-180,1347},
+	{-2766,785,15446,-1729,-2766,-2207,-2,1302},
+	{1206,-1056,12941,-1081,-2833,324,-730,345},
+	{1743,-268,13606,-2442,-991,1565,-964,-186},
+	{159,-1466,12692,-2920,1661,1733,-1168,-749},
+	{1525,-1849,12800,-1513,-1174,-1657,-807,-991},
+	{2067,-602,12755,-1710,-1985,1397,1798,-715},
+	{1656,1493,13548,436,-1607,504,-1567,-1394},
+	{555,-412,13344,-920,1616,-1564,521,-624},
+	{1196,-815,13328,715,-2863,2626,-1860,19},
+	{845,1097,13404,1564,-2770,2502,-1489,-1307},
+	{768,-57,13376,-2247,-2905,-993,519,-1524},
+	{231,-1128,13129,-2709,310,569,905,551},
+	{575,-582,14517,-906,-288,-618,-1655,-1919},
+	{585,-1541,13194,-1587,-2618,553,1065,-1401},
+	{-790,212,14496,-2269,2397,1803,-986,-1270},
+	{199,-427,13973,-1354,-2198,1972,677,465},
+	{-103,106,14238,754,-50,129,40,-1747},
+	{1086,1738,13699,642,-2902,-1543,-1451,1217},
+	{356,788,13070,-2785,2455,2748,1989,421},
+	{462,1386,13991,-1586,1430,1165,-1348,-982},
+	{67,840,13698,-2710,1122,-1650,465,-778},
+	{-969,1782,13581,-1129,2188,-124,1330,-1800},
+	{-487,3629,13066,1468,229,1459,547,-1630},
+	{345,1318,14151,-1983,-1401,2718,-628,-1427},
+	{-1359,1068,13207,-1725,1427,-262,1442,-1433},
+	{460,642,14079,-2062,-2033,1316,1526,-804},
+	{-1212,1698,14573,-428,1869,635,-9,1064},
+	{-775,1511,14993,52,1946,1229,-1225,-1087},
+	{-595,975,15187,-361,1502,-1398,-1914,-1536},
+	{-277,-286,15101,-2012,-2785,2560,-1604,-1115},
+	{-577,1794,15697,-351,-886,2060,-275,-1454},
+	{-2031,614,15614,-2244,1497,-119,-57,-1230},
+	{-1159,859,16606,-2561,-2969,1505,-1945,-1538},
+	{-1423,1621,15696,-2135,-1899,1505,328,1214},
+	{306,2836,13825,-110,-1809,-2431,1127,1184},
+	{-1669,3401,14525,-152,257,-2785,495,-752},
+	{-1459,3640,14597,1527,-312,-2845,1212,-630},
+	{-1513,2286,14570,-935,-995,-1964,287,-1825},
+	{-1752,3134,14879,6,-1204,2727,-532,-1331},
+	{-1559,3279,15524,1426,221,-2059,-1469,-1937},
+	{-1281,3218,15331,987,628,720,859,-1686},
+	{-1514,2738,15194,-579,1014,959,-97,1991},
+	{-1252,2386,15335,-2794,-865,-2679,-226,-541},
+	{-1270,2680,16532,-1931,-150,-236,-1982,-1968},
+	{-1667,1987,15988,-2823,-1772,-1843,-1315,-1186},
+	{-2776,1502,16199,-1061,2990,-930,-224,-420},
+	{-3425,1316,16440,-2634,1523,-1285,-1537,849},
+	{-1547,2063,16920,-1265,-323,-847,-693,-1519},
+	{-2073,1433,16636,60,-1017,-2177,-1825,-1530},
+	{-153,3516,14775,7,-1752,-781,361,1234},
+	{-907,3649,14090,-1874,-1517,-839,1670,512},
+	{-817,3817,15089,2195,-269,1093,-549,293},
+	{62,3356,15445,-543,-305,1372,260,-1894},
+	{-555,3297,15348,-2604,-671,944,868,-1583},
+	{-638,3846,15142,2530,-1082,2569,-1829,-1728},
+	{-1859,2897,15079,-495,1011,2621,593,-42},
+	{-1121,3985,15174,1284,-1054,2327,786,348},
+	{-1763,3033,15176,-237,-674,2678,1655,-208},
+	{-1207,3263,15170,-2044,-1267,1728,906,1567},
+	{-1379,3888,14958,-1830,-2234,-2393,340,-1758},
+	{-2472,2589,16229,-1391,1793,-780,-608,1122},
+	{-2387,3073,16034,-2867,213,-340,-1045,-234},
+	{-2747,3774,16373,125,1681,-202,-1217,-276},
+	{-2698,3108,16561,-2018,768,1764,-676,1317},
+	{-1302,3136,16105,378,-1441,1717,898,-1006},
+	{-706,695,15826,-2275,-465,-2364,-1547,715},
+	{1444,664,13710,1511,2408,-1241,-802,462},
+	{2653,728,14245,2421,482,-1035,-1793,-12},
+	{3068,334,13373,902,-399,-2689,203,-442},
+	{2724,938,13925,-1159,-884,1258,-1853,-1520},
+	{2214,1837,13668,2385,430,1516,-1079,-470},
+	{1186,1955,13827,1088,2262,488,853,-1264},
+	{2995,485,13418,-942,-2469,774,973,-532},
+	{2578,558,14124,597,-1757,1621,-1009,-701},
+	{2705,1794,14138,-1668,-9,-2272,-1447,-558},
+	{-15,610,13953,-1357,2187,-46,-145,1396},
+	{2967,489,14086,-1804,-2478,1206,-786,-237},
+	{1703,2751,13350,2988,-2854,-1903,926,-429},
+	{269,260,14832,524,399,15,-1581,469},
+	{1178,1173,15249,1191,-1216,-1682,-1723,474},
+	{247,487,15038,1020,1358,-2320,-1192,-1512},
+	{-418,604,14976,-2049,2837,-877,-55,1635},
+	{2608,2131,12979,-318,-2434,40,1998,1043},
+	{2119,1593,13454,1115,-697,1646,1772,1665},
+	{3134,2659,14272,2742,-1524,-1710,-1771,197},
+	{2258,1756,14404,-593,-1106,-396,-1076,-457},
+	{526,3076,13580,2792,1791,436,708,-647},
+	{2296,1448,14342,-628,-1305,2071,37,-821},
+	{2031,2268,14273,1916,-2895,-1482,595,-1249},
+	{2572,2392,15005,2036,-2131,-1837,-1862,-217},
+	{2627,2574,13372,-157,-2261,-2295,593,1504},
+	{2397,968,13687,-1986,-2246,839,71,1963},
+	{1734,1874,14069,161,-737,-563,799,871},
+	{2568,554,14602,-717,-2800,2274,-1035,1394},
+	{1428,1026,14575,-2438,-1114,1511,188,630},
+	{-138,1805,15529,448,703,-1361,-429,135},
+	{2580,710,14994,128,-2872,2554,-830,1235},
+	{927,569,15255,-1671,450,-2385,1083,-1594},
+	{961,2081,14361,-1407,2600,1303,1972,-628},
+	{1163,2364,15439,-626,2086,-1412,-1191,1087},
+	{2203,2359,15153,626,-177,-1998,1182,1460},
+	{1243,2860,14174,-952,1004,2274,613,-747},
+	{759,3868,14366,451,338,-1004,430,-1976},
+	{829,3339,14524,2913,15,-1984,-1210,873},
+	{1129,3042,15452,-271,-955,-158,-984,-1407},
+	{2082,1572,15133,-1844,-2499,-2814,26,258},
+	{-1371,3188,14284,485,2968,-2588,-927,940},
+	{-124,2904,14507,-63,683,-1663,420,-161},
+	{-449,1794,15134,-1968,2964,-1799,-154,225},
+	{-821,2249,14887,1557,1228,-2547,-424,690},
+	{-1483,3468,14274,1814,2126,-431,1,1964},
+	{113,2870,15183,1481,-836,-1060,-837,656},
+	{-732,2005,15369,-221,2262,312,976,-1007},
+	{-1142,3026,16131,1889,955,-2782,-970,1113},
+	{986,3852,14200,1537,921,2478,-1521,-96},
+	{2508,3059,13880,-2593,-1068,-2098,1157,274},
+	{1008,2689,15698,-1674,-1812,675,-1561,698},
+	{-67,2428,15692,-2516,105,-2299,667,678},
+	{1596,3261,15024,-2404,-2494,1888,860,-1574},
+	{930,2406,15713,-94,-1308,2487,-29,-678},
+	{756,2960,16656,2612,-938,852,-1666,1431},
+	{-315,3315,15550,-864,-313,-2556,1559,1215},
+	{-2064,3626,16407,-2198,2076,-1984,600,-165},
+	{-506,3256,17984,-1688,-517,-1824,-136,827},
+	{-1477,2178,16473,-515,-676,-2701,1470,778},
+	{-1149,3035,17352,-1404,-743,326,-1371,1726},
+	{-1533,2472,16977,-1306,811,557,98,-1037},
+	{-1309,2781,17214,-2981,-930,591,1333,-1064},
+	{-1276,1977,17393,-2153,337,-623,-1473,-44},
+	{1768,2873,14598,-1145,371,1146,-354,-1021},
+	{3055,3144,14654,-989,2852,-1839,-748,-353},
+	{3597,1644,13500,-1013,-591,955,-542,-492},
+	{3978,-497,12758,-64,-2782,1255,1153,-614},
+	{2266,3504,14011,1891,2504,-2292,506,-234},
+	{3529,-945,13549,-2794,-2687,1678,-1613,-1725},
+	{3079,1588,14270,1413,559,-1345,827,-497},
+	{2754,1882,14208,1000,-1122,-2367,1554,-1591},
+	{3699,2816,15091,1501,1602,-2014,-250,1099},
+	{2110,2195,15411,-2539,2280,-1964,-1284,-561},
+	{3046,1734,14356,-915,-1048,356,1892,1451},
+	{3348,2192,15454,190,-1961,-2881,-1826,1521},
+	{1568,515,15490,-481,2660,-2473,-1797,-540},
+	{3300,1521,14927,-905,-2774,583,-593,-961},
+	{903,2427,15607,1829,2968,-1942,-109,-1345},
+	{1010,1634,16827,-834,2811,-2637,-1962,-1958},
+	{1920,1082,16086,-2036,-2490,2294,-1563,-1561},
+	{3606,3606,12815,1424,-1661,1004,1928,335},
+	{2448,3083,14755,57,2709,1342,361,1751},
+	{3912,2840,13932,2824,1447,2500,1595,-43},
+	{2812,2159,14174,-1669,440,2454,1502,-129},
+	{2228,3491,13705,-1232,366,867,1494,-1069},
+	{3258,3735,14239,2208,-2480,-885,909,-131},
+	{3274,3495,14861,2289,311,310,1503,200},
+	{3781,3605,15164,2804,-2238,1419,-1475,-355},
+	{3098,3466,14077,-312,-74,1771,556,1863},
+	{2781,3532,15276,416,-1082,-864,-136,-738},
+	{3279,2594,16280,1622,-2360,-1481,-1934,1357},
+	{2427,2622,15448,-497,-2302,979,-1105,696},
+	{2000,2322,15840,867,-1945,1287,-1828,-1522},
+	{1169,2429,16819,-63,-182,888,-1956,88},
+	{1958,2332,16489,-565,-2580,890,419,1501},
+	{2832,2235,16914,-1571,-1283,1286,-384,-516},
+	{3075,3738,14205,-252,1681,1599,1619,-970},
+	{3332,2825,16043,-1481,2076,1781,516,696},
+	{2885,2256,16004,-2325,1301,1828,869,730},
+	{2248,2827,14962,-962,2895,1130,1795,-1850},
+	{2113,3060,16191,-1477,2833,2348,-326,522},
+	{2569,3143,15217,-2458,-1711,-2981,-1522,-1415},
+	{2276,2876,15872,-710,2204,-2149,1419,-440},
+	{2799,2870,15989,-2818,2470,-1708,-1064,1815},
+	{3014,3941,15645,2071,-2300,-1535,983,1970},
+	{3057,3066,16638,777,-835,521,-212,104},
+	{3015,2712,16840,-209,-1596,-699,-661,132},
+	{2332,1886,16686,-2805,-2400,-1699,1237,-73},
+	{-453,2718,16885,-1465,2616,-1108,-1455,-1581},
+	{142,3159,17767,-439,2117,-133,-1872,-499},
+	{1677,2912,16837,1200,-1655,-1495,496,-1267},
+	{2093,3708,15982,-586,365,327,489,-1236},
+	{3031,3391,15873,-2764,2129,2462,350,-1786},
+	{3997,3864,16333,-2473,-812,1601,-1187,-1546},
+	{3572,2896,16962,-2796,1799,120,-225,-238},
+	{3476,3980,15174,-2401,-2200,2353,1105,-1808},
+	{3240,3371,15380,-993,-955,2794,1764,-1426},
+	{2160,3769,15378,-37,-2222,2310,1248,-1367},
+	{3084,3654,16638,444,1435,2996,-388,-131},
+	{3374,3934,18337,-2581,1509,-592,-1499,-88},
+	{1926,3625,17745,-2160,2473,-272,-1894,-462},
+	{2248,2404,16006,-2496,-1774,-337,1962,102},
+	{2621,2581,17379,-2895,-2643,-1398,-1361,163},
+	{538,3146,16823,-2618,2211,1313,1429,-1868},
+	{1730,3955,17320,-1368,-1971,219,109,-24},
+	{80,3358,17931,-1628,264,-2056,-676,736},
+	{1813,3741,17944,-1303,-1198,-2384,-844,-599},
+	{1854,1955,14399,1111,2459,1426,1949,12},
+	{377,-1799,12783,-1621,530,-631,1921,1478},
+	{442,-1296,14012,-694,2674,-2191,-1607,-994},
+	{1625,-1337,14574,1555,-1451,1101,-1935,1380},
+	{-135,-3024,12526,-2558,-214,-155,1055,-1332},
+	{-693,-1223,13293,219,-213,1536,-350,-206},
+	{-1678,-647,13241,2379,1869,2952,1370,-619},
+	{-32,-1672,14165,1105,1365,-2166,412,-30},
+	{174,-2145,14702,-182,-2,-476,-1668,537},
+	{-915,-399,14076,2979,797,-1520,-979,1904},
+	{-603,-1867,13734,-2234,218,-2251,-709,-689},
+	{-424,-2191,14250,-1343,339,-501,-1322,1627},
+	{-1411,-1277,13875,1310,796,-2224,1044,1448},
+	{-3824,-935,12446,1667,2831,-2751,1845,-1186},
+	{-1888,-1748,13672,-597,2493,-1990,379,-1279},
+	{-1623,-1155,13588,465,-882,-2709,774,-612},
+	{-1593,-1671,13326,-1142,1936,2954,1309,175},
+	{387,-969,14331,-1946,-232,2658,-1078,1335},
+	{1328,-281,13759,2818,-2186,647,14,1188},
+	{1121,-1869,14577,-1332,-309,-250,-790,346},
+	{-191,-833,13512,-291,536,-366,1453,-1802},
+	{-162,-1837,14397,-1274,946,2682,-1112,28},
+	{-1109,-40,13747,2945,1162,2933,1342,-1786},
+	{-1504,-898,14772,1450,1361,2532,-718,-723},
+	{-968,-869,14850,-1551,794,2916,-1287,1043},
+	{-708,-291,14832,1157,-1273,117,121,1998},
+	{-309,-415,14935,1632,-2607,-1596,-1745,1318},
+	{-1323,-2118,13435,-2519,-2376,-2538,941,-1000},
+	{-1580,-1768,15015,-2717,177,138,-1121,17},
+	{-2606,120,13953,2075,1726,2490,1627,749},
+	{-2235,-590,14833,1961,-508,1554,-1943,1551},
+	{-2459,-1847,14702,-2713,-172,2321,-640,1929},
+	{-2870,-562,14991,1265,380,355,-35,-1199},
+	{-119,821,14227,1134,1613,2436,708,326},
+	{-197,410,14953,374,1474,2314,-1758,-164},
+	{631,-356,15093,-142,-1584,971,1584,679},
+	{-319,-681,15614,-2659,-203,1933,-450,1824},
+	{-355,-82,16162,1672,1076,1231,-1471,1148},
+	{288,143,15857,529,-1215,-492,627,555},
+	{-111,-926,15762,-697,-827,428,-166,1836},
+	{139,189,16466,68,-1148,426,-1522,1201},
+	{-2599,942,14357,1977,1504,-1595,710,1948},
+	{-1607,985,15312,2482,2428,-2750,151,1168},
+	{-2014,628,14838,1037,-69,-1198,1207,330},
+	{-2029,-590,16106,1115,1021,-2561,-1285,1882},
+	{-3551,-161,14995,-1794,1042,-1295,586,-1365},
+	{-2223,-547,15458,-1067,-241,105,-1719,-1000},
+	{-2613,-726,14817,-1515,118,-1844,3,711},
+	{-2097,518,15938,-1247,2957,-2000,-984,921},
+	{-1130,392,15769,-1213,1055,2116,-107,1824},
+	{-1264,442,15711,-1183,-1231,688,1883,1534},
+	{-885,1016,16087,2497,1672,323,1719,1055},
+	{-1875,2144,15399,1989,2442,1971,-236,922},
+	{-1410,1040,17021,1657,32,-225,-1817,806},
+	{-2573,199,16046,-684,2057,2936,1157,578},
+	{-2431,1114,15149,2809,-604,2755,1903,1546},
+	{-2906,970,16411,1921,1672,-2763,-1603,-1541},
+	{-1445,1363,16267,-1057,-2459,-775,1690,1074},
+	{-2667,1425,16500,1190,2675,-1934,750,433},
+	{-1530,-335,15783,-1346,-658,-2637,1707,1734},
+	{-1597,1487,17350,-2382,-1938,271,-49,1960},
+	{-2305,1868,16000,-413,-1583,1226,754,1854},
+	{-2438,2646,16538,-432,1174,-1325,1834,607},
+	{-2662,892,16090,1296,-1513,1221,-1631,1833},
+	{-541,1066,16001,-1320,-842,-994,1973,-489},
+	{1872,-490,14343,-2183,1236,-1636,1508,987},
+	{2591,-1034,14218,-1614,726,-1032,-300,209},
+	{2615,-1408,13174,307,-1546,424,1359,-1006},
+	{2303,-786,13438,119,-1538,-984,1426,-1006},
+	{1790,-1015,13795,45,-1099,1514,184,-194},
+	{1987,-1617,14426,-1736,-2148,1905,-663,-1773},
+	{2522,-500,15170,195,-537,639,752,-1447},
+	{720,-1447,14859,709,-733,807,-693,-1922},
+	{1969,-296,13798,350,-2808,2877,1801,1245},
+	{2040,-643,15621,-2377,346,757,-1883,1309},
+	{1215,-1762,15517,-2451,-435,-908,-949,818},
+	{1547,-447,14836,919,-1685,-904,57,-294},
+	{202,193,15411,385,937,1703,-441,-570},
+	{289,-1094,15976,-2605,1546,1139,-1499,1285},
+	{546,-1385,15443,-2224,1702,2662,411,-1846},
+	{1923,-850,16088,1084,-1693,2935,-1935,1567},
+	{84,1505,15430,1367,2231,808,1659,967},
+	{936,309,16182,-1195,365,-745,18,690},
+	{1923,-1542,14859,-2865,-1576,1867,855,1997},
+	{-605,673,15777,-617,2628,1806,-777,985},
+	{-375,1103,16095,953,1194,933,-1276,-1866},
+	{748,641,16195,884,-2537,2851,-1930,-1681},
+	{740,-412,16112,-1264,-888,960,179,-1931},
+	{893,-786,15892,-1756,-1816,1057,-995,450},
+	{943,961,15661,-2068,-1508,2002,545,1769},
+	{-756,-1059,15720,-2157,2321,-1351,1862,963},
+	{197,-1168,15530,-2255,-281,-1019,1797,526},
+	{-467,-819,16240,-1058,2099,-708,1055,396},
+	{-394,198,16994,-389,2055,2831,-1816,1458},
+	{46,-712,16333,-2899,-1910,2935,-1296,787},
+	{-875,990,16992,2550,1635,1638,-1367,-657},
+	{1184,2097,15583,2949,-361,889,979,1349},
+	{1400,550,16717,-1736,2113,2634,298,-1207},
+	{636,2216,16997,262,127,-2657,-462,-968},
+	{1540,1616,16218,2496,-2055,-1974,-910,-376},
+	{842,702,16859,4,473,831,298,-1621},
+	{-117,2757,17079,2917,2654,-320,-355,-1842},
+	{318,1374,17471,199,-1125,-861,147,-750},
+	{-300,871,16988,1082,588,-408,289,-1987},
+	{128,566,17517,-847,360,-1506,-1987,866},
+	{-789,1301,17173,-77,1104,106,-524,1206},
+	{-844,1233,17527,-307,1972,-488,-703,290},
+	{214,2159,16803,2349,-1300,-885,1231,1676},
+	{-1489,345,17436,-2006,2924,-1887,-473,222},
+	{-1504,1005,17419,-2059,1590,-1098,-1034,-1730},
+	{-2120,909,17689,-1208,2814,-1294,-552,-770},
+	{-931,126,17921,-2341,774,1172,-1072,1854},
+	{-1063,924,18209,-727,11,1165,-1928,600},
+	{434,1179,16725,-2201,-1284,2809,-1088,-19},
+	{378,3166,16339,2038,1312,745,652,-1591},
+	{-129,2892,16974,2843,1305,-1849,-1181,107},
+	{410,849,16628,-760,-2166,2890,530,1196},
+	{-298,3551,17528,2036,445,1577,-1510,-65},
+	{760,1116,17368,-1052,-2037,2585,350,193},
+	{-999,2579,17031,2477,1633,1560,787,-1969},
+	{-264,2454,17191,724,-364,-1537,924,-28},
+	{128,1638,17850,-2430,-1157,1241,-1780,531},
+	{-824,1096,18064,-2566,645,1934,524,1678},
+	{-1257,347,17601,-2108,877,-1592,838,807},
+	{-324,1420,18328,-1582,-201,1413,197,919},
+	{479,2705,17629,-81,-2816,70,188,-961},
+	{-723,1757,17178,-76,-827,2541,1340,538},
+	{-1268,1540,17478,-394,924,-1056,402,-1480},
+	{2937,-928,14153,-396,-1127,-1682,-551,941},
+	{3565,643,15253,345,2758,-1108,-1585,434},
+	{3618,-892,13984,-1400,-60,2136,1109,-1077},
+	{3158,-1554,13788,1092,-354,-1729,-1649,21},
+	{3476,-1844,15028,-70,2182,420,-1526,-561},
+	{2485,389,15355,-808,2834,656,28,-1073},
+	{3549,181,15498,1170,2543,-499,-1308,-460},
+	{2754,-1602,15220,-163,437,485,-470,951},
+	{1683,-989,14596,-21,2208,-1893,-1386,1683},
+	{1998,-1051,15530,-1606,507,-1534,-1390,929},
+	{3047,-869,14863,2562,-2169,-7,-1165,1472},
+	{2926,-1669,15093,-2137,461,-372,494,985},
+	{2234,357,16319,881,2861,-407,-1336,277},
+	{1347,231,15748,2659,1609,-2267,-1847,60},
+	{1346,-99,16264,352,1801,-655,865,189},
+	{1609,-405,16630,385,1618,-1957,-1307,211},
+	{1710,1547,15313,1697,2057,-573,-600,458},
+	{1836,2040,15439,2707,2279,813,-1593,927},
+	{3916,667,14604,-45,-2757,2774,851,525},
+	{3921,-546,15360,-2362,-2430,22,1122,-563},
+	{2350,1524,15313,1758,-320,-1033,1141,707},
+	{3017,1754,16107,2657,-1753,-22,-1994,969},
+	{2819,806,15858,1008,161,2088,-999,-975},
+	{2809,1264,16924,1100,-488,275,-1794,170},
+	{2948,96,16095,-2301,-1556,-2538,574,-1634},
+	{1169,-317,16674,-1430,2622,-747,394,541},
+	{864,548,16311,2158,399,-58,432,1691},
+	{2314,-1006,16583,-2415,1848,-676,989,1737},
+	{950,607,16567,-570,1721,-1878,770,-911},
+	{1825,1293,17091,932,886,883,-399,-57},
+	{1134,309,17527,258,1991,1560,-1366,-393},
+	{1407,127,17486,-726,430,1662,-277,-642},
+	{2885,1706,16325,2764,2581,-1982,-231,-74},
+	{3157,2315,16294,1459,-2234,-790,-296,960},
+	{3193,2136,16003,220,-1685,-135,1799,-135},
+	{3305,2147,16656,-1018,-1474,-362,1975,886},
+	{1727,1649,18038,1679,2818,-1635,-1973,767},
+	{2446,1998,16785,-799,-635,-1367,399,-1727},
+	{1648,2312,17269,2986,1691,1410,-427,859},
+	{1885,2131,17980,2227,1506,-2063,-730,85},
+	{2050,1546,16816,111,-696,540,1105,1332},
+	{1247,3348,16563,1440,1067,-2610,113,1709},
+	{2537,1585,17372,-930,-2976,226,-1635,1041},
+	{1651,2823,17485,2133,-106,-2873,248,768},
+	{980,1233,17679,-2941,1224,-956,818,-60},
+	{226,1959,17640,440,2230,1823,831,1262},
+	{-80,1729,17604,-1824,2660,-936,1771,-800},
+	{-380,290,16771,-1152,1875,-2423,1633,1521},
+	{-531,3258,18001,2856,1849,-889,638,-1445},
+	{1267,3481,16504,64,2245,2699,836,323},
+	{1310,3807,17688,-941,2175,-1554,994,1747},
+	{2604,3845,16842,1154,-918,-2734,1290,1421},
+	{2174,3319,17029,2957,-404,2438,-548,260},
+	{711,3176,17504,-913,1831,1618,1035,707},
+	{412,3467,17933,315,2635,1798,1257,378},
+	{1049,1903,17855,-2174,172,295,1269,-1567},
+	{899,2089,18538,-356,1976,2958,-44,1173},
+	{774,3407,18240,1412,-451,1373,413,714},
+	{177,1225,18038,-2518,253,2405,1407,734},
+	{848,2339,18779,-168,-658,2953,410,1309},
+	{-1098,1580,18161,-1341,1804,1854,1787,1963},
+	{-602,3569,19314,-2566,559,-2942,233,-430},
+	{574,3988,18952,406,-2682,-2155,-399,1306},
+	{734,3548,19136,-881,-2148,-2334,-143,-858},
+	{1106,2580,19007,-2783,-1891,-2698,-136,-1271},
+	{2768,-115,16449,-2433,2708,1809,1066,-130},
+	{3430,-476,16104,1527,2289,2679,-528,897},
+	{3463,-758,16563,-1830,561,2437,-953,-1105},
+	{3988,1141,16937,1850,752,1272,-1111,-124},
+	{2455,1695,16579,-669,2699,369,1149,-1818},
+	{2984,1315,16950,672,581,874,154,-1407},
+	{3976,1988,16266,2892,-2730,-1418,-1062,-1186},
+	{3522,-655,16343,-1867,-1490,2988,-1476,993},
+	{1993,298,16941,-1678,1739,949,591,-1520},
+	{3422,2532,16904,2262,-93,29,1919,863},
+	{3451,2005,16536,-52,-1459,-1820,1921,-1186},
+	{2606,1572,17571,-1075,106,-1798,1416,-744},
+	{2500,2182,17866,2436,2199,2386,-1851,1014},
+	{1418,520,17607,-2352,2081,-1413,1356,-672},
+	{2582,1911,17593,297,642,-2811,794,-1601},
+	{3768,806,18196,-2731,2359,2240,-1373,1860},
+	{2876,2784,17644,-1277,1993,903,-1400,1137},
+	{3542,1916,17758,-1615,1693,1804,127,-758},
+	{3925,1876,18291,-304,1374,2969,-655,1231},
+	{3326,1691,16619,-2018,-1282,2328,1304,-1819},
+	{2911,2314,17856,-344,-1052,1215,-631,-1799},
+	{2609,3559,17468,2820,-203,-1191,547,-1958},
+	{3298,2382,18409,1591,-1346,397,-1438,-1834},
+	{3583,2013,18601,-258,180,2586,-670,-801},
+	{2434,1949,18555,-1360,2136,983,430,825},
+	{3216,1182,18241,-1237,-714,1162,-994,1995},
+	{2834,3504,17674,2052,-588,-773,1674,344},
+	{1270,2094,17849,-2056,2298,754,71,-1169},
+	{2641,2088,17387,-1047,-2430,2989,-1045,-1367},
+	{2165,2746,18767,2639,456,81,-956,181},
+	{2273,1171,18947,-378,1157,2524,-868,391},
+	{2300,3264,17543,-1312,1859,68,-524,646},
+	{3913,3145,17933,-2133,652,201,-1799,14},
+	{3684,3974,17018,-725,-300,-899,1805,1831},
+	{2664,2638,17248,-1858,2533,-1987,1724,1186},
+	{3462,3852,18687,1252,2442,-2315,-2000,-1380},
+	{3628,3633,17342,-870,680,1858,928,-1601},
+	{3311,3485,17436,-531,-391,-2797,1914,-792},
+	{3098,3104,18201,-144,-2129,1477,1545,-1195},
+	{1668,3805,18653,959,1663,-1075,-1491,-866},
+	{1967,3363,19363,-1258,2086,1359,-1997,853},
+	{2909,2555,17804,-1534,252,-2138,1464,1775},
+	{2341,2894,19357,-343,413,277,129,1974},
+	{2040,3623,18609,-1219,-1283,-1472,-1246,-712},
+	{450,3100,18532,-2648,2443,-1192,-297,-1356},
+	{1164,3352,18555,310,1573,1144,-1245,-968},
+	{2353,2971,18670,-2246,-244,-195,1100,-1991},
+	{3004,2785,18666,-2940,-815,1850,-1593,700},
+	{2637,3330,18960,-2734,2517,1196,-1238,1292},
+	{3193,3053,19009,-2203,31,1854,-1357,252},
+	{3955,3264,19376,522,2818,749,1308,-337},
+	{2395,3965,18954,1626,1691,1270,-63,82},
+	{1462,3147,18904,-2165,2961,845,1603,-1986},
+	{3726,3690,18987,24,-2035,2519,585,-96},
+	{3659,2358,19073,-1954,-2444,1960,-425,-1711},
+	{2981,2643,19735,-1751,243,705,928,417},
+	{1344,3226,19673,-2910,2686,-229,1481,388},
+	{2772,3926,19466,-1372,1318,-1647,1799,1775},
+	{2337,1971,19301,-2844,-2221,2658,236,-315},
+	{1933,3619,20750,-2340,2043,1806,1732,1654},
+	{1026,3492,18930,-2753,37,2873,-107,-1049},
+	{834,2887,20450,-2413,2159,1833,-1476,121},
+	{878,3631,19425,-1843,764,-2505,995,-1780},
+	{488,-3180,13719,-2282,1357,1480,-117,-1154},
+	{761,-2907,13534,-1660,-262,-2399,-1738,1046},
+	{-826,-3654,12981,-1789,1877,2043,1515,977},
+	{1575,-2880,13786,2638,-934,-1719,1185,574},
+	{-168,-3034,13742,-1524,-1289,495,-1917,-666},
+	{-1396,-1660,14232,2437,564,-1208,-1463,-1073},
+	{-1293,-2629,13812,1219,2629,-875,1267,-873},
+	{1323,-2234,14010,1034,-2343,-2992,-305,-1998},
+	{-1769,-3022,14477,-456,732,1746,-1368,-1925},
+	{-1727,-2074,13670,1006,-355,-2937,-331,-708},
+	{-2167,-3504,13924,-196,689,2353,-512,1390},
+	{-1416,-3117,14277,2236,-787,17,287,587},
+	{-2357,-3586,14387,-355,-187,-376,-243,-216},
+	{-2704,-1984,13666,1854,939,2272,561,-1131},
+	{-2128,-3604,14929,2093,941,-1828,-824,-1899},
+	{-2715,-3678,13581,1215,-824,-2439,1733,-1308},
+	{-2880,-2748,14546,1614,2111,-335,930,-1136},
+	{323,-2335,14838,995,-799,2618,-1319,1782},
+	{-1419,-1927,14457,832,1541,277,1062,-592},
+	{-503,-2983,14542,-311,-2122,2296,-435,1187},
+	{-826,-2129,14424,-168,-1645,-2845,-960,-1753},
+	{-688,-1518,13922,2078,-1967,2833,737,-393},
+	{-2014,-1338,14849,2423,-1255,1763,-1055,311},
+	{-1324,-1542,14782,1264,-2230,2275,1881,-35},
+	{-677,-3282,15424,-798,-651,-43,1001,786},
+	{-2478,-2271,14120,599,678,-605,928,48},
+	{-1479,-3666,14075,-2021,-1713,377,1168,758},
+	{-1421,-3823,14818,-872,516,-2935,-1484,1907},
+	{-1777,-3487,14716,-627,-1318,219,1571,1255},
+	{-2517,-2862,14795,-2074,-441,569,-152,1529},
+	{-2697,-3040,15083,-1310,-672,152,693,1764},
+	{-1739,-3163,15294,-337,-261,932,-430,866},
+	{-1574,-2962,16167,1064,-1765,-2633,-743,89},
+	{-1778,-1776,15141,377,2163,-1305,1586,-1016},
+	{-1963,-2473,14862,182,1542,-726,288,-479},
+	{-1538,-3747,15205,-2790,885,-127,853,349},
+	{-1569,-838,15234,1269,33,-836,1247,-730},
+	{-2500,-413,15213,2957,-7,-183,554,-1333},
+	{-1820,-3645,15065,-2663,557,731,59,-1494},
+	{-1818,-1721,15148,2750,-801,-1716,652,-1830},
+	{-503,-1529,16029,-282,-753,-2936,-599,1021},
+	{-2389,-1149,14944,2271,197,-1337,-523,1340},
+	{-2304,-2761,15838,-1371,932,289,293,1161},
+	{-527,-2413,16186,1537,-908,-2171,-702,1702},
+	{-2161,-1282,16421,354,1274,-2211,-1883,-1508},
+	{-3467,-1684,14919,-272,1889,2498,-418,1484},
+	{-2191,-2041,15344,-791,-2626,677,-301,-27},
+	{-2528,-1967,16137,-595,700,-1593,49,-644},
+	{-1768,-216,14729,2935,929,2732,1757,-480},
+	{-550,-478,15243,2774,-1699,1370,409,1362},
+	{-2361,-2390,15616,-1700,545,2139,237,1916},
+	{-964,-1462,16358,-509,-962,-2370,-779,-800},
+	{-1674,-1641,15560,-1794,-2428,1914,178,-488},
+	{-940,675,15999,1076,-2618,-868,1241,-1747},
+	{-2758,-341,16411,1413,1710,-484,-1070,-297},
+	{-1996,-593,16012,1914,292,1972,1632,-258},
+	{-2273,45,16454,1049,214,-1299,184,-545},
+	{-1863,-522,15769,439,-2518,-191,653,1459},
+	{-2679,-608,16749,880,2731,-2706,880,1344},
+	{-866,-576,17064,767,-2461,-1092,-810,636},
+	{-2312,529,15528,2192,-2328,-2694,380,791},
+	{-3782,-1063,14050,-122,-507,-2314,1850,445},
+	{-2728,-325,15951,2008,-134,-2904,655,581},
+	{-1469,44,16571,1361,-2328,-2587,1460,964},
+	{516,-3297,13604,-1474,-867,2041,-1304,-847},
+	{3069,-2989,13004,-1780,-2672,-2242,-915,-877},
+	{2155,-3867,13068,-2214,422,991,1673,984},
+	{2544,-2603,14138,1352,1305,1918,1600,-1185},
+	{2184,-2183,14280,2599,1374,-828,898,-997},
+	{2865,-1609,13717,1896,-1184,1369,1239,-1847},
+	{518,-2442,13588,125,4,1027,1753,-982},
+	{2674,-2082,14648,882,-2519,-2404,-434,-1723},
+	{888,-2895,14057,1974,-1127,653,1439,-964},
+	{321,-1646,14297,1717,1822,-1716,626,-348},
+	{1532,-3162,13733,-2011,-2166,-2419,-325,-1210},
+	{1281,-3617,15164,-1233,1476,-99,-188,-497},
+	{1861,-3445,14912,-808,-1103,-13,-634,-1493},
+	{-96,-3376,15506,-48,694,-699,-991,-838},
+	{993,-3200,15866,391,189,-1811,-1890,915},
+	{260,-3299,15126,2264,1117,-2438,-1555,-554},
+	{2127,-1603,14240,2560,-1683,1997,-389,-1276},
+	{2715,-2406,14226,-1318,-533,-1360,1142,700},
+	{2576,-2151,13801,-2405,-2747,-2893,1976,-1018},
+	{2002,-2568,15200,-1540,1724,-2189,-1748,-377},
+	{1777,-2458,14832,-900,-1133,1224,1802,-479},
+	{1180,-1310,15425,1665,-1324,2067,-1205,-1410},
+	{149,-1572,15158,1544,758,610,1095,-1306},
+	{1950,-2601,15070,1662,-2677,-17,502,-519},
+	{1564,-3285,14647,-2147,-1747,1591,-1458,1591},
+	{1827,-2387,14532,-1355,-2868,-2061,-1708,1684},
+	{1228,-1380,15804,2837,-2090,738,-713,286},
+	{613,-2949,15050,-1519,-1773,-402,-1131,-1675},
+	{212,-3018,14931,-298,237,-496,1341,-1980},
+	{164,-2394,15590,589,-78,2474,-1065,-214},
+	{-1618,-3271,15983,-2174,-651,1847,-1007,-197},
+	{486,-2843,16006,-1217,-2367,-2187,-178,741},
+	{638,-1851,16318,2309,-1234,-1191,1493,-812},
+	{2437,-465,14160,1345,-1978,-2622,1865,-1368},
+	{1326,-32,16448,2553,-1307,-2429,-1304,-599},
+	{493,-2382,16298,-2413,2636,-493,-1453,236},
+	{1068,-1749,16331,1439,228,-1504,587,-1175},
+	{-512,-324,16134,2091,-28,-2595,-1911,-1858},
+	{586,-1439,16716,941,-893,2397,-1115,-714},
+	{-201,-967,16077,1507,88,-2766,-719,-1848},
+	{193,-1518,17496,5,1455,744,-1719,493},
+	{-1091,-1694,15977,-2453,-436,2607,334,-938},
+	{841,-1371,16424,-1430,-1757,-2946,-84,-1052},
+	{-1583,-3187,16241,-1220,2598,-2149,-610,82},
+	{-806,-2307,17432,-2039,-1151,-397,-1978,599},
+	{-2032,-1714,16635,-2803,2660,-531,-1353,-1376},
+	{-2109,-358,16404,2396,2074,1493,-217,-1884},
+	{-2081,-2696,16961,-2001,1468,-1497,-913,-1309},
+	{-2298,-1325,17180,45,2694,-585,-436,1467},
+	{1884,-1487,15956,-2131,-173,2055,1767,-1024},
+	{1253,-1248,16229,-1381,-2692,905,1796,-517},
+	{875,-1242,17225,-2154,258,-223,1479,-1088},
+	{231,819,17111,1424,-91,-11,1171,877},
+	{-402,1689,17725,2991,238,-690,-264,1158},
+	{146,283,16193,1596,-1567,-350,897,-725},
+	{161,-538,17926,231,2208,2642,-1024,-1182},
+	{597,500,18346,-900,-1136,704,1958,-833},
+	{-625,951,17604,-1791,-1169,-2845,1766,1953},
+	{-1323,1086,17465,2200,-281,-2506,1890,1911},
+	{-77,525,17023,1461,-2165,-2008,1441,128},
+	{355,1285,18093,764,-1690,1006,1725,596},
+	{-1934,939,17340,1049,1718,-1734,1226,-850},
+	{-581,1145,18240,1440,1178,2252,1963,51},
+	{-1065,-1238,18290,-2923,-362,-2113,-1778,-1315},
+	{710,-1576,17558,-333,2625,355,-1422,-1984},
+	{3548,-3479,13614,-1554,-101,1748,1518,945},
+	{3705,-1884,15190,1355,544,-1119,190,1787},
+	{1974,-1782,14080,2626,1565,-2420,1924,1381},
+	{2227,-2581,14709,2806,926,-2203,-1849,1392},
+	{3584,-1758,15119,2060,-1016,-137,-1114,-1573},
+	{2420,-1647,14766,2416,324,-1153,1430,1260},
+	{3248,-3120,15422,-1498,-521,476,-995,-1758},
+	{3574,-2714,14919,1969,-2357,667,210,1112},
+	{3192,-1306,15425,1263,-1028,-2233,-1777,1413},
+	{2646,-1419,14722,2806,-1680,-2257,882,754},
+	{3853,-3083,14331,-2657,-2540,-2700,388,476},
+	{1953,-2154,16346,2336,2862,-1509,-1638,-1188},
+	{2306,-2587,15902,-996,827,-1908,-1026,-1902},
+	{1835,-2198,15170,802,229,-2900,1726,-610},
+	{2704,-2695,16194,1471,-2558,-1246,-572,-1552},
+	{1464,-2217,16392,1703,-993,-2658,-846,151},
+	{3139,-1400,15789,2028,-242,-516,-1641,1003},
+	{3157,-2930,15070,-2448,1859,42,818,303},
+	{2933,-1637,16112,1910,1572,-2637,100,593},
+	{3653,-633,14944,2773,-1965,-278,-652,-769},
+	{3620,118,15391,2389,-2147,2115,1711,-195},
+	{2473,-1952,16450,1328,1264,-616,-1576,-689},
+	{2051,-2903,15517,-1463,2110,-1554,1619,-1646},
+	{3686,-249,16237,2484,-2710,-241,-1043,1293},
+	{2692,-955,15455,-1906,-2674,-1953,1832,1501},
+	{2871,-2933,15518,-1893,-2983,2405,-845,1234},
+	{3128,-1942,16280,-2551,-2788,-1427,265,1527},
+	{2184,-1182,16418,2165,167,-1165,-1640,985},
+	{2394,-2223,15959,-2605,-1512,1372,943,108},
+	{2501,-1605,17099,33,-1680,1248,-1587,-1752},
+	{2107,-1673,17010,30,-1837,-1307,668,-1690},
+	{1803,-1053,16813,1657,-632,-1246,1892,-1830},
+	{3031,618,17242,-1139,-2959,-2458,417,56},
+	{1924,-425,16500,349,2045,-2595,814,-1117},
+	{2108,-562,17304,1135,490,-1572,-1281,-405},
+	{423,247,16197,2516,1469,-2923,1847,-101},
+	{1864,-39,17471,-692,-1655,-2245,-357,-477},
+	{2353,-526,17505,-889,-1646,-504,488,-1188},
+	{2369,-1257,17339,-664,-885,-2982,1128,-569},
+	{957,868,17259,2161,1113,-2510,1806,819},
+	{543,393,18110,-1641,515,-2476,-840,-218},
+	{643,-63,17999,568,882,-573,959,1325},
+	{1392,-433,18060,231,1091,-2431,1692,-598},
+	{-131,-232,18153,-1247,2965,-2144,480,56},
+	{-566,-785,17596,400,2907,-1093,223,443},
+	{1426,-909,18125,-1257,-2890,-2388,19,328},
+	{1013,-245,17887,1453,-1851,-1186,872,-1388},
+	{2246,1466,17527,2798,-1575,-316,757,-353},
+	{949,-159,17906,-1037,-1027,1969,-66,1013},
+	{2144,274,17764,477,-2160,2869,-618,-807},
+	{1720,2168,17708,2183,-960,-2523,813,-1289},
+	{856,1228,17583,1697,-792,49,1609,292},
+	{-519,1154,18184,920,2642,1945,594,-658},
+	{1328,258,18588,-1818,-2086,-554,-1793,-1548},
+	{299,960,18339,-361,1029,-1364,1009,-1756},
+	{956,1550,18241,2372,-1552,1052,896,-142},
+	{223,599,18879,-720,2574,-737,-921,770},
+	{1961,244,18285,-1518,-1652,250,1588,1376},
+	{2089,34,17396,-913,-2610,-2772,1943,1123},
+	{-284,642,19277,-1244,2348,2878,-1274,1731},
+	{-34,2066,19527,-1245,-230,-1170,-1448,-859},
+	{425,2482,19311,784,-1697,-906,-879,615},
+	{804,113,19014,163,-891,2773,247,646},
+	{1454,1823,19213,873,-614,-881,-1241,239},
+	{3341,-528,15935,2131,2959,-166,1437,-202},
+	{3621,-499,16564,592,1034,-2462,-798,-1097},
+	{2816,-2173,16641,-2266,438,535,1153,-1779},
+	{2850,1121,17866,2139,2682,-721,504,-918},
+	{2159,-379,17393,176,2964,1120,795,-1467},
+	{2968,-157,17505,-989,1245,-1648,1310,-1830},
+	{3800,-805,17150,224,-2586,-344,523,-1608},
+	{2411,-817,17259,-2291,2558,-2476,407,-1468},
+	{2921,-9,18170,-265,605,-900,-1446,-1122},
+	{2785,598,18319,2941,-436,-274,-234,1068},
+	{3945,-209,18324,9,-2345,-2256,-1815,-864},
+	{1870,1379,18725,2466,2796,-1790,133,528},
+	{1404,-136,17783,-1170,1273,-1905,487,-1837},
+	{2989,1242,18163,2850,-1562,-655,335,498},
+	{1803,721,17905,2515,2233,-2046,1987,-877},
+	{1929,43,18000,-196,-1488,2824,716,-1140},
+	{3612,238,18568,-1945,934,2748,226,-671},
+	{3382,142,18774,-2787,-75,430,-749,-833},
+	{3836,15,18058,-2291,-1487,-2423,1514,750},
+	{2561,59,17610,-2530,-1854,-98,1694,-1826},
+	{1652,1655,18815,823,-571,1713,1093,-1181},
+	{1844,411,18476,-345,-919,-1242,878,-651},
+	{3407,1188,19795,2461,-1884,-1285,-1795,-1306},
+	{1805,2171,18860,1892,297,392,169,458},
+	{3875,1141,19146,-675,-582,-1564,-94,1992},
+	{915,1654,19257,1196,534,1284,1236,345},
+	{2399,1200,18531,987,-2223,-740,858,591},
+	{1300,1194,19639,-63,1345,2510,-109,-845},
+	{466,1328,18942,318,1408,2080,-848,-1211},
+	{1332,1439,19220,1814,-1273,-2370,397,-1560},
+	{1226,1616,20039,2994,-829,-2163,-1120,595},
+	{258,730,20149,-1796,323,565,-729,521},
+	{3225,963,18622,-1889,209,-2732,63,-1001},
+	{1991,613,19141,-2014,1146,346,1103,-363},
+	{3798,640,19369,-1037,-460,-2728,-146,-333},
+	{2822,438,20124,-2628,-159,1734,-1409,-169},
+	{3202,3599,17909,2758,-2327,821,1290,-1591},
+	{1107,1603,18473,-560,1935,466,1686,-1113},
+	{1585,551,19631,-639,2908,1312,203,-1289},
+	{2134,2427,20385,1092,2425,-1122,1010,-808},
+	{2095,1167,20136,-2710,2090,-1027,-698,-852},
+	{2641,1046,18559,-2046,-247,-2820,1649,1485},
+	{332,574,19834,-2208,2506,-401,-76,754},
+	{614,746,19999,-1267,1655,-1270,-681,-1241},
+	{589,1658,20725,-1869,597,-2405,-1856,1301},
+	{1346,1402,19244,-2426,-2222,-2730,1450,-552},
+	{1681,1131,20328,-772,-2890,-389,-214,822},
+	{3881,3189,19278,803,2133,-1342,794,401},
+	{3693,2553,19670,-1944,-708,-414,1462,-704},
+	{2704,3027,20260,-1684,1603,-2335,1237,-997},
+	{2438,2654,19903,-81,2560,490,1348,-1579},
+	{3818,3183,19811,1812,-1159,1251,794,-438},
+	{2371,3088,20184,1755,1087,1687,-1965,-772},
+	{3649,3469,21550,-211,1922,2779,-649,-1635},
+	{3517,2306,20658,1361,-1164,874,-1383,-1639},
+	{1274,2817,20071,71,1684,2262,-83,-1457},
+	{2794,2652,20573,811,97,748,10,315},
+	{2723,2421,21372,-2156,2432,-2580,-36,-274},
+	{3463,2805,20671,241,-676,801,1462,-438},
+	{1324,3383,20296,2463,494,633,-1416,1906},
+	{209,2563,19738,-2656,533,-2310,1369,79},
+	{3013,3183,21376,-2464,-2095,794,-1594,376},
+	{2538,2862,20809,-809,-2372,-1961,-278,-244},
+	{2406,-708,19191,-310,2343,-1125,-1858,-1370},
+	{2245,-3806,14465,-541,-1072,940,-723,1729},
+	{740,-3534,13931,739,2454,-1199,1746,1457},
+	{1535,-2783,16017,2226,2854,-1558,-1838,-877},
+	{684,-3074,15060,2837,1495,-2278,-547,-290},
+	{153,-2811,15129,2891,-74,2525,-1045,792},
+	{739,-3296,15821,199,2832,173,-1769,-1162},
+	{359,-3291,15475,1324,2969,1867,765,202},
+	{578,-3764,15337,-509,-396,768,-1882,1013},
+	{-1318,-3278,14978,852,1792,2680,-1870,1846},
+	{-614,-3597,15286,1894,474,615,-1123,1839},
+	{-311,-3611,15494,2240,1196,430,673,1737},
+	{-1431,-2817,14108,2176,-1146,1978,1420,1979},
+	{-1818,-3716,14940,1819,2452,428,374,1813},
+	{-1665,-3959,14664,964,48,1763,-771,-1700},
+	{-218,-3872,16310,1954,533,-1718,-27,-1619},
+	{2191,-3306,14790,-1315,1817,2568,-1168,1047},
+	{3009,-2845,14978,2108,205,2957,-468,1668},
+	{1436,-2844,15423,1843,77,1267,188,569},
+	{2625,-3499,14658,-436,114,-1092,1769,746},
+	{1214,-2717,16515,1940,1181,2421,-731,-978},
+	{1610,-2632,16244,1081,-1815,1999,388,-83},
+	{748,-3083,16117,1882,-1468,690,-422,-1394},
+	{1274,-2740,16232,2609,-1216,2275,1669,-1314},
+	{927,-2886,15806,1553,873,-1961,82,910},
+	{-832,-3086,15846,-10,2104,2369,-1653,1885},
+	{-1309,-3837,15247,-797,192,1905,508,-1577},
+	{1487,-3438,17128,171,-2747,-160,-428,1888},
+	{343,-2975,16846,2945,-2076,-1759,-666,-745},
+	{-1908,-3806,16385,-1371,486,-80,-1886,-1864},
+	{-1355,-3192,16731,2363,962,2313,-1624,-299},
+	{528,-2642,17111,2826,-1514,259,-1470,-1924},
+	{1643,-3565,16006,-1559,-2138,518,1319,1672},
+	{735,-1844,15822,2814,1054,-2890,747,1316},
+	{1503,-2672,17281,2280,1975,-1018,-1084,1573},
+	{2396,-2477,16428,2496,-1145,10,1821,1783},
+	{1652,-2620,17435,2631,1540,367,-1640,803},
+	{424,-2523,15939,1675,2687,2101,933,-510},
+	{1216,-3665,16286,-2796,-163,-1664,-568,-1857},
+	{735,-2627,17586,2835,-713,-962,-1572,532},
+	{-1843,-2093,16407,1312,2802,2593,981,604},
+	{-305,-2250,17092,1535,1596,-1493,78,1908},
+	{-857,-2156,16332,2609,-755,-1639,1515,257},
+	{-1406,-3542,16638,866,2736,-1165,156,-330},
+	{-833,-2231,17601,1620,-312,-928,-663,690},
+	{-1552,-2750,17394,2395,-407,-2063,-900,1068},
+	{-1451,-3346,16734,-255,844,-2712,1153,-868},
+	{-221,-2701,18146,2784,1103,-2866,-1891,-1185},
+	{51,-3649,17639,-835,-167,2821,-593,86},
+	{1209,-403,17018,2879,465,-157,1332,1135},
+	{1621,-2867,16505,-2099,-2142,37,1424,1047},
+	{1323,-2672,16801,-370,-2137,128,1383,667},
+	{727,-1831,17874,-1343,1036,-1147,1453,888},
+	{50,-1969,18750,1881,2764,704,-215,1719},
+	{463,-1625,18103,2831,-173,-1485,-1014,-290},
+	{321,-2619,18257,631,-1736,43,-457,-239},
+	{655,-1424,18516,456,-212,-2023,-1640,1696},
+	{-1733,-3273,16870,-2392,1400,-1362,-207,1913},
+	{263,-2762,18665,-2913,-719,-707,-778,950},
+	{1124,-684,18645,1944,-2008,-2185,510,706},
+	{-413,-2497,18895,-854,1122,270,-1417,1053},
+	{-466,-2237,18001,-516,-2330,2511,-1822,1752},
+	{-625,-1920,18927,860,981,-563,-1858,357},
+	{-187,-2641,19317,154,714,577,-1065,1319},
+	{286,-3861,18096,-2879,134,-73,944,768},
+	{3633,-3631,14733,-246,-2884,2792,-1431,39},
+	{3853,-3532,14756,-1342,1974,645,1869,856},
+	{3889,-2808,14882,1241,-987,1261,1892,95},
+	{2324,-2366,15632,1453,2568,2357,719,1202},
+	{3255,-3658,15927,-159,199,2611,-415,-906},
+	{2863,-3889,16162,-392,708,-1867,-923,-1260},
+	{2877,-2633,15927,2997,-500,-1986,1064,-1473},
+	{2300,-3626,16532,-582,2401,2515,1223,-221},
+	{1888,-3231,16873,-937,-438,1396,-126,-564},
+	{2467,-3082,16866,832,-1513,449,12,649},
+	{3113,-2908,16037,2495,-2277,785,1876,-1064},
+	{2837,-3992,16995,513,-826,1940,1953,-1897},
+	{2217,-3206,18493,1634,2012,-372,-1204,-1953},
+	{2071,-3271,18411,2727,-1881,-1617,-1591,681},
+	{1167,-3952,18396,2063,711,856,74,-397},
+	{1838,-3038,17057,-1192,2383,2113,564,-1167},
+	{3607,-3310,14866,-2514,-2549,2953,1296,1152},
+	{3071,-2601,16029,-1587,-2178,2385,1588,1011},
+	{2973,-2704,16679,-1202,-90,1999,1639,-644},
+	{2539,-1434,16591,1926,-367,601,1574,638},
+	{3536,-2947,17287,-260,-1976,1565,-21,687},
+	{2261,-3528,17448,-1550,-62,2375,515,-1428},
+	{3011,-3474,18366,59,-582,1563,576,-1644},
+	{1721,-1342,18102,2439,807,-1641,-1762,1551},
+	{1921,-1214,18396,1578,-1751,715,-1837,1615},
+	{2140,-2552,17536,-1190,-1957,2066,-1126,1357},
+	{2902,-3380,17357,-1093,-2066,-1142,1140,239},
+	{1181,-2716,17883,502,-145,759,754,822},
+	{1499,-3203,18370,1544,-1174,2953,308,1510},
+	{2276,-3990,19021,-1586,-2378,2376,-788,-1973},
+	{1453,-3834,18325,-1150,-555,-2857,-493,632},
+	{2458,-3676,19259,-2297,-1604,12,-1767,176},
+	{2960,-2304,17245,-2687,1897,2171,136,-1547},
+	{1820,-1530,18422,-941,1982,-375,-1720,1592},
+	{3925,-2111,17179,-1154,-892,38,942,-708},
+	{2918,-2128,17449,-1747,-387,-2681,1498,-657},
+	{774,-1068,17708,412,2372,201,1113,135},
+	{1097,-1705,17999,1468,2656,-79,944,1094},
+	{1772,-2228,18994,-1206,1172,-505,-1669,-1371},
+	{1191,-1974,18198,-1723,1659,-1107,245,-796},
+	{487,-2791,17936,-2846,2873,75,588,1113},
+	{288,-2727,18291,-2068,2268,112,-667,755},
+	{1739,-2931,18310,-1385,1112,-591,1277,349},
+	{912,-3242,18702,-484,687,-1311,1063,496},
+	{696,-2649,19015,-142,1893,2556,106,329},
+	{470,-3266,18649,-2390,328,-457,-681,-1433},
+	{2272,-2799,19214,196,-1263,-281,44,-1718},
+	{2442,-1597,17888,707,-347,-32,1612,401},
+	{824,-1502,18414,-2660,2822,427,1248,-1740},
+	{3041,-1895,18767,-772,425,1442,-963,-1362},
+	{2458,-1236,19021,1376,86,96,103,-1025},
+	{1392,-671,18795,2771,-704,1852,1420,1747},
+	{2411,97,20210,-631,-490,2675,474,-1878},
+	{546,-173,19130,2511,1076,2320,1068,-378},
+	{2475,-2487,19093,-2679,-2391,-2056,-1023,-1455},
+	{1725,-2467,19836,-270,-744,1268,-908,-230},
+	{554,-831,19748,-736,1488,-1170,65,-1197},
+	{901,-1632,19651,146,-39,2837,-830,1085},
+	{168,-3452,19144,-2952,2885,1974,-182,689},
+	{2170,149,20157,-2068,-2348,-263,1953,58},
+	{957,-724,19578,-2513,-227,2064,461,-1505},
+	{752,-1930,19356,696,-509,1116,149,-187},
+	{710,-3475,19514,-2580,1221,-2603,-24,-1677},
+	{3392,-2784,18024,1337,132,2099,13,-1974},
+	{3951,-3707,15543,1465,2140,-2405,-1662,1983},
+	{3991,-2604,16982,2261,1647,-1981,-1121,1680},
+	{3650,-3379,16644,1039,2294,-2374,-577,593},
+	{2819,-3761,16160,444,2480,-2730,-23,1306},
+	{3752,-3665,16872,1457,2116,2571,-1182,1869},
+	{3635,-2997,17416,2485,2196,588,-291,-1478},
+	{3942,-3634,17823,2013,2393,170,-207,892},
+	{3074,-2700,16439,1307,776,-1808,1373,1378},
+	{2493,-1908,17942,1912,2178,-1079,1152,437},
+	{3909,-2607,17999,1639,117,-440,736,377},
+	{3098,-3860,18444,1396,1025,2231,-1515,1956},
+	{2543,-2721,18355,2443,2113,-876,1215,1560},
+	{2749,-3962,18143,1220,1861,858,-1065,-1308},
+	{2875,-3439,18804,2152,-35,1412,547,-1811},
+	{2693,-3422,18684,1448,-2317,-2432,133,-1308},
+	{3685,-3881,18877,560,-2135,-996,-179,1758},
+	{3694,-2076,17688,994,998,2786,747,1940},
+	{3550,-2418,17728,-1682,-415,-1309,1189,924},
+	{3589,-3236,17917,-655,540,-623,1964,-208},
+	{2704,-2782,19145,-2437,2829,1717,-1471,853},
+	{3334,-1494,19261,248,97,651,-1984,390},
+	{3200,-1742,18279,2653,1533,2498,1657,-1014},
+	{3942,-1556,18265,2880,-1736,-19,1093,-1995},
+	{3810,-2754,19378,668,1492,-2164,1408,1914},
+	{3999,-801,18602,96,-2809,-2324,-761,1767},
+	{2399,-1564,18739,658,-32,-2705,769,881},
+	{3227,-2719,19890,885,-434,2905,-1280,1452},
+	{2654,-1926,19089,2234,-1671,-1179,14,-180},
+	{1868,-1382,20167,1517,-1245,1937,-950,1294},
+	{3096,-2298,19739,588,-986,-588,-369,-1045},
+	{3514,-1953,20066,2850,-2532,2687,-1425,-866},
+	{2309,-2659,19694,-2719,937,-517,-1605,1340},
+	{3487,-364,19543,-19,1982,-2201,-1323,1458},
+	{3881,-1823,18685,-2039,813,-2197,-495,286},
+	{3168,-733,19137,386,987,-2492,937,-841},
+	{1365,458,18797,2899,2483,-2381,-818,681},
+	{2207,-434,19947,2189,1318,-715,-1261,-508},
+	{3451,-1293,19073,-1717,-1899,-2408,34,-1841},
+	{2532,-506,19619,2632,2069,-2164,1462,-1661},
+	{2864,-3555,19450,-1644,383,139,1196,-606},
+	{2316,-1281,19262,-121,-369,-1750,355,909},
+	{1826,-2397,20024,2431,1473,-2062,1581,1732},
+	{3155,-2931,21059,766,-561,-1782,424,1890},
+	{1033,-836,20583,2192,1969,-1134,-507,1555},
+	{830,-3076,20450,-2815,2089,-1964,-440,515},
+	{1609,-3393,20920,775,2812,-461,-281,768},
+	{1433,-3581,19777,360,1690,-2393,1493,-1423},
+	{1002,-102,20316,2520,1663,-2852,-1251,949},
+	{1894,-194,19279,-1045,2703,2474,-440,1906},
+	{3326,624,18396,1942,-281,2824,1435,1714},
+	{2336,583,19613,2157,665,-2353,-1971,1901},
+	{2105,481,19913,914,1949,-547,-1770,1586},
+	{1847,1221,19366,2941,1781,1220,711,1382},
+	{3865,-545,19514,-2433,-2743,-2398,1198,-1065},
+	{2948,-1362,20331,1992,1683,505,937,1521},
+	{1967,747,19963,1169,2976,-2673,246,1330},
+	{2292,553,20058,169,2874,-2841,-82,1667},
+	{2590,606,20170,-129,186,721,1435,1419},
+	{1308,-1254,20279,-905,190,-1394,1211,1956},
+	{1426,-1732,20741,-98,2763,119,1049,1625},
+	{2322,223,20874,-1620,-1943,-94,-1731,421},
+	{2358,-75,21137,-2358,-2403,726,-536,538},
+	{2273,-2889,20464,-1605,583,-2953,1276,-108},
+	{2770,-832,19963,-2125,-993,1317,562,-1585},
+	{3697,-2844,19655,-1917,1873,414,1318,-432},
+	{3727,-2786,20155,1301,1808,2157,191,1145},
+	{3445,-3770,19310,2553,2039,-1198,-96,-1558},
+	{2205,-2779,20218,-2505,2882,437,-1458,-1871},
+	{2914,-1604,20744,-944,1721,945,-1899,-1484},
+	{2187,-1732,19948,2788,2188,2650,1971,-1437},
+	{3354,-1119,21348,2679,2577,-2868,-395,-1613},
+	{3743,-3278,20289,365,1272,-1768,749,372},
+	{3278,-1780,20927,1720,1977,-73,-1860,1726},
+	{3112,-3384,19796,-1512,777,-1625,802,-733},
+	{3948,-3741,20028,-1302,-87,-1919,-587,1169},
+	{3457,-3617,22003,781,2584,2845,-1415,1952},
+	{1978,-1204,20768,1966,1906,-636,770,-1419},
+	{2674,-1806,21008,2173,1970,-2591,-207,-1807},
+	{3457,-3964,21452,-2158,742,1971,-1824,-671},
+	{3967,-1765,20714,1479,81,-578,934,-1188},
+	{3641,-744,19894,-2888,2995,-456,-1326,1113},
+	{3607,-1410,18918,-2740,1723,106,1696,-291},
+	{2493,-1217,20605,-1344,1933,-115,-228,-248},
+	{2587,-1774,20191,-1574,2191,-1427,1179,-1547},
+	{3424,-325,20301,1613,161,-628,1958,133},
+	{2985,-1961,20610,-600,901,1242,1733,-1642},
+	{3683,-2283,20785,-825,514,904,1794,-1156},
+	{3986,-1197,21265,2820,-649,1400,-1306,1831},
+	{3648,-2137,20019,-915,-2755,2498,1193,890},
+	{2722,-845,21397,1791,2470,-1815,-659,1073},
+	{3618,-2047,22159,-300,2680,-337,-1448,1461},
+	{2707,-2538,21331,-402,2491,1180,281,1088},
+	{3642,-690,21084,-529,-2586,-2104,-1486,268},
+	{2390,-3246,21893,-2109,821,-1619,-1080,1695},
+	{3090,-3843,21726,-336,875,2038,-915,1403},
+	{3896,-3201,21212,-1132,2927,-216,1593,-1694},
+	{3671,1898,19904,2434,1376,1622,-848,-1040},
+	{3510,1191,20718,2966,2608,812,-403,-1852},
+	{3997,-1258,20690,-189,1681,-2019,1658,-1538},
+	{2922,1905,20855,2053,2920,1971,-1819,-516},
+	{3392,-257,22024,-1358,2879,2627,-1687,-324},
+	{3129,539,20786,2783,2585,2911,808,-1131},
+	{3486,967,22055,2261,2327,-342,-1373,-1991},
+	{3424,-83,20882,-1256,498,1040,-145,224},
+	{3990,-517,21183,-756,-523,418,-394,-271},
+	{2754,-545,21616,121,1592,-2439,-1405,454},
+	{3214,-590,21118,-410,-857,-2446,926,963},
+	{1846,-1373,20885,-1787,2525,1109,613,-971},
+	{3276,-1457,22708,1373,2740,-1473,-1563,791},
+	{2485,-3221,21542,-2994,769,-1081,1889,1369},
+	{3993,-2904,22348,-1120,2332,-545,1883,-1073},
+	{3901,624,20856,-1114,473,212,-1142,1599},
+	{3495,1331,20544,-2738,2517,1371,1532,-1031},
+	{3818,768,20716,-2921,97,-1551,686,-1639},
+	{3702,-697,20929,-2453,-1247,1286,330,1733},
+	{3039,960,21875,-2111,1696,47,-1202,709},
+	{2483,3035,21853,918,2723,1657,-1805,1354},
+	{3360,3720,21916,2207,1890,358,-1038,445},
+	{3260,1113,20963,-2885,346,1749,1829,-919},
+	{3095,-631,20711,-2435,-938,2052,957,1554},
+	{3471,792,22047,-2563,1174,-1464,-919,1801},
+	{3912,1939,22291,422,638,-646,1554,1784},
+	{3977,1280,23127,-249,617,-2053,-831,1109},
+	{3835,1950,22840,2902,1001,-16,-1344,1320},
+	{2538,2507,22106,2575,2187,-377,507,1108},
+	{3783,2034,21913,2560,183,2248,1061,1484},
+	{3046,70,22304,-1604,-1987,-579,-1000,1980},
+	{-2354,181,16812,-1157,1079,871,-227,-924},
+	{-3993,-2712,13560,-400,1526,1575,895,-387},
+	{-3958,-2899,13963,1722,2096,886,-770,-311},
+	{-2954,-3765,15020,-1402,-126,-1149,-335,-582},
+	{-3987,-3437,13337,-1857,12,2744,129,485},
+	{-3696,-1014,15149,-2148,-298,2987,-432,-1085},
+	{-3364,-46,15612,1677,2509,2563,-1052,-1711},
+	{-3904,-1214,14594,169,538,2326,474,1279},
+	{-3610,-3038,14608,-1371,-195,1068,915,846},
+	{-3320,-2726,15016,-2145,-2391,507,1509,434},
+	{-2605,-2051,16446,923,-2486,-2872,-1653,1528},
+	{-3282,-3281,14999,-2303,-1372,-2609,-138,253},
+	{-3354,-3882,14552,-2776,-1385,-1068,941,-1884},
+	{-3420,-1160,16447,638,693,2121,166,-389},
+	{-2808,-1972,16408,493,-2816,2104,-1443,-747},
+	{-3541,-1451,14897,1649,-2170,-2152,1915,-591},
+	{-3744,-1827,16570,-408,-650,567,1040,-1994},
+	{-3438,1501,14686,469,-111,187,613,-1706},
+	{-3165,701,15262,-1127,-2496,-1360,-1783,-1121},
+	{-2108,968,15678,146,-2158,2021,95,-49},
+	{-3924,846,15022,2478,2073,920,-660,-446},
+	{-3745,1082,14931,650,-1381,2256,90,-716},
+	{-3416,1542,15440,2410,-2331,666,-104,820},
+	{-3138,-220,15314,2849,-1201,2711,1978,-1114},
+	{-3106,-1273,16416,-2825,-247,2967,-117,1548},
+	{-3708,317,15952,-422,-2876,-518,253,1795},
+	{-3083,-587,16836,-500,1308,-614,-532,1763},
+	{-3490,-1455,16854,-1244,110,-837,-303,-385},
+	{-3472,897,16464,1059,-2973,-482,-1939,394},
+	{-3976,-1065,15547,-2309,-2978,-2291,-1130,-1710},
+	{-3330,-364,17057,2198,-2288,-1392,-926,-434},
+	{-3009,-265,17209,2289,-2060,357,811,-1342},
+	{-3981,1453,15174,-1287,-2169,1502,365,1041},
+	{-3475,2953,15253,2072,1130,-2004,691,-1170},
+	{-3550,2050,15062,842,2023,628,1793,-835},
+	{-2982,803,16062,-2986,-973,819,-746,140},
+	{-3620,1599,15044,-400,-224,-966,640,-973},
+	{-3720,3118,15034,1529,-1376,-375,-1489,-586},
+	{-3914,2742,14072,2796,2350,2356,1208,65},
+	{-3692,1800,15092,-456,1010,2776,1660,-1532},
+	{-3057,730,16711,-1217,227,2698,-637,1135},
+	{-3952,1658,15978,-1224,-1847,-2419,-1354,-274},
+	{-3117,1457,16219,-324,-2495,1556,739,1153},
+	{-3155,42,16908,-24,-15,-2931,-708,-413},
+	{-3349,682,16521,-1888,-1489,2610,-116,420},
+	{-3713,762,15516,-485,-1530,957,1657,-1058},
+	{-3537,1469,16556,-1298,-2402,-2990,-54,-1553},
+	{-3899,-115,17089,-1985,-2729,-2239,-665,-1463},
+	{-3291,1760,16271,-1390,-1699,-825,1559,-1555},
+	{-3060,2995,15498,-2861,-635,1805,-1088,-295},
+	{-3668,2855,14390,-869,-925,1043,1547,1103},
+	{-2454,3267,15428,-1118,-2440,-2437,-365,-1475},
+	{-3771,3932,15044,-767,800,-977,-1080,-1464},
+	{-2181,3895,16544,2638,-2290,-552,-1749,327},
+	{-3154,3530,15710,2903,-240,854,690,109},
+	{-2581,3640,16171,2491,-2947,189,1528,70},
+	{-3459,3812,14881,-1427,-406,2172,1248,1351},
+	{-3612,2404,15338,-2129,-2107,414,415,1358},
+	{-2642,3595,16695,119,-2934,-2885,683,1772},
+	{-3910,2818,16730,835,878,1350,-126,1187},
+	{-3757,2449,16650,410,-2668,-2794,1099,1169},
+	{-3850,3710,16595,-33,-1603,2189,1604,122},
+	{-3944,3407,16255,1779,-2017,46,1233,-48},
+	{-3406,3099,16788,2697,-2356,686,233,618},
+	{-2827,2864,15684,1508,-132,-2869,1319,-1952},
+	{-1867,318,16502,1561,75,1006,126,-1843},
+	{-1657,400,17452,2442,267,2563,-1548,842},
+	{-2258,-594,16762,-655,-327,-358,-916,-1392},
+	{-2517,431,16842,-2322,-597,1414,-1698,-860},
+	{-711,152,18028,-35,-1608,1237,-497,-1600},
+	{-3449,-1345,16507,-28,2560,2025,-490,-1862},
+	{-2089,-1331,16894,2253,-1735,-1098,1095,-1551},
+	{-2681,419,16927,-215,41,1665,526,261},
+	{-3515,-840,16750,-1967,2710,-200,871,827},
+	{-1421,479,18181,1739,-2331,340,-1717,183},
+	{-2574,-769,17874,383,-586,-1396,-1872,963},
+	{-2734,301,17538,763,-144,878,-1272,-899},
+	{-2492,-1144,17610,-1617,-751,-231,-96,-1566},
+	{-3601,-613,18262,329,2934,-950,-809,-1523},
+	{-3516,-1140,17778,1928,-554,-2339,-1635,-1599},
+	{-1602,1546,17150,1141,-2445,-1741,-1634,-662},
+	{-3337,2836,16464,-332,2964,552,-1626,772},
+	{-850,-29,17239,-1241,-1536,2474,265,-1237},
+	{-602,104,17974,-366,-1429,2658,-1654,-831},
+	{-1835,2070,16775,972,-2896,1517,457,-318},
+	{-3427,1399,16764,149,1695,985,1387,-391},
+	{-1853,2236,17508,2249,-2069,-592,1200,-532},
+	{-2660,365,18462,1278,218,1422,-1761,-1844},
+	{-2831,1611,17304,2854,-1864,-138,1629,-1720},
+	{-2161,1322,17518,-2738,-2220,1739,521,1789},
+	{-2434,832,17865,-199,-625,-830,-1885,-70},
+	{-2695,-331,17620,-2946,767,-2289,-128,402},
+	{-3833,-524,17185,-2308,2647,-411,1504,-151},
+	{-3786,2513,17276,2313,806,1189,-1120,-1366},
+	{-2808,917,17877,649,-760,1872,-1560,1050},
+	{-3244,-1229,17794,-2991,-1950,2544,928,-873},
+	{-3951,852,18518,-830,-320,1303,599,-186},
+	{-961,3512,16084,46,-2759,2552,272,-1509},
+	{-3693,2236,15691,-1452,2935,-2464,1663,-1781},
+	{-2547,1493,17670,-1773,745,46,838,-559},
+	{-2935,2911,16789,202,597,-152,1275,-1482},
+	{-3938,3072,16388,926,1746,1847,1014,-1063},
+	{-3613,2425,17151,2036,666,-1904,-1705,-966},
+	{-1824,2288,18454,895,-1150,-35,-456,-571},
+	{-3563,1481,17994,-1556,2826,304,-343,1340},
+	{-3210,2242,18540,-1364,748,1581,-1553,759},
+	{-3490,1252,18210,-2945,437,-2130,-529,1344},
+	{-3480,-52,17659,-2954,2882,-1754,1125,1160},
+	{-3515,1844,17804,-1137,-1118,-66,-101,126},
+	{-3846,754,18770,1514,1219,-2665,-721,-1793},
+	{-3769,1120,18984,-68,-2055,913,955,-1189},
+	{-3919,872,19099,-1238,-2341,-171,1598,-1318},
+	{-3935,1843,18804,-2977,-289,-689,-1018,-684},
+	{-2116,3859,17936,-2971,-1670,-2251,-604,-1397},
+	{-3560,3885,17966,-196,2187,-1584,360,-461},
+	{-2615,2299,18752,-2970,284,1327,-373,423},
+	{-3389,3896,17206,-2952,2159,2487,-1529,-1626},
+	{-3243,3719,18615,-1401,178,-634,-566,-1762},
+	{-3169,3520,18656,-1037,644,220,1644,-699},
+	{-3596,3407,18530,2328,-526,2273,955,-1510},
+	{-3092,2245,17936,-2988,-1312,1945,-866,1350},
+	{-3548,2975,17876,-2828,-902,72,-1590,1218},
+	{-3637,2477,17761,-1671,-1236,283,1307,1054},
+	{-3865,2422,18599,-2027,1404,739,1731,440},
+	{-3447,1853,18814,-1823,-192,1194,429,-219},
+	{-3459,3745,18895,-1936,-362,-155,-609,-775},
+	{-3442,3595,18312,-2484,-1847,979,1561,-604},
+	{-3585,3017,18980,1703,-2605,1726,999,-784},
+	{-1883,2709,17757,-792,1692,41,789,-1011},
+	{-911,1436,18883,2120,484,-1191,-1549,-1087},
+	{-1123,-1150,18090,-2561,-1897,1669,1622,-35},
+	{-534,-143,18637,-1024,-1642,-1130,1437,-834},
+	{-1842,1040,18628,2447,1703,291,-535,-166},
+	{-2644,131,18022,1230,2759,1444,-1413,53},
+	{-581,782,19368,1329,-1961,446,-986,-747},
+	{-516,147,18917,2422,-1696,-1897,-605,-1253},
+	{-2160,630,17926,-966,1216,241,492,1012},
+	{-2002,1070,18357,560,-145,-1386,-72,-374},
+	{-1778,432,17729,773,-811,80,1809,1665},
+	{-1777,-739,18799,-2907,107,-1315,1261,626},
+	{-2436,-131,18183,487,1293,-2048,1866,-840},
+	{-3047,717,18944,179,570,-828,-783,1555},
+	{-2772,506,18824,2201,-334,1111,-1631,1809},
+	{-1912,-52,18484,740,-1099,171,596,-66},
+	{-2897,468,18313,-1394,1426,-2339,857,1199},
+	{-1939,3705,17472,1378,2599,1847,-995,1085},
+	{-1465,3063,17333,935,-1049,1458,1082,1680},
+	{-1258,1437,18722,-837,187,1659,-168,560},
+	{-723,1497,19158,1999,278,1425,-847,86},
+	{-408,2527,18606,2464,-2275,1131,-1216,-717},
+	{-486,1742,18957,-549,-2915,1494,-219,591},
+	{-1445,2152,19289,1512,1052,2823,-732,235},
+	{-1100,2292,19118,1334,-2276,519,-1600,855},
+	{-1959,1812,18803,-137,-1275,2030,153,1166},
+	{-3246,1300,18220,-53,638,-746,1769,1701},
+	{-845,1271,19307,-1447,-2093,-2565,-1569,589},
+	{-2079,349,19686,-295,-2695,-2842,1565,-1212},
+	{-2320,2441,20243,2930,-2863,2160,-1655,-889},
+	{-2456,1229,19737,736,-2340,1311,1142,-1754},
+	{-2499,952,20404,407,-2993,-2966,-779,-954},
+	{-2923,2729,18825,2350,-1679,-2156,-912,323},
+	{-1560,3747,18651,1606,1285,-1718,-101,828},
+	{-704,3629,18366,1602,-2377,-559,-1721,-1977},
+	{-761,2584,19115,-1417,-2161,-1526,1367,1066},
+	{-767,2523,18842,1191,-2299,-340,1982,-84},
+	{-1464,3141,19098,-759,-2167,354,614,-677},
+	{-2367,2838,19516,760,2764,1437,-778,672},
+	{-1608,3263,19086,1065,-1900,706,1302,-1404},
+	{-2454,2870,18956,-386,-424,-483,736,426},
+	{-3929,2830,18279,1931,2764,-2281,-1336,1437},
+	{-2320,3110,18838,326,-2387,-804,-1209,1756},
+	{-1748,2689,19432,681,-2831,-2647,-415,835},
+	{-2373,1727,20140,-1111,-1937,-1238,565,490},
+	{-3286,2535,20290,2878,-869,726,-1251,817},
+	{-3126,1953,20593,966,-966,-346,-805,-1542},
+	{-2129,1867,20405,1161,-2116,1740,-223,-1564},
+	{-2814,3403,20108,2220,-1345,286,-1379,1314},
+	{-2105,3752,19411,-2876,-1704,-1766,-1358,52},
+	{-1102,3956,19522,-39,-1760,319,1734,1508},
+	{-1011,3466,19887,1628,-1282,2082,-676,1566},
+	{-2342,3954,18433,1007,-205,1971,1569,848},
+	{-3067,3400,20005,-2141,-557,-1498,-1427,-1224},
+	{-3205,3483,19079,1700,-282,2754,339,1381},
+	{-2819,3048,19693,-408,718,-1314,1144,-770},
+	{-2480,3981,20114,-758,-1961,156,257,-902},
+	{-2257,3528,20070,-2093,-2934,-525,1126,-1116},
+	{-2936,3340,19447,1249,-1681,-555,858,1464},
+	{-3651,1474,20796,-2562,-514,521,319,228},
+	{-3275,2372,21066,-1191,-2318,176,-345,821},
+	{-3706,3799,20925,-1435,-1646,-793,-224,-1354},
+	{-3234,3311,21168,-1797,-2478,-1833,558,-7},
+	{-3813,3913,20589,1127,-2557,-300,1910,583},
+	{155,2272,18521,-1781,-2967,1509,-1167,-501},
+	{-304,2217,18851,-75,-422,-261,-1705,-1349},
+	{-1074,1780,18743,-2395,18,-257,981,-1119},
+	{-151,1323,19105,-434,-2345,1380,-828,-692},
+	{-494,2037,20163,313,2096,-1718,900,-1925},
+	{169,2125,19329,806,-2759,2,-55,-751},
+	{-1294,1279,19961,845,2426,-1537,-867,-1796},
+	{345,1852,19753,1205,-2594,-2772,-106,-1409},
+	{-486,1546,19321,10,-2995,1437,-344,-1331},
+	{-196,1629,20076,14,-2046,-1473,-588,1940},
+	{-688,1568,20087,826,-917,-1892,436,509},
+	{-342,1123,20605,-240,247,-2965,-925,-1233},
+	{-1822,415,20110,-2830,1566,-2700,515,-921},
+	{-2392,1294,20397,-1034,2336,880,-634,-1799},
+	{-1663,1560,20783,377,-359,2260,-1764,-1198},
+	{-898,927,20573,-642,-2038,11,-1312,1165},
+	{-1167,2923,19733,2797,2386,2868,-969,-1702},
+	{192,3867,18176,401,-2498,-1115,1202,-1970},
+	{250,2334,19973,119,-2404,-1654,-389,497},
+	{1894,3556,20231,2121,-1868,-410,1384,-633},
+	{1654,1875,21259,-2667,-1189,-361,-1936,-1968},
+	{-105,2667,20225,557,892,2741,679,-1741},
+	{1187,3452,20615,1666,-1151,-406,-298,-149},
+	{1183,3497,20317,1669,-2813,-2209,21,-33},
+	{8,2173,19685,-1461,-1733,568,1294,1649},
+	{-2736,3147,20162,1493,2766,-2244,-395,1364},
+	{-838,2799,21211,-1616,-1273,2799,-1030,1572},
+	{-1709,3555,19783,2213,299,1768,1381,375},
+	{-1759,1502,20818,-1316,-2247,-2048,799,18},
+	{-2126,2930,20618,-313,-1834,-34,-490,-1085},
+	{-1986,2895,21326,1219,1923,909,-1571,-1133},
+	{-1596,2427,20629,1865,-1723,-1483,1404,-1951},
+	{1322,2933,20007,-632,822,2731,538,-1618},
+	{-982,3359,19859,-2043,1324,-1880,-120,-935},
+	{594,3907,20018,-1331,-1025,-765,1052,-119},
+	{2261,3379,21139,1145,-789,2328,-1713,1292},
+	{-1478,2872,18781,-1973,137,-1964,1510,-1832},
+	{-1185,2910,20115,-455,1450,2418,1458,-1352},
+	{154,3974,20243,1380,-39,-239,925,-1221},
+	{2162,2975,21486,-2374,-2733,-826,-1407,-1675},
+	{265,2934,21411,-1608,133,2792,-938,-60},
+	{-2684,2677,20837,-1386,-186,-2326,-1530,-663},
+	{-2296,2701,21540,3,1056,-1000,-831,514},
+	{88,3980,20944,2313,-2951,-2427,563,1157},
+	{-1806,3286,21507,-905,1610,2337,-1437,-559},
+	{-2159,3923,21037,196,1312,377,284,-1147},
+	{-1449,2690,21496,-551,-1685,16,-516,-971},
+	{-1861,3547,21034,1671,-1564,923,1146,-373},
+	{1976,3168,20903,-2042,-1520,-2459,1405,-1718},
+	{-518,3743,18954,-2452,-709,1070,1705,1378},
+	{751,3597,20646,-2439,-778,1821,911,615},
+	{2476,3704,20895,-2823,-2479,-229,872,-485},
+	{115,3843,20981,-1418,-2396,-2330,764,19},
+	{-566,3883,19159,-2196,-2635,2943,1226,-1094},
+	{-140,3607,21486,-1019,-1706,2957,-1592,1793},
+	{-1201,3562,20803,-1181,1280,22,1690,-1946},
+	{-2029,3848,21062,1615,-2078,796,1245,-1559},
+	{-1559,3875,19949,-2333,-2910,-2257,1821,-325},
+	{-210,3312,22388,-2860,-124,-552,551,152},
+	{-954,2164,21919,-2065,-2367,476,-808,-50},
+	{-1544,2755,22905,-2511,-2915,-2229,-1994,326},
+	{-3527,2990,21271,-2541,760,-679,-13,-1726},
+	{-2280,3871,21087,-17,-2526,2587,1389,1748},
+	{-2937,3431,22270,-1190,-1006,-2365,-814,722},
+	{-2653,-311,19744,-2715,1536,532,-1983,-1267},
+	{-3451,-3180,14504,-2018,637,2934,92,-1250},
+	{-2347,-3807,14182,-2085,-1790,2216,1043,-1886},
+	{-2674,-3322,14801,2267,-1259,2524,-117,1548},
+	{-3248,-3861,13838,804,-379,-43,1238,-1806},
+	{-2589,-2663,16666,-641,2373,2947,-1066,-1705},
+	{-3747,-3074,15100,2844,374,1018,-1946,-1627},
+	{-2194,-3367,16415,986,-687,2990,1111,-127},
+	{-2619,-3204,17274,1865,2086,1817,-985,-1271},
+	{-2526,-2750,16936,980,-211,1966,-1929,486},
+	{-2451,-3172,17010,114,977,-657,-473,186},
+	{-2192,-2912,16826,2398,-479,-2707,-1766,1398},
+	{-3264,-3549,16282,412,-741,-2244,263,1590},
+	{-3896,-2211,15682,2060,967,-738,965,-1699},
+	{-2780,-3244,15793,51,-2112,1558,1493,-1778},
+	{-3947,-2901,16214,2777,1386,-832,-372,-390},
+	{-2410,-3341,17498,-409,2057,2119,-1828,451},
+	{-837,-2898,17739,-1944,-2912,2744,-752,-3},
+	{-2317,-2273,16590,1018,1101,-2055,687,-884},
+	{-335,-3294,17414,-1561,-1864,-1053,-464,-1692},
+	{-3762,-2920,14916,-2949,885,2341,1147,168},
+	{-3572,-2305,15046,-598,29,2839,950,733},
+	{-898,-1858,17939,2460,-1602,1562,-420,445},
+	{-1540,-3455,17887,-1966,-1203,2631,-1776,-21},
+	{-2851,-2000,16973,2141,1522,-978,1482,305},
+	{-3675,-2965,16519,-2902,-1654,-10,205,1137},
+	{-3312,-2505,16353,2200,1627,-2417,988,1887},
+	{-1588,-3463,16786,-1633,-2073,-2997,-556,-937},
+	{-3118,-3239,17662,-1468,-1508,-206,-277,687},
+	{-3961,-2864,17284,823,1237,1264,-1595,1446},
+	{-3361,-1532,17457,2687,-42,650,1474,1278},
+	{-3647,-2325,17717,1882,-701,898,-534,-20},
+	{-2559,-1126,17268,2123,1099,1717,-455,-1439},
+	{-1087,-924,18007,2449,251,1989,369,1423},
+	{-1617,-982,19210,1893,466,-272,-1482,656},
+	{-737,-848,19141,2000,-1528,-1658,-1199,986},
+	{-1589,-2589,17760,-2071,-1479,2990,-451,-1786},
+	{-2900,-1347,17713,1222,293,818,-550,-495},
+	{-2004,-391,18696,2603,-391,258,-257,1},
+	{-3312,-2553,17117,-2718,-1159,1966,1552,-1788},
+	{-2679,-749,18070,1725,821,-994,1366,442},
+	{-3102,-1092,18108,620,55,1670,-477,1502},
+	{-3270,-2883,17465,-1606,1836,-1967,-789,1292},
+	{-2649,-2162,18280,-559,369,2084,168,906},
+	{-3086,-1282,18616,1297,2566,2080,-671,1851},
+	{-3920,-1127,17990,280,96,792,250,1175},
+	{-3789,-2964,17835,-350,2330,4,-682,-874},
+	{-3148,-2265,17794,650,-1955,-2910,-1081,-690},
+	{-2049,-511,19333,2039,612,527,-819,464},
+	{-1574,-684,18614,1419,820,2263,1637,1593},
+	{-1319,-862,18780,1833,-2004,1314,453,1327},
+	{-1897,-2078,18714,-864,-640,-2383,1313,1751},
+	{-1299,-668,18524,1310,-1612,1730,1808,-805},
+	{-3479,-912,18138,-1952,-676,2612,-1299,1824},
+	{-2656,-249,19163,2718,2329,1977,-485,1856},
+	{-3460,-1672,18506,-2986,1201,-457,505,-170},
+	{-3792,414,19520,1630,-376,1123,-1077,-140},
+	{-3010,44,19455,1305,-2033,-888,-477,1794},
+	{-2583,-936,19321,743,-2399,-1440,-1691,1819},
+	{-3698,-724,19512,313,2553,-2089,1184,-37},
+	{-3903,-1392,18594,-1503,-2271,1124,-1,1788},
+	{-3184,-857,20181,-1411,-200,652,-548,502},
+	{-3085,995,20210,2106,-1069,768,202,-344},
+	{-3978,-1097,19624,769,-2551,2146,-1611,1166},
+	{-1916,1197,18628,2518,1116,1859,791,-752},
+	{-1307,-1055,18779,-1739,2843,1957,-1288,-1031},
+	{-1495,-835,17468,194,1470,2820,1835,-1646},
+	{-863,-1273,18814,2905,1652,1489,-1646,558},
+	{537,-1616,18770,2,-2365,1892,-914,-1692},
+	{-642,-374,19982,2175,2590,2237,-78,-1561},
+	{6,-1210,19254,2169,1033,2371,102,-1499},
+	{-552,-1419,19925,53,2564,2702,842,-1697},
+	{-1785,-2634,18123,-1631,2502,1613,-441,101},
+	{-1222,-589,19419,-142,1490,-612,-1528,-1712},
+	{196,-928,19008,769,-1319,2323,539,1186},
+	{-1085,-1488,19339,-49,1678,1118,235,961},
+	{-1152,-1103,18838,244,-525,-2785,892,-1306},
+	{-1455,113,18698,507,-196,2407,912,-962},
+	{239,-879,19879,-1027,-2301,-2287,-1469,-1843},
+	{-1431,-1564,20334,-533,1053,701,-1281,698},
+	{-3265,134,19730,1857,1251,2093,-656,-1375},
+	{-1201,1622,19678,2637,542,-1450,1037,1271},
+	{-604,-958,19835,-1294,-1232,1624,-488,763},
+	{978,-904,20206,-1821,-2101,1838,721,-1077},
+	{-456,-970,19770,-2396,-1046,2217,430,-1583},
+	{-768,339,18898,741,-748,2865,1218,-1891},
+	{427,192,20304,2800,-2380,2660,-1892,-683},
+	{-192,523,19903,1388,-1917,-2682,1531,-1185},
+	{-2534,-610,19845,-536,830,1489,-547,-229},
+	{-3350,1535,20183,2091,1816,-53,-1603,-461},
+	{-2336,888,20236,1302,397,-1697,-1359,636},
+	{-2160,-1235,20689,-697,1450,-541,-580,1805},
+	{-2192,176,21107,140,1450,1969,-1433,-936},
+	{-3868,493,20861,-1146,2022,840,-1668,1305},
+	{-2659,-148,20144,-276,-783,28,-3,-606},
+	{-3098,-1048,20516,-540,2286,1376,-188,-747},
+	{-2544,247,20042,-946,-1677,2845,1942,-1872},
+	{-1760,369,20631,-2320,-171,555,1777,-196},
+	{-1030,399,19787,-399,-2023,-2558,1707,-1607},
+	{-847,-493,20219,-2262,-400,-2873,1724,1365},
+	{-2319,2897,19935,2621,1704,2890,-975,1057},
+	{-2233,2983,21027,2851,812,-144,-486,604},
+	{-1883,2404,21019,1385,1244,2677,-543,-1098},
+	{-2797,610,20493,1100,2121,-2537,73,-1070},
+	{-2813,1818,20597,1966,-406,2092,459,-917},
+	{-1608,98,21147,-1944,-600,-2279,-1145,-688},
+	{-1951,810,20831,-1086,-2473,-2960,547,-797},
+	{-2635,180,21833,-1455,2906,225,545,-1436},
+	{-1745,36,21835,-2614,-716,1889,-1021,-1065},
+	{-3539,1045,21257,344,-203,2441,-1222,534},
+	{-3185,264,20942,-1505,-1062,-1863,-567,-586},
+	{-2217,1701,20737,186,-2130,-2079,1975,-1298},
+	{-2754,1518,20614,608,-2220,2934,1013,972},
+	{-3876,2010,20565,-80,562,934,923,653},
+	{-1705,845,21199,-1820,-940,1523,799,499},
+	{-2195,1860,22630,-2194,-1177,-123,-1649,-1010},
+	{-3468,3048,21779,2255,2645,2304,-1158,99},
+	{-3682,2891,21479,-1017,2385,2371,492,-1984},
+	{-3630,2409,22175,-35,2250,1425,-808,-756},
+	{-3477,1897,22537,-1880,2892,2425,-52,-1299},
+	{-3106,1267,21321,-948,1138,-1943,1987,1134},
+	{-3688,2682,21225,-172,1104,-699,968,862},
+	{-2116,1817,21799,-1927,-2169,2870,-660,1538},
+	{-3581,2055,21744,-2575,2153,-1099,611,312},
+	{-3202,932,22761,-2794,-1489,-1224,-1714,1082},
+	{-2571,2770,22645,-1783,-2919,769,141,1959},
+	{-3757,571,21646,-2095,-1787,1637,-460,455},
+	{-3462,2726,22238,-665,-187,-578,1212,-1387},
+	{-279,364,19716,1048,933,-2909,-79,-966},
+	{1280,2462,20488,1838,1142,-2409,412,-1565},
+	{475,-280,20597,2605,2559,-1845,-1830,-1758},
+	{124,-1420,19640,1441,2185,202,337,-1601},
+	{-240,-917,20346,-1023,1343,-726,1188,523},
+	{1399,2211,20515,2292,278,2744,-1172,-527},
+	{134,810,20655,1254,1189,2297,-1438,64},
+	{-679,208,20095,963,1498,2248,-372,980},
+	{-415,958,20855,-1551,2711,-1190,-1170,-467},
+	{-620,998,20474,400,2752,-2031,25,1498},
+	{528,259,20497,-857,-544,-2058,51,1188},
+	{1031,682,21655,199,1974,-2472,337,1723},
+	{287,-204,21886,28,2386,-1479,-1214,581},
+	{-243,1310,20872,183,926,275,1028,919},
+	{-1831,1343,21373,1877,-4,-760,674,1496},
+	{-863,1285,21896,1718,-231,-2684,-1150,136},
+	{-813,2518,20211,2466,-105,-1705,1801,1681},
+	{22,3061,20899,2526,1971,-839,1806,1308},
+	{1041,1648,21490,1803,1613,1543,1834,1678},
+	{-64,175,21066,-1828,-1554,-815,1306,1107},
+	{462,808,22251,-2826,-73,-1834,-1955,-511},
+	{-2615,2310,20589,1421,2784,1465,563,1363},
+	{-401,1738,21792,94,30,394,1279,971},
+	{141,1076,22829,619,37,848,-1816,404},
+	{747,351,22188,-2303,-1008,-1848,-242,1131},
+	{-844,1649,22427,284,1434,2595,-1068,1706},
+	{508,936,21660,-1592,-1838,1835,1622,1596},
+	{-1103,1751,21623,1067,-2083,-2803,-1746,743},
+	{-2749,-83,21674,-2098,1139,-1394,826,1679},
+	{-1231,2140,21493,2190,-2487,1400,207,1540},
+	{-938,1379,22053,-1496,-2958,2332,1335,1006},
+	{-1893,1882,22743,1367,-53,-1153,-1294,1551},
+	{162,2112,23122,822,-1756,2535,-1536,580},
+	{355,2246,20563,-1940,1601,2350,1749,1602},
+	{-1158,3597,20950,1561,1410,115,1859,1300},
+	{-547,1947,22144,2008,2897,-1069,1331,1447},
+	{121,2242,22087,-647,-830,323,305,1149},
+	{-932,2256,21949,-735,-188,168,43,-400},
+	{-356,1629,22530,-2679,-2186,-302,-1772,-1400},
+	{192,3452,22040,1098,-1884,-1863,672,-1172},
+	{-1097,2095,22920,1778,1882,-236,-1256,1197},
+	{-3756,3347,21298,1182,2296,-231,728,1714},
+	{-2165,1329,21850,-1436,1788,-1044,1010,1377},
+	{-1283,2223,23104,2745,1347,-946,-1555,1321},
+	{-3697,2346,21648,82,1266,-2263,1028,1239},
+	{-3370,3057,21873,2981,1856,-2642,-1723,-661},
+	{-1750,3234,23132,1326,-730,-1348,-1891,-1408},
+	{-3605,2943,21736,1968,2444,2463,1771,447},
+	{-192,2058,21330,-2958,472,1419,975,1690},
+	{1042,3388,20855,-223,-369,2104,1811,1796},
+	{146,2223,22604,-1820,-365,-183,-886,1514},
+	{318,3140,22422,-1172,-1743,-2339,-511,1222},
+	{-362,3418,22214,-1294,-1167,507,617,1568},
+	{-1115,3390,23072,-4,1045,436,-1333,1134},
+	{57,2403,22114,-876,-2611,1091,744,1728},
+	{-1066,3526,22577,-953,-1113,-2391,763,42},
+	{-2322,1898,22353,-775,-260,1466,679,938},
+	{-3176,2671,21976,159,2275,-1231,1773,1827},
+	{-2287,2824,23152,-1426,556,-2630,-1960,-1040},
+	{-2729,3432,23533,-1834,849,2397,458,1974},
+	{-3187,3815,22860,1664,1977,-730,933,-520},
+	{-2601,3410,23694,-1827,-960,226,-1423,-1148},
+	{-2288,3882,23251,-291,-404,761,1453,-420},
+	{-1772,3110,22697,212,-2487,2229,956,-228},
+	{-108,-85,21363,975,2262,2327,-569,-1849},
+	{1549,1304,20662,-1939,-274,609,1652,-880},
+	{3488,1153,22174,-809,-1375,-248,-494,-876},
+	{2695,1559,22762,422,2855,-2981,-608,-779},
+	{2693,1751,20663,1979,-1853,487,-883,-1887},
+	{1936,2614,22173,850,206,-2108,-572,-1067},
+	{2207,2624,22257,2489,1858,-76,855,396},
+	{2853,274,21709,-1731,-2285,2798,705,-1522},
+	{857,89,22420,-2247,2153,1922,-966,-663},
+	{1779,2678,22268,-215,261,-1806,-1500,-289},
+	{847,555,21408,-2471,543,-924,1121,-604},
+	{2195,2015,21962,1472,-1184,-1533,321,570},
+	{-70,-469,21568,-2936,2209,-112,420,-1966},
+	{-894,1806,21891,-2885,2987,2400,10,-801},
+	{435,1521,22144,-237,2376,1465,1034,120},
+	{422,1402,23493,744,827,-403,-1966,1984},
+	{469,2096,22185,-2132,1637,2867,-1515,-370},
+	{2688,3491,21433,2162,-2285,106,-987,1787},
+	{3432,1817,22553,-1584,-1378,-933,-1190,663},
+	{3158,1809,22198,400,690,645,1805,-220},
+	{3755,1490,22358,-1498,-1907,624,-301,-72},
+	{1909,2891,21879,475,974,1538,-30,123},
+	{2200,3257,21693,1134,-43,-890,1405,-355},
+	{1978,3249,22643,1506,533,-1457,-1082,-359},
+	{1824,2062,21829,-1072,-1739,-1611,1478,-1722},
+	{2254,625,22254,-2487,-2654,2653,-668,939},
+	{3543,3222,22520,1253,-2077,-624,743,1885},
+	{2736,518,23187,-1903,183,2239,-695,1161},
+	{1497,3211,23059,2156,2242,635,-955,1871},
+	{-277,2288,22232,-1758,685,2967,-108,-1176},
+	{1215,3708,22212,2874,-432,-1061,-227,440},
+	{2359,1195,23254,-2418,-1248,2592,-1236,30},
+	{958,2410,23520,-310,-2032,2469,-899,-1343},
+	{2297,2959,22585,-1578,1737,-1572,-1388,-1953},
+	{3922,3085,21573,-55,341,1416,982,-1954},
+	{2945,2156,22752,-534,1832,119,892,-615},
+	{2713,3543,22111,2491,2922,1989,604,-1684},
+	{2728,3965,22916,2316,-1445,-2135,-1642,750},
+	{3617,2077,23451,-997,-372,2284,-1287,-1759},
+	{2486,1081,22211,-2814,-179,-420,1530,-1828},
+	{1659,2793,23972,1771,2134,807,-1616,800},
+	{451,3945,23132,-1164,2207,-992,-1796,332},
+	{696,2686,22803,-1235,-892,2076,433,-488},
+	{-377,2905,23000,1198,2720,1608,1080,477},
+	{-466,2909,23148,-1404,411,-2263,-23,-1645},
+	{-1402,3455,22902,733,2021,1909,-16,-660},
+	{-1511,3288,23030,-293,2336,-1412,998,-380},
+	{-1412,3840,22806,2363,871,1912,560,-1391},
+	{1488,2676,23947,-850,1378,126,-66,-949},
+	{2806,3538,23410,-163,1399,-2347,-34,270},
+	{3575,3409,23239,1880,1943,2843,268,1737},
+	{3458,2014,23620,-2751,-110,-1433,-526,550},
+	{1258,3962,23230,-1053,2246,535,551,1037},
+	{1397,3880,22714,-490,472,1722,1482,-1408},
+	{1195,3711,22844,-981,-1866,120,568,-617},
+	{1911,3979,22755,1115,-737,134,1825,948},
+	{918,1952,23214,-2593,-698,1806,501,443},
+	{-1134,3447,23002,-2381,2405,2254,-1233,1686},
+	{2112,3490,23090,-1794,-2830,-1312,484,209},
+	{606,2036,23470,-2116,43,-1883,119,1580},
+	{-1462,2486,23734,-2661,1861,-715,95,269},
+	{-650,3530,23957,-981,-754,-136,-1900,603},
+	{-2941,3816,23741,34,1734,-2470,-927,-1926},
+	{1475,3258,23791,-2634,-2800,291,1834,-1089},
+	{-1924,-2161,17230,665,-2545,-2735,1956,944},
+	{-203,-2890,17144,1632,-2893,-925,1774,-1219},
+	{-898,-3350,16962,2148,67,-1224,1604,-1968},
+	{764,-3483,17865,2963,-2556,-2337,1832,-987},
+	{-1064,-3624,18147,2159,-608,-819,-915,127},
+	{-3803,-3080,15943,2721,-47,590,584,-804},
+	{-2326,-3727,17444,1616,-1301,-258,-57,-777},
+	{-1175,-3754,17883,2864,230,-1802,-650,-1431},
+	{-3593,-3881,17026,1529,2963,1710,-1205,433},
+	{-3527,-3759,17189,-1074,2839,114,453,890},
+	{-3416,-3460,16761,1684,2781,-295,1560,1609},
+	{-2723,-3529,17214,2817,395,-2165,181,438},
+	{-1970,-3617,18168,2343,-707,-867,4,-439},
+	{-3780,-3578,16854,2254,-476,-302,167,1794},
+	{-3768,-3677,17895,2675,544,-946,-278,760},
+	{-2890,-3745,17359,1437,-708,511,1836,-1152},
+	{-3313,-3457,16730,226,-282,837,1466,230},
+	{-579,-1682,17793,2749,-2013,-1512,1317,-1544},
+	{-2216,-3097,17432,2165,275,-233,1427,1638},
+	{-1115,-3595,17813,300,-750,2210,508,-1336},
+	{-588,-3173,19205,2806,-2345,2215,-1363,1210},
+	{-1970,-2311,18913,1136,-1414,-297,-1899,-931},
+	{-2480,-3008,17501,-663,-1427,-1870,104,-1733},
+	{-3175,-2991,17945,1563,2909,2610,738,-467},
+	{-2197,-3880,18621,1590,-406,-678,1079,-744},
+	{-3198,-3733,17564,-2641,-908,405,673,1842},
+	{-3975,-3642,17018,-972,1833,1062,1166,-886},
+	{-3487,-3840,17492,-2621,-1570,2824,1609,1404},
+	{-3527,-3403,18297,1380,2679,876,876,-669},
+	{-3598,-3833,17753,-658,351,742,414,-596},
+	{-3632,-3351,17309,1120,-2225,-1617,1878,-58},
+	{-2870,-3656,18154,1907,-1030,-2703,670,-396},
+	{-2713,-3040,17542,891,2491,-2395,457,-1718},
+	{-1433,-2478,18683,1032,-2462,1669,1974,908},
+	{-1390,-2131,19821,2085,-1256,-2783,-1579,-830},
+	{-684,-2528,19058,2232,-1827,-2428,785,-1409},
+	{-788,-3658,19138,703,-2666,-1286,1635,-380},
+	{-2400,-1959,18919,1638,-2396,475,-159,-856},
+	{-2871,-3694,18826,-926,-108,356,1485,-1015},
+	{-1321,-2714,19411,1947,-2661,-1523,1870,-880},
+	{-3499,-3623,18325,-1937,2567,-2343,-448,385},
+	{-3252,-2921,18243,-2531,-2581,-1772,-154,1279},
+	{-3720,-3697,17545,-2205,2584,-2445,560,1711},
+	{-1283,-2869,19727,-1260,-2678,-2796,-934,70},
+	{-2731,-2682,20040,1962,-2391,-1091,-733,1724},
+	{-3874,-2078,19392,1753,334,-1937,-1627,-979},
+	{-3337,-1419,19249,2712,-2667,-801,595,-1571},
+	{-3363,-1941,19568,2367,-1958,-2843,1063,-1548},
+	{-3590,-2761,19239,-2910,1436,-1894,-1767,1272},
+	{-3642,-1021,19250,144,-1344,-1602,1218,310},
+	{-1963,-3339,18926,-2586,-2606,2336,713,158},
+	{-3775,-3135,19506,-2564,-178,1643,-1384,1231},
+	{-3392,-1833,18995,-952,-1121,-976,1628,-1834},
+	{-3823,886,20746,1577,-1310,2077,462,-1767},
+	{-2663,-2376,19514,-1943,-2240,-1635,1788,-1945},
+	{-3104,-3154,19349,-1283,-2275,2053,455,-669},
+	{-3204,-1118,20535,1112,-315,-2992,-1477,823},
+	{-2936,-934,21313,-2819,-1588,-498,-1046,1994},
+	{-3726,-1765,20512,-2977,42,1296,782,1709},
+	{-3530,-3889,19467,-2765,-1671,-579,1316,-431},
+	{-3757,-2821,19926,-2965,-1373,1751,1492,248},
+	{-3889,-423,20911,2077,-2415,2356,522,30},
+	{-3748,-861,20444,2680,-2466,-1356,875,-721},
+	{-3379,-2940,20398,379,-1124,-2681,-579,-997},
+	{-3534,-3379,20249,-1687,-902,255,-377,-1674},
+	{341,-3006,19383,1031,-871,509,-1371,-141},
+	{-491,-3340,19016,1740,532,-1079,-1548,-1174},
+	{57,-3201,19343,976,-543,-618,-1110,-1472},
+	{-1012,-2408,19758,556,1059,578,-1765,243},
+	{-176,-1119,19847,2499,-1736,639,1462,-1561},
+	{56,-2838,20066,695,-638,1286,857,-1098},
+	{-975,-3924,18914,1022,1343,-2049,414,-727},
+	{-1807,-2004,19361,2081,-633,2887,732,-901},
+	{-653,-2478,19359,415,-2229,-80,367,252},
+	{-855,-3555,18697,-1423,14,-2882,1028,-531},
+	{-1690,-2269,20135,-496,1218,-1382,1921,-1219},
+	{-1518,-3779,20249,-1440,534,-152,-777,-1743},
+	{-1791,-2591,19182,-1489,-1924,2679,229,-1825},
+	{-3591,-2597,19589,-1306,2783,507,324,-1827},
+	{-1624,-2485,20047,-1786,-1444,-2031,535,-1440},
+	{-3045,-2433,19978,-2294,245,-2346,51,-1522},
+	{-767,-697,20601,153,-2399,-1701,-110,1072},
+	{-1151,-1999,20390,-1107,-1308,2581,292,765},
+	{-295,-2411,19842,-1533,-2535,-558,959,599},
+	{-774,-1976,20682,219,-2129,-1,338,936},
+	{-1760,-1489,20243,-1427,-1691,-1956,-251,-1877},
+	{-1707,-2235,20668,-1235,-1755,1607,-122,654},
+	{-2139,-1332,20485,123,-368,-1162,522,-1546},
+	{-1970,-2699,21090,-2685,-2344,1741,-1944,-1296},
+	{-3120,-676,21019,-83,2820,2453,-330,1449},
+	{-753,-1385,20925,161,-2907,2639,1390,1836},
+	{-2784,-2108,21000,1020,104,391,-694,459},
+	{-3447,-1057,21637,676,401,2569,-1839,1713},
+	{-3722,-545,21767,1520,-862,2988,-1857,94},
+	{-1732,-636,21769,1461,-2623,-81,-917,-728},
+	{-3325,-2041,20536,667,-2443,2769,1470,-1336},
+	{-550,-1250,20081,-702,693,-140,1944,-652},
+	{-1590,-1190,21304,-579,1304,2838,-631,-1378},
+	{-1054,339,21048,1928,8,-967,666,-1516},
+	{-1658,-898,21156,-414,175,1450,1134,94},
+	{-2666,-644,21780,-509,2833,-133,-1911,-1705},
+	{-3186,723,21627,478,673,792,367,-1143},
+	{-2207,-620,21747,-871,-939,1066,-602,1013},
+	{-2572,137,21937,1412,-1482,441,987,-1533},
+	{-3281,-1321,21773,507,-696,41,-781,-1337},
+	{-2921,194,21380,482,203,-1436,-68,1741},
+	{-2117,-663,20874,-139,-2445,-219,1765,1523},
+	{-2879,-1692,21889,-2201,-269,-2531,1453,-131},
+	{-3555,-1450,22291,-949,440,-2723,655,-1313},
+	{-3885,-593,21495,-567,-2193,96,-988,-1633},
+	{-3359,-1389,22085,-217,-2235,-206,-1701,-1732},
+	{-3606,-1285,22573,-418,-2802,-2205,-284,-1872},
+	{-2989,1836,21442,2834,158,-506,586,207},
+	{-1969,-38,21831,-2198,-2215,2526,1462,1979},
+	{-1664,-2,21578,-1284,-2449,2350,1916,1272},
+	{-3788,-324,22672,-2922,2721,-2008,151,-792},
+	{-2764,785,22132,562,-2594,-2264,-111,-1078},
+	{-2795,2777,22829,1708,-39,2993,-1595,-1867},
+	{-3401,1709,22598,607,-2224,177,-1388,-1916},
+	{-2749,407,23019,1202,-2408,-121,-1067,-444},
+	{-2313,-209,22382,-2436,-2403,-703,-793,628},
+	{-3420,870,22298,-214,-1780,710,-137,1007},
+	{-3663,789,22699,-2304,-2708,2214,1046,1704},
+	{-3493,543,23171,-1395,-569,-2532,-1531,-1355},
+	{-3229,2301,23357,-2391,-1351,-1564,1239,-1620},
+	{-3824,3664,23661,2944,-2889,2887,-1996,1063},
+	{-3258,883,22965,-871,-2924,1273,-89,-1487},
+	{-3665,1494,22760,2259,-2977,1096,-519,-86},
+	{-2314,27,22750,-2524,-1667,1518,-1551,1714},
+	{1700,-2514,19665,-263,-2784,2521,61,634},
+	{1363,-2067,20590,-2636,-1187,856,1977,-1624},
+	{1916,-3685,20378,-1844,-2940,341,-1515,1028},
+	{996,-656,21269,2759,-935,-1790,396,662},
+	{-968,-638,21068,1520,2385,1684,-383,-321},
+	{-58,-1827,20591,-291,-401,-1667,-696,-1309},
+	{-210,-3412,20594,439,1167,-2507,-1170,-1552},
+	{160,-3284,19572,438,-1618,-2812,-402,619},
+	{-349,-1083,22028,-317,1401,-1315,-1575,1111},
+	{-116,-2268,21527,-2675,1576,-1043,-1809,1287},
+	{-560,-2823,20192,-354,357,-216,648,1443},
+	{-1087,-3007,20951,-731,-898,-1794,-830,1394},
+	{-1146,-1971,21155,486,1511,-1115,-539,-1647},
+	{502,-1552,21368,1401,-2598,-1348,-379,-1407},
+	{774,-1148,21173,2560,-2986,-2421,1754,-496},
+	{-341,-841,22159,885,1962,-2550,-873,1933},
+	{1366,9,21730,1386,-54,-2126,-923,1110},
+	{-368,-7,21785,1625,-1491,-832,-1111,1380},
+	{460,-590,21959,-634,-1534,-1044,917,555},
+	{-182,-698,21692,-47,220,1578,1644,-463},
+	{-16,978,21438,2112,-1673,107,-51,-519},
+	{-439,-1020,21883,145,-1178,1025,-155,135},
+	{941,-860,22178,1701,-2331,-232,461,-694},
+	{268,-1927,22520,-2327,-2723,1483,-959,-873},
+	{-3051,-161,21569,950,2189,-1611,-208,1534},
+	{300,-1406,21839,-1925,-1658,-393,-1310,1948},
+	{-1052,-799,21247,-220,-610,-2943,487,1857},
+	{-1254,512,22107,1915,-1858,185,99,1885},
+	{-3775,291,22178,201,2993,2364,-1060,1552},
+	{-1751,401,22599,2127,-245,1553,-711,7},
+	{-177,-1625,22628,-1895,-2955,2922,-1818,-1298},
+	{-1528,-104,22201,-155,707,2680,-332,-1384},
+	{-123,338,22051,368,553,-393,-1279,-1583},
+	{-60,323,22160,553,251,-1001,815,1567},
+	{338,-303,21990,-399,-349,-2917,-535,-887},
+	{149,173,21366,-2046,-2804,-577,1560,-639},
+	{780,1645,22573,-904,-2881,-1523,-249,-582},
+	{-2395,1048,22976,-285,2563,2917,-1108,980},
+	{-758,660,22244,1728,-653,1252,899,1389},
+	{-886,-659,23410,-1663,-2285,-765,1167,-1462},
+	{-1542,1849,23198,836,-1182,-577,-1560,1626},
+	{-1704,476,22968,-1304,-108,952,-479,1751},
+	{-2803,987,22372,221,352,-2763,-29,600},
+	{-2374,817,22430,1889,-1346,-2161,106,1929},
+	{-3327,1453,23004,1922,-2010,-2215,-1614,1771},
+	{-1325,1350,22705,1695,-2915,-1643,-180,1657},
+	{-2669,-305,23310,-2531,1063,-1941,-1872,-36},
+	{-2151,1319,23635,1053,-900,-2630,512,-1396},
+	{208,2486,22861,91,-2086,-1783,537,52},
+	{-1197,1493,23478,532,944,2152,-242,1696},
+	{-148,1710,23897,1322,-2067,1294,-1843,1623},
+	{-1205,2533,23693,1304,846,1542,-445,1520},
+	{-922,1114,23104,-1464,-2567,2267,-1093,-238},
+	{-2118,3558,23290,1955,-1450,-69,1091,-1792},
+	{-2566,3586,22587,2911,-2278,-1890,1233,-1619},
+	{-2858,1292,23986,1077,-453,2459,-1745,-1484},
+	{-3035,3102,23666,-103,-245,-416,-233,-452},
+	{-2204,438,23253,-614,-2515,12,689,1245},
+	{-3240,2165,22891,2577,-870,-2099,1505,-789},
+	{-2683,3900,23949,-456,-2106,777,256,826},
+	{-3586,2731,23548,474,54,2732,123,-227},
+	{-2350,3905,23330,1723,-2847,915,1542,346},
+	{-3997,3271,23411,2822,1906,-789,1331,-1794},
+	{-595,2192,23202,688,-1236,452,1841,128},
+	{1392,1035,21991,1878,1640,-2829,362,470},
+	{1020,-1905,20984,-2781,1331,-897,1488,-859},
+	{3712,-1502,21216,-854,-2841,-107,333,-2000},
+	{2142,-1849,21804,-641,-1858,-407,-1086,536},
+	{2155,40,22391,424,-813,-518,-572,-16},
+	{1204,287,21588,1899,-2096,2630,1494,-1909},
+	{1368,538,22782,1828,-624,406,-317,-1298},
+	{-31,-954,21987,1249,1719,-1366,398,-1021},
+	{17,-709,22528,-1059,2833,690,-747,1977},
+	{2139,-1067,22690,-2683,-717,1182,-1880,186},
+	{63,-3074,21339,-2694,2479,-2679,125,-1857},
+	{597,-1059,22246,-871,187,1610,-119,1140},
+	{-719,-1297,22591,-2831,161,-2090,-1147,-1945},
+	{1512,-1214,22186,-912,-2566,-1037,-124,-1939},
+	{671,-1173,22786,-1560,-2177,-1269,390,-1632},
+	{1851,-298,23092,-2306,2292,-287,-1885,-240},
+	{3101,-268,22397,-2950,-2683,2798,888,-41},
+	{3872,1123,22420,-356,-948,-1798,994,806},
+	{2911,-91,22251,-379,-2534,854,-32,-610},
+	{3456,1050,22381,2135,-2004,689,-1443,-1772},
+	{301,605,23360,-1301,1392,2051,-1135,-653},
+	{268,1387,22949,2238,1670,-1694,-1308,-1608},
+	{630,1168,22403,1828,1032,-2238,1466,537},
+	{275,1116,22729,-401,-1994,-946,-1375,-1918},
+	{1358,-1010,22862,-1539,-2837,416,-1028,-181},
+	{1078,361,22820,-557,-1092,-2641,972,-724},
+	{989,-400,23070,-19,-1754,-1092,608,-387},
+	{-15,201,22743,-1367,-1395,1125,-1602,-1113},
+	{-332,590,23614,-1018,-1749,2295,-1711,-1779},
+	{97,1014,23990,317,259,1784,-899,-79},
+	{1342,-1102,23431,-2877,-2569,2935,-1438,-1407},
+	{-769,1791,23834,2125,1329,-731,-1668,1587},
+	{2504,1139,23528,-1334,1831,-2697,-1193,583},
+	{3754,1597,23893,-80,-1411,-1095,-1594,1328},
+	{3676,2233,22453,1187,-160,-2795,1809,-984},
+	{2673,164,23530,-1619,-2471,-710,-377,-1538},
+	{2542,2815,23153,2103,-1466,1916,-1237,-1846},
+	{2023,2933,23905,2954,-260,1209,-672,-769},
+	{3318,909,23860,622,-2534,628,-840,-1193},
+	{-142,1445,22102,-18,828,-2077,1985,-166},
+	{1693,2622,22753,713,-2225,-1069,1119,566},
+	{127,2456,23106,2951,-280,-2354,-931,-713},
+	{1511,463,23699,-1248,298,-1450,-748,797},
+	{2058,1843,23663,1978,-2654,-355,1380,-849},
+	{-922,1762,23550,-302,-587,890,-473,-1565},
+	{-2324,223,22804,-2556,2791,163,1404,-1630},
+	{-1123,1939,23892,1670,-1271,-2744,-717,-797},
+	{155,2184,23192,-382,251,-1066,1847,-1077},
+	{3150,2429,23428,-1472,-657,-604,1123,-395},
+	{3799,2822,23821,1253,-145,2507,-725,-1026},
+	{3006,3271,23305,-855,-1980,-1137,1980,-1516},
+	{946,3432,23870,1728,419,-2493,-239,-420},
+	{-431,2858,23657,872,-484,1857,-921,-299},
+	{2127,293,23756,-2056,-2823,1380,1415,27},
+	{239,1355,23517,-931,-1626,-1799,1824,-1474},
+	{-499,3455,23170,1326,-1294,1431,560,-584},
+	{743,2803,23668,-1263,-1014,-1120,1761,1748},
+	{-1278,1611,23572,-601,2810,-2256,1762,1602},
+	{265,619,23649,-2149,-2335,-2874,581,1801},
+	{-1364,2889,23418,-460,-130,-76,1716,730},
+	{-3129,2776,23904,-1305,2239,1546,-418,-1379},
+	{-2124,3173,23705,-2076,576,-2005,1907,-178},
+	{-1974,1581,23279,-1961,595,2344,887,-1657},
+	{1722,-721,23417,-2097,-1582,-2578,519,-911},
+	{-216,-1851,21466,2955,671,-724,-1823,185},
+	{487,-3356,19315,2217,909,1375,680,-1896},
+	{1375,-3764,21071,598,-2166,-2136,-1216,1110},
+	{-1444,-3702,19950,2432,1127,667,-1535,407},
+	{-2046,-2025,19753,1891,2923,2431,1899,1173},
+	{-1789,-3642,19538,2114,350,2335,-409,1086},
+	{-954,-3944,20377,2337,-2930,2318,-1293,557},
+	{-3220,-3983,18802,1722,-21,2851,-732,1174},
+	{-2465,-3334,19859,1563,125,608,-378,1781},
+	{-1740,-3397,20073,53,-678,193,1201,-468},
+	{-657,-2737,20832,1380,-735,-2411,-139,1132},
+	{-1886,-3377,20437,1512,-1367,1286,-1503,207},
+	{-3532,-2738,19966,-721,1887,2898,-752,437},
+	{-2959,-3848,19513,1821,-2168,1502,600,670},
+	{-2803,-3844,21013,163,-2294,-1702,-759,-11},
+	{-1153,-3599,21210,2956,-1318,2984,1665,-1535},
+	{-120,-2839,21064,-1154,-2175,495,1406,1956},
+	{918,-2977,21020,239,-2839,-268,326,1402},
+	{-548,-3973,21323,-1325,1837,-2816,-154,1377},
+	{-271,-1579,20765,2929,-2085,-1598,1979,178},
+	{-2494,-1170,20202,2962,2672,2498,510,-565},
+	{-2142,-1066,20692,2741,1254,2014,1149,1970},
+	{-1976,-3724,21802,1368,-30,1927,945,132},
+	{-2101,-3125,21176,-753,-612,-826,-134,-281},
+	{-3647,-3610,21057,-1957,-2437,704,143,22},
+	{-3339,-2862,21229,2937,-1461,1615,-1422,257},
+	{-2647,-3138,21214,2852,-698,-1800,1485,998},
+	{-2568,-3609,22140,754,-740,782,-791,-867},
+	{-2773,-2806,22306,1257,272,2944,-1206,-613},
+	{-3550,-3817,22324,1806,-2786,1933,-897,-1325},
+	{-3836,-3575,22775,2397,-2762,-485,-1265,-1121},
+	{-2590,-2080,21574,1396,939,2804,558,1039},
+	{-3019,-1551,21899,-169,1282,1966,-917,1329},
+	{-2921,-2933,21577,-774,2026,-81,-662,1403},
+	{-2038,-2897,21091,-818,275,1922,1782,1196},
+	{-2155,-2795,22311,2316,1193,-405,705,1085},
+	{-3949,-3649,20740,-2721,2815,-1222,-1323,-1853},
+	{-3608,-3035,20902,-634,2550,2393,815,-1833},
+	{-2774,-2424,20868,1164,-1164,-1490,1254,-1756},
+	{-3307,-2643,21156,-1908,2932,-1155,240,1532},
+	{-3043,-3105,21397,-2597,442,920,657,1998},
+	{-1599,-2373,21664,-272,-1777,-2002,882,1952},
+	{-3418,-3206,22257,721,1922,-1431,-1097,476},
+	{-3857,-1931,22286,568,1179,-116,-636,603},
+	{-1651,-3083,22386,1326,-2705,-305,1946,832},
+	{-3145,-3011,23617,2832,-685,1577,-1659,-1093},
+	{-2948,-3161,23359,1602,-1568,-1063,-646,-1934},
+	{-1893,-3744,21809,-2034,-1288,-2916,1225,1909},
+	{-597,-449,22431,1242,-1260,-91,1061,1463},
+	{-2094,-399,21778,2371,873,-2347,1682,-1036},
+	{-756,-1750,22224,481,-2786,-2866,967,1560},
+	{-2672,-2872,22180,-2149,-713,2333,-310,360},
+	{-2146,194,23080,2569,-602,2484,-236,847},
+	{-2033,-2756,22812,-2396,-2605,-68,-1383,-1766},
+	{-2695,-866,22956,1918,-845,315,318,-190},
+	{-3713,-1250,21976,758,612,543,-224,1389},
+	{-3414,115,22678,668,186,1928,1836,947},
+	{-3578,-2864,22276,-2162,2058,-2041,322,1703},
+	{-2746,-400,23301,582,-1039,-2995,1189,1600},
+	{-3695,-2201,23254,-1333,695,129,1609,908},
+	{-2746,1743,23074,2895,-2675,-431,1354,1848},
+	{-3567,-1000,23748,-958,-2464,-703,845,1851},
+	{-3058,-3585,23801,1951,-1337,1866,1471,1579},
+	{-2566,-3619,23224,-439,545,-2594,-217,610},
+	{638,-2319,20581,2807,2205,-407,-1711,77},
+	{632,-3736,20411,109,1996,90,-1549,-41},
+	{701,-3651,20295,-451,890,837,864,1009},
+	{1822,-3819,20491,462,-1583,-404,383,32},
+	{540,-2101,20652,2882,1411,1683,1581,578},
+	{1895,-3982,21179,222,-641,-113,-1662,-1466},
+	{-288,-3866,20979,2408,1224,2874,-535,-224},
+	{-714,-1345,21790,2357,2347,1122,-1444,-668},
+	{-1022,-2436,21604,-106,2484,515,176,-1351},
+	{83,-3612,21772,-692,826,-287,-1424,-348},
+	{229,-2891,21229,574,-516,-1954,976,-902},
+	{-947,-1325,21563,2424,1933,197,384,-963},
+	{100,-3985,22203,1661,-286,2252,-1824,-921},
+	{183,-3816,21778,2046,-2502,346,-1360,-785},
+	{-955,-3760,22286,2196,-1219,-125,-1911,-1476},
+	{-605,-3500,21493,-1265,-2975,1703,-281,-1512},
+	{-758,-2452,22056,-2072,1042,-1057,-611,130},
+	{138,-3300,21587,-2860,1373,2070,498,-1437},
+	{507,-2382,21639,1035,-2572,2775,-99,-462},
+	{-1598,-1447,21796,-285,1360,2208,262,-1403},
+	{-615,-2513,23028,-2299,-1952,1526,-1318,-1354},
+	{-828,-1753,22671,1431,-112,827,-240,-304},
+	{713,-3536,22675,2673,-2664,2551,-124,-972},
+	{-2132,-2382,22889,2437,66,1624,512,-1363},
+	{-72,-2014,23045,-61,-2373,807,-496,1394},
+	{-2182,-2893,22434,-1132,-530,2543,124,323},
+	{-2222,-3309,22850,-752,-1080,2393,1677,1578},
+	{-3897,-3759,22113,-2080,2201,-801,564,-1480},
+	{-1975,-3370,23234,1711,-1598,742,-1101,-1889},
+	{-3223,-3326,23379,2924,2202,344,94,-187},
+	{-2517,-3689,23344,2002,1071,968,343,-1673},
+	{-1004,-582,22572,2353,264,287,246,132},
+	{-2757,-1657,22586,-804,2397,1486,-97,-908},
+	{231,-388,22362,1906,-1563,540,838,-641},
+	{-1574,-1772,22261,443,1296,2897,1709,-1968},
+	{-1431,-1438,22705,1942,-62,-2462,168,-1341},
+	{-1045,-930,22414,1070,-1719,1336,693,-1546},
+	{-1104,-1262,23737,648,343,-2787,-1371,-1798},
+	{-1276,-3401,23284,-1476,-711,1175,137,-1867},
+	{-2645,-3535,22835,-2304,1224,731,-206,-1882},
+	{-3249,-2476,23327,-2412,2846,-758,-1120,-602},
+	{-1895,-2865,23569,-2931,240,-2508,-1666,272},
+	{-2973,-2819,22634,-1586,1571,-334,1561,-912},
+	{-3198,-1912,23383,-2576,1993,1564,-1458,-527},
+	{-2163,-3514,23824,-908,-401,1662,-67,228},
+	{-3056,-3945,23826,-1347,954,1345,-86,-1516},
+	{-1709,-3807,23538,568,110,-914,1808,-1468},
+	{-3439,-3209,23085,-1982,-110,-1647,1307,-837},
+	{-110,-845,23437,1354,-2710,1438,-1470,991},
+	{-252,-2654,23693,-2740,-1375,1471,-1421,-15},
+	{559,-1613,23029,-1286,-2037,-1367,1420,-1252},
+	{-2276,1029,23443,1958,1419,2765,1206,-1367},
+	{-2153,-965,23801,-900,-925,958,-122,-1116},
+	{-1587,-508,23137,1775,-1969,389,1372,-1632},
+	{-1469,-1813,23916,1258,-743,1927,590,-961},
+	{-3189,-2364,23846,-1409,1272,1773,1013,-893},
+	{-1214,1645,23578,1887,-2957,610,1300,1877},
+	{-661,-493,23918,-1876,-2534,-1283,453,542},
+	{-2163,-3024,23740,-2301,-619,2663,1429,-196},
+	{-2130,-147,23959,-1638,-2386,1418,297,354},
+	{-3532,-43,23666,229,-1674,-526,1848,-1273},
+	{-3338,-1280,23946,775,-1216,-1786,1990,-57},
+	{-2162,-2765,23937,1530,-1887,325,1947,892},
+	{-43,-1535,22913,-1527,-215,-1638,1067,-31},
+	{2057,-2223,21462,2803,-278,948,-1853,1021},
+	{2540,-3346,21025,-743,-2272,-1530,-1896,-798},
+	{3429,-3283,21851,2810,53,-2972,-1247,-851},
+	{1955,-3981,20804,2884,-2564,-819,-988,953},
+	{2249,-2586,22934,2320,1536,-1746,-503,402},
+	{2051,-3305,21941,1729,-1803,-2171,919,-1454},
+	{3075,-3317,22413,2355,-1915,51,727,-187},
+	{-637,-2050,22274,2924,2972,1417,1588,-294},
+	{1037,-3548,22097,1894,-1523,56,-1910,1481},
+	{1515,-3644,22635,210,1760,-1008,255,1864},
+	{1331,-3884,21194,2099,-2321,-1352,1559,1408},
+	{1635,-2978,22040,1175,-1682,-1742,1127,631},
+	{365,-3987,22606,-496,1833,550,-1069,535},
+	{129,-3309,22335,2706,776,-1218,-195,1637},
+	{1812,-3522,23080,1879,-526,904,-878,1179},
+	{2726,-3750,21433,-1025,-1010,528,1647,597},
+	{2774,-1186,21528,977,-1718,-1031,1105,1718},
+	{2895,-2372,21524,288,-1216,2430,1639,1496},
+	{2944,-3106,21410,-422,-2464,1154,1298,1586},
+	{1752,-1522,21800,2476,-2307,1333,1247,1903},
+	{1007,-1362,22172,1380,-925,-2076,-445,-852},
+	{2127,-3543,22093,-2149,-2203,1031,918,-546},
+	{1095,-2354,22316,2155,2753,2832,1151,259},
+	{1049,-3049,22851,-2217,-47,437,-1982,1642},
+	{-140,-2524,22534,228,306,159,581,1036},
+	{-769,-3267,22934,-813,669,1040,-917,847},
+	{-453,-2240,23139,1515,1330,2300,794,1682},
+	{1596,-2838,23148,2878,-2806,383,1104,1097},
+	{1349,-3330,23078,219,-2855,-1996,964,-670},
+	{-2931,-3485,23956,2373,52,2319,-1331,1492},
+	{-411,-3089,23844,2676,-2247,-1139,-629,-1047},
+	{765,-2570,23917,1497,-686,-1041,-1747,605},
+	{1633,-79,21196,1618,1106,2902,1940,8},
+	{1592,-2927,23178,-1914,1756,-1129,-1525,1764},
+	{3884,-1227,22254,1834,-1141,-1846,1588,1764},
+	{328,-82,22593,2433,2420,-1562,-394,-312},
+	{838,-2696,23109,-2378,794,385,-919,-144},
+	{1072,-1433,23110,1343,833,-1659,-468,-588},
+	{736,-1203,23070,2561,-1293,503,-114,-1901},
+	{1591,-684,22452,1618,-1613,-1773,362,1352},
+	{787,-3841,23380,-1798,662,-646,-1809,-645},
+	{-525,-3958,23161,-1845,1220,1315,435,524},
+	{1503,-1570,22849,2648,-1188,-1252,1979,1801},
+	{71,-2484,23727,1193,528,1216,-102,-1590},
+	{-2887,-3663,23502,102,1059,-1288,146,1399},
+	{-2772,-3564,23851,1290,2411,178,-234,-1378},
+	{-2012,-3827,23960,1914,2131,-1787,647,-831},
+	{196,-3373,23190,-2454,486,-2776,833,-1607},
+	{2040,-964,23091,-438,39,1745,-1755,718},
+	{823,-105,23174,713,1928,365,951,1959},
+	{1994,-207,22327,1828,50,811,388,180},
+	{1178,-925,22166,1389,-1805,373,1352,498},
+	{-249,907,23832,1607,1954,-354,418,454},
+	{1473,887,23835,2970,-2053,-983,-432,1090},
+	{549,-2753,23573,-3,-2154,998,867,-1718},
+	{-1397,-1902,23844,1640,1643,1865,90,-153},
+	{-2444,-2710,22867,-1948,2942,-839,1391,1696},
+	{658,-932,23979,481,-1299,5,1520,424},
+	{-574,-3325,23308,-1976,1251,-2925,1175,1365},
+	{-1254,729,23957,1856,1835,-2384,1072,243},
+	{-498,980,23671,867,-1946,2437,86,1882},
+	{-2813,-524,23145,2098,2228,-402,1810,1883},
+	{14,-1047,23967,138,-1231,-1261,-673,-931},
+	{1809,-3801,22489,113,-980,2957,-160,-497},
+	{2370,-3231,21453,-543,2434,119,37,-1181},
+	{3353,-2596,21830,1254,2002,-198,1315,-1499},
+	{3439,-3858,22262,2690,2993,2137,856,1544},
+	{3573,-3021,22388,739,1312,2547,-1264,-871},
+	{3901,-3298,22570,1467,804,878,-1614,-733},
+	{3189,-1913,22368,2987,-88,-1399,488,-1375},
+	{3773,-3107,22616,2893,224,771,114,-76},
+	{2624,-2171,22166,72,673,536,-1090,-448},
+	{2812,-3650,22234,-520,1408,-1414,633,594},
+	{3699,-3631,23066,-2511,382,-1948,-1887,1616},
+	{3875,-3971,21929,-1011,-1871,-381,1835,1676},
+	{3848,-2827,23362,795,-378,-2448,-572,-320},
+	{3422,-2217,22629,2580,-1084,1945,-776,-604},
+	{1707,-2865,23907,2672,2089,-792,-1819,664},
+	{1292,-3434,23980,2188,1134,-215,465,745},
+	{32,-3087,23716,-54,2674,765,280,-1881},
+	{3448,-2178,22049,-2758,-2893,2109,-1135,-1610},
+	{3212,-542,22575,1049,-236,-170,-830,-1102},
+	{3156,-1121,23341,1466,1451,1252,-627,644},
+	{3668,-2505,22802,881,-883,437,1418,670},
+	{3982,-3568,22446,-2566,-2975,2538,376,-1279},
+	{2389,-2760,22893,2415,370,2866,1633,-421},
+	{3197,-3257,23726,1070,880,2442,-231,-1604},
+	{3751,-1230,22933,1057,-1245,-1348,1606,1096},
+	{2832,-3093,23428,-2553,-2475,2627,-1574,-361},
+	{1969,-2207,23870,172,1392,-1867,-1176,1864},
+	{2413,-2662,23813,102,-1045,2706,1228,1408},
+	{583,-3464,23868,-2391,697,1837,-1161,1770},
+	{-364,-2520,23949,443,1246,2376,-1784,-1563},
+	{1480,-3007,23592,1033,1242,94,1783,-743},
+	{2031,-3663,23854,856,-292,2752,1497,-384},
+	{3155,-2261,22641,-1312,1497,1122,657,-421},
+	{3463,-2669,23560,-2623,2737,562,-1960,-223},
+	{3191,-1537,23457,703,2194,273,-180,142},
+	{3452,-2812,23717,-500,2890,2317,1023,1712},
+	{3967,-3094,23944,2422,1501,-2687,1913,1227},
+	{2154,-527,23072,-210,1279,2287,-1534,-1099},
+	{1510,-96,23012,542,2055,-2554,1820,-417},
+	{942,-1558,23076,-502,2267,600,1019,-628},
+	{2237,-323,23357,2972,-286,-2710,1774,-69},
+	{2223,-2207,23239,-2708,1097,-1121,-682,1001},
+	{1373,-1582,23234,-1276,1114,-1869,311,-186},
+	{3018,-2502,23936,-1024,505,-2515,-602,-768},
+	{1985,-2647,23546,288,1135,-565,1954,495},
+	{1713,-1786,23988,-1178,1294,2173,-588,278},
+	{1636,-2527,23443,-2855,240,-483,-641,-1298},
+	{2244,-1582,23871,1267,-1342,-2186,797,276},
+	{3842,-149,23310,2335,1689,2273,1014,-19},
+	{2436,692,22463,1061,1473,2212,1830,621},
+	{3315,1077,23228,50,2600,-2580,960,521},
+	{3790,1391,22665,2739,2975,1329,1273,-1034},
+	{3516,-42,23066,-893,-488,-281,1728,289},
+	{3691,3607,23756,1722,2519,2409,1803,195},
+	{3672,1480,23962,929,2646,-1398,420,-881},
+	{3007,119,23662,923,867,2910,1195,-441},
+	{3879,-1294,22771,-2184,-535,-2968,1133,1098},
+	{2171,-385,22912,-839,401,1509,1520,1639},
+	{3046,-832,23358,-2801,593,485,185,901},
+	{2208,91,23432,-641,1707,-928,1707,1643},
+	{3833,-1117,23996,-2006,545,-2388,1344,731},
+	{2563,167,23865,-394,1462,562,1577,-191},
+	{1002,-1894,23844,-1548,-14,-5,324,267},
+	{1980,-493,23467,1137,-1925,1942,1622,-1322},
+};
@@ -0,0 +1,56 @@
+#include "seeds.h"
+#include "seed_table.h"
+
+namespace seeds {
+
+static const size_t dims = sizeof(seed_q[0]) / sizeof(int16_t);
+
+size_t count()	{ return seed_count; }
+
+static float distance2(const float *q, size_t index) {
+	float d = 0;
+	for (size_t i=0; i<dims; i++) {
+		float e = q[i] - seed_q[index][i];
+		d += e*e;
+	}
+	return d;
+}
+
+/// parcours de l'intervalle [lo,hi[ de l'arbre, q en unités de la table
+static void search(const float *q, size_t lo, size_t hi, size_t depth, size_t &best, float &best2) {
+	while (lo < hi) {
+		size_t mid = (lo + hi) / 2;
+		float d2 = distance2(q, mid);
+		if (d2 < best2) {
+			best2 = d2;
+			best = mid;
+		}
+		float diff = q[depth % dims] - seed_q[mid][depth % dims];
+		depth++;
+		// d'abord le coté de q, puis l'autre seulement s'il peut contenir plus proche
+		if (diff < 0)	search(q, lo, mid, depth, best, best2);
+		else			search(q, mid+1, hi, depth, best, best2);
+		if (diff*diff >= best2)		return;
+		if (diff < 0)	lo = mid+1;
+		else			hi = mid;
+	}
+}
+
+size_t nearest(const float *q) {
+	float scaled[dims];
+	for (size_t i=0; i<dims; i++)	scaled[i] = q[i] / q_unit;
+	size_t best = 0;
+	float best2 = distance2(scaled, 0);
+	search(scaled, 0, seed_count, 0, best, best2);
+	return best;
+}
+
+void pose(size_t index, float *X) {
+	for (size_t i=0; i<dims; i++)	X[i] = seed_X[index][i] * x_unit[i];
+}
+
+void angles(size_t index, float *q) {
+	for (size_t i=0; i<dims; i++)	q[i] = seed_q[index][i] * q_unit;
+}
+
+};
@@ -0,0 +1,28 @@
+#ifndef _SEEDS_H
+#define _SEEDS_H
+
+/*
+	table de points de depart pour le mgd
+	poses précalculées de l'espace de travail avec leurs angles moteurs, rangées en arbre k-d implicite sur les angles
+	(aucun pointeur: le noeud de chaque intervalle est son milieu). les valeurs sont quantifiées sur 16 bits pour tenir en flash.
+	la table est generée par host/make_seeds dans seed_table.h.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace seeds {
+
+static const float q_unit = 1e-4;	// rad
+/// quantification des composantes de X: mm pour la position, rad pour les rotations
+static const float x_unit[] = {0.01, 0.01, 0.01, 1e-4, 1e-4, 1e-4, 1e-4, 1e-4};
+
+size_t count();
+/// numero de la pose de la table dont les angles sont les plus proches de q, en O(log n) en moyenne
+size_t nearest(const float *q);
+/// pose et angles d'une entrée de la table
+void pose(size_t index, float *X);
+void angles(size_t index, float *q);
+
+};
+#endif
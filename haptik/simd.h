@@ -0,0 +1,115 @@
+#ifndef _SIMD_H
+#define _SIMD_H
+
+/*
+	abstraction minimale des registres vectoriels (AVX, SSE, NEON)
+	un `simd::pack` contient `simd::width` flottants traités en parallele, sans dependance au jeu d'instruction dans le code appelant.
+	en l'absence de jeu d'instruction connu (STM32 sans NEON par exemple), un pack ne contient qu'un flottant.
+*/
+
+#include <stddef.h>
+#include <math.h>
+
+#if defined(__AVX__)
+	#include <immintrin.h>
+#elif defined(__SSE2__)
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+	#include <arm_neon.h>
+#endif
+
+namespace simd {
+
+#if defined(__AVX__)
+
+static const size_t width = 8;
+struct pack { __m256 v; };
+struct mask { __m256 v; };
+
+inline pack load(const float *p)			{ return pack{_mm256_loadu_ps(p)}; }
+inline void store(float *p, pack a)			{ _mm256_storeu_ps(p, a.v); }
+inline pack set(float x)					{ return pack{_mm256_set1_ps(x)}; }
+inline pack operator+(pack a, pack b)		{ return pack{_mm256_add_ps(a.v, b.v)}; }
+inline pack operator-(pack a, pack b)		{ return pack{_mm256_sub_ps(a.v, b.v)}; }
+inline pack operator*(pack a, pack b)		{ return pack{_mm256_mul_ps(a.v, b.v)}; }
+inline pack operator/(pack a, pack b)		{ return pack{_mm256_div_ps(a.v, b.v)}; }
+inline pack sqrt(pack a)					{ return pack{_mm256_sqrt_ps(a.v)}; }
+inline pack abs(pack a)						{ return pack{_mm256_andnot_ps(_mm256_set1_ps(-0.f), a.v)}; }
+inline mask operator<(pack a, pack b)		{ return mask{_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)}; }
+/// a la place de ceux de `m` qui sont vrais, b ailleurs
+inline pack select(mask m, pack a, pack b)	{ return pack{_mm256_blendv_ps(b.v, a.v, m.v)}; }
+
+#elif defined(__SSE2__)
+
+static const size_t width = 4;
+struct pack { __m128 v; };
+struct mask { __m128 v; };
+
+inline pack load(const float *p)			{ return pack{_mm_loadu_ps(p)}; }
+inline void store(float *p, pack a)			{ _mm_storeu_ps(p, a.v); }
+inline pack set(float x)					{ return pack{_mm_set1_ps(x)}; }
+inline pack operator+(pack a, pack b)		{ return pack{_mm_add_ps(a.v, b.v)}; }
+inline pack operator-(pack a, pack b)		{ return pack{_mm_sub_ps(a.v, b.v)}; }
+inline pack operator*(pack a, pack b)		{ return pack{_mm_mul_ps(a.v, b.v)}; }
+inline pack operator/(pack a, pack b)		{ return pack{_mm_div_ps(a.v, b.v)}; }
+inline pack sqrt(pack a)					{ return pack{_mm_sqrt_ps(a.v)}; }
+inline pack abs(pack a)						{ return pack{_mm_andnot_ps(_mm_set1_ps(-0.f), a.v)}; }
+inline mask operator<(pack a, pack b)		{ return mask{_mm_cmplt_ps(a.v, b.v)}; }
+inline pack select(mask m, pack a, pack b)	{ return pack{_mm_or_ps(_mm_and_ps(m.v, a.v), _mm_andnot_ps(m.v, b.v))}; }
+
+#elif defined(__ARM_NEON)
+
+static const size_t width = 4;
+struct pack { float32x4_t v; };
+struct mask { uint32x4_t v; };
+
+inline pack load(const float *p)			{ return pack{vld1q_f32(p)}; }
+inline void store(float *p, pack a)			{ vst1q_f32(p, a.v); }
+inline pack set(float x)					{ return pack{vdupq_n_f32(x)}; }
+inline pack operator+(pack a, pack b)		{ return pack{vaddq_f32(a.v, b.v)}; }
+inline pack operator-(pack a, pack b)		{ return pack{vsubq_f32(a.v, b.v)}; }
+inline pack operator*(pack a, pack b)		{ return pack{vmulq_f32(a.v, b.v)}; }
+#if defined(__aarch64__)
+inline pack operator/(pack a, pack b)		{ return pack{vdivq_f32(a.v, b.v)}; }
+inline pack sqrt(pack a)					{ return pack{vsqrtq_f32(a.v)}; }
+#else
+// armv7 n'a ni division ni racine vectorielle exacte
+inline pack operator/(pack a, pack b) {
+	float x[4], y[4];
+	vst1q_f32(x, a.v);	vst1q_f32(y, b.v);
+	for (size_t i=0; i<4; i++)	x[i] /= y[i];
+	return pack{vld1q_f32(x)};
+}
+inline pack sqrt(pack a) {
+	float x[4];
+	vst1q_f32(x, a.v);
+	for (size_t i=0; i<4; i++)	x[i] = ::sqrtf(x[i]);
+	return pack{vld1q_f32(x)};
+}
+#endif
+inline pack abs(pack a)						{ return pack{vabsq_f32(a.v)}; }
+inline mask operator<(pack a, pack b)		{ return mask{vcltq_f32(a.v, b.v)}; }
+inline pack select(mask m, pack a, pack b)	{ return pack{vbslq_f32(m.v, a.v, b.v)}; }
+
+#else
+
+static const size_t width = 1;
+struct pack { float v; };
+struct mask { bool v; };
+
+inline pack load(const float *p)			{ return pack{*p}; }
+inline void store(float *p, pack a)			{ *p = a.v; }
+inline pack set(float x)					{ return pack{x}; }
+inline pack operator+(pack a, pack b)		{ return pack{a.v + b.v}; }
+inline pack operator-(pack a, pack b)		{ return pack{a.v - b.v}; }
+inline pack operator*(pack a, pack b)		{ return pack{a.v * b.v}; }
+inline pack operator/(pack a, pack b)		{ return pack{a.v / b.v}; }
+inline pack sqrt(pack a)					{ return pack{::sqrtf(a.v)}; }
+inline pack abs(pack a)						{ return pack{::fabsf(a.v)}; }
+inline mask operator<(pack a, pack b)		{ return mask{a.v < b.v}; }
+inline pack select(mask m, pack a, pack b)	{ return m.v ? a : b; }
+
+#endif
+
+};
+#endif
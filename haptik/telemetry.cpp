@@ -0,0 +1,140 @@
+#include "telemetry.h"
+#include <string.h>
+#include <math.h>
+
+namespace telemetry {
+
+static const float pose_unit[] = {1e-3, 1e-3, 1e-3, 1e-5, 1e-5, 1e-5, 1e-5, 1e-5};
+static const float angle_unit[] = {1e-4, 1e-4, 1e-4, 1e-4, 1e-4, 1e-4, 1e-4, 1e-4};	// le codeur des moteurs est a 1.5e-3 rad
+static const float current_unit[] = {0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1};
+static const float solver_unit[] = {1, 1e-6};
+static const float loop_unit[] = {1};
+
+const ChannelInfo info[channels] = {
+	{"pose", 8, pose_unit, "x,y,z,rx,ry,rz,gx,gy"},
+	{"angles", 8, angle_unit, "q0,q1,q2,q3,q4,q5,q6,q7"},
+	{"current", 8, current_unit, "i0,i1,i2,i3,i4,i5,i6,i7"},
+	{"solver", 2, solver_unit, "iterations,residual"},
+	{"loop", 1, loop_unit, "duration"},
+};
+
+// plus grand echantillon: voie, temps et 8 valeurs de 5 octets au plus
+static const size_t max_sample = 1 + 5 + 5*max_values;
+
+size_t put_varint(uint8_t *dst, uint32_t value) {
+	size_t n = 0;
+	while (value >= 0x80) {
+		dst[n++] = value | 0x80;
+		value >>= 7;
+	}
+	dst[n++] = value;
+	return n;
+}
+
+size_t get_varint(const uint8_t *src, size_t size, uint32_t &value) {
+	value = 0;
+	for (size_t n=0; n<size && n<5; n++) {
+		value |= uint32_t(src[n] & 0x7F) << (7*n);
+		if (!(src[n] & 0x80))	return n+1;
+	}
+	return 0;
+}
+
+/// valeur en pas de la voie, bornée pour rester codable (un residu NaN ou infini devient la borne)
+static int32_t quantize(float value, float unit) {
+	const float bound = 1e9;
+	float q = value / unit;
+	if (q != q)		return int32_t(bound);
+	if (q > bound)	q = bound;
+	if (q < -bound)	q = -bound;
+	return lroundf(q);
+}
+
+Recorder::Recorder() : samples(0), dropped(0), head(0), tail(0), ready(0), used(0), sequence(0), last_time(0) {
+	memset(decimation, 0, sizeof(decimation));
+	memset(countdown, 0, sizeof(countdown));
+}
+
+void Recorder::select(Channel channel, uint8_t period) {
+	if (channel >= channels)	return;
+	decimation[channel] = period;
+	countdown[channel] = 0;
+}
+
+void Recorder::open(uint32_t time) {
+	uint8_t *b = ring[head];
+	bool key = sequence % keyframe_interval == 0;
+	b[0] = time;
+	b[1] = time >> 8;
+	b[2] = time >> 16;
+	b[3] = time >> 24;
+	b[4] = sequence++;
+	b[5] = key;
+	used = header_size;
+	last_time = time;
+	if (key)	memset(last, 0, sizeof(last));
+}
+
+void Recorder::close() {
+	length[head] = used;
+	head = (head + 1) % blocks;
+	ready++;
+	used = 0;
+}
+
+size_t Recorder::encode(Channel channel, const int32_t *values, uint32_t time, uint8_t *dst) const {
+	size_t n = 0;
+	dst[n++] = channel;
+	n += put_varint(dst + n, zigzag(int32_t(time - last_time)));
+	for (size_t k=0; k<info[channel].size; k++)		n += put_varint(dst + n, zigzag(values[k] - last[channel][k]));
+	return n;
+}
+
+void Recorder::record(Channel channel, const float *values, uint32_t time) {
+	if (channel >= channels || !decimation[channel])	return;
+	if (countdown[channel]) {
+		countdown[channel]--;
+		return;
+	}
+	countdown[channel] = decimation[channel] - 1;
+
+	int32_t v[max_values];
+	for (size_t k=0; k<info[channel].size; k++)		v[k] = quantize(values[k], info[channel].unit[k]);
+	// s'il ne tient plus dans le bloc en cours, l'echantillon ouvre le suivant (recodé: l'ecart de temps repart du debut du bloc, et il peut etre clé)
+	// le bloc en cours occupe une place de l'anneau: plein, l'echantillon est perdu sans toucher a l'etat des differences
+	if (!used)	open(time);
+	uint8_t sample[max_sample];
+	size_t size = encode(channel, v, time, sample);
+	if (used + size > block_size) {
+		if (ready == blocks-1) {
+			dropped++;
+			return;
+		}
+		close();
+		open(time);
+		size = encode(channel, v, time, sample);
+	}
+	memcpy(ring[head] + used, sample, size);
+	used += size;
+	last_time = time;
+	for (size_t k=0; k<info[channel].size; k++)		last[channel][k] = v[k];
+	samples++;
+}
+
+const uint8_t * Recorder::next(size_t &size) const {
+	if (!ready)		return nullptr;
+	size = length[tail];
+	return ring[tail];
+}
+
+void Recorder::release() {
+	if (!ready)		return;
+	tail = (tail + 1) % blocks;
+	ready--;
+}
+
+void Recorder::flush() {
+	if (used && ready < blocks-1)	close();
+}
+
+};
@@ -0,0 +1,155 @@
+#ifndef _TELEMETRY_H
+#define _TELEMETRY_H
+
+/*
+	telemetrie: enregistrement de voies choisies a chaque tick, envoyées par blocs compressés
+
+	chaque voie (pose, angles, courants...) a sa propre decimation: elle n'est enregistrée qu'un appel de record() sur n.
+	les valeurs sont quantifiées par le pas de la voie, puis codées en difference avec l'echantillon precedent de la meme voie,
+	en entiers de longueur variable (zigzag + varint, 7 bits par octet): une valeur qui bouge peu tient sur un octet.
+
+	les echantillons remplissent des blocs de taille fixe, rangés en anneau: la carte remplit un bloc pendant que les precedents partent.
+	si l'envoi ne suit pas, les nouveaux echantillons sont perdus (comptés dans dropped) et les blocs déja faits restent intacts.
+	les differences continuent d'un bloc au suivant; un bloc sur keyframe_interval est codé par rapport a 0 (bloc clé),
+	ce qui permet au decodeur de repartir apres un bloc perdu en route ou s'il prend le flux en cours.
+
+	format d'un bloc:  instant du debut (4 octets) numero(1) clé(1) puis les echantillons:  voie(1) ecart_de_temps_µs(varint zigzag) valeurs(varint zigzag)...
+	l'ecart de temps, depuis l'echantillon precedent du bloc, est signé: une voie peut etre datée de l'instant de ses données
+	(la pose, de la lecture des angles dont elle est issue).
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace telemetry {
+
+enum Channel : uint8_t {
+	POSE,		// X: mm et rad
+	ANGLES,		// q: rad
+	CURRENT,	// courants commandés: mA
+	SOLVER,		// iterations et residu du mgd_solve
+	LOOP,		// durée de la tache de controle: µs
+	channels
+};
+
+struct ChannelInfo {
+	const char *name;
+	uint8_t size;			// nombre de valeurs par echantillon
+	const float *unit;		// pas de quantification de chaque valeur
+	const char *columns;	// noms des valeurs, separés par des virgules
+};
+extern const ChannelInfo info[channels];
+
+static const size_t max_values = 8;
+static const size_t block_size = 48;	// trame TELEMETRY de 59 octets: tient dans le tampon d'emission de 64 octets du port serie
+static const size_t blocks = 8;
+static const size_t header_size = 6;
+static const uint8_t keyframe_interval = 8;
+
+class Recorder {
+public:
+	Recorder();
+
+	/// periode d'enregistrement de la voie en appels de record(), 0 pour l'arreter
+	void select(Channel channel, uint8_t decimation);
+	/// enregistre un echantillon de la voie si sa decimation le demande
+	void record(Channel channel, const float *values, uint32_t time);
+
+	/// plus ancien bloc complet, nullptr s'il n'y en a pas
+	const uint8_t * next(size_t &size) const;
+	/// libere le bloc rendu par next()
+	void release();
+	/// termine le bloc en cours meme s'il n'est pas plein (pour vider l'anneau)
+	void flush();
+
+	unsigned long samples;	// echantillons enregistrés
+	unsigned long dropped;	// echantillons perdus, l'anneau etant plein
+
+private:
+	void open(uint32_t time);
+	void close();
+	/// code un echantillon dans dst par rapport au bloc en cours, sans rien modifier
+	size_t encode(Channel channel, const int32_t *values, uint32_t time, uint8_t *dst) const;
+
+	uint8_t decimation[channels];
+	uint8_t countdown[channels];
+
+	uint8_t ring[blocks][block_size];
+	uint8_t length[blocks];		// taille utile des blocs complets
+	size_t head, tail, ready;	// bloc en cours, plus ancien bloc complet, nombre de blocs complets
+	size_t used;				// octets ecrits dans le bloc en cours, 0 s'il n'est pas ouvert
+	uint8_t sequence;			// numero du prochain bloc
+	uint32_t last_time;
+	int32_t last[channels][max_values];
+};
+
+/// decodeur des blocs d'un flux, dans l'ordre d'envoi
+class Decoder {
+public:
+	Decoder() : skipped(0), synced(false), expected(0) {}
+	/// appelle sample(voie, instant, valeurs) pour chaque echantillon du bloc
+	/// retourne faux si le bloc est ignoré (il manque un bloc avant lui, en attente du prochain bloc clé) ou invalide
+	template <class F>
+	bool decode(const uint8_t *block, size_t size, F sample);
+
+	unsigned long skipped;	// blocs ignorés faute d'etat
+private:
+	bool synced;
+	uint8_t expected;
+	int32_t last[channels][max_values];
+};
+
+/// entiers de longueur variable, exposés pour le decodeur de l'hote
+size_t put_varint(uint8_t *dst, uint32_t value);
+size_t get_varint(const uint8_t *src, size_t size, uint32_t &value);
+inline uint32_t zigzag(int32_t v)		{ return (uint32_t(v) << 1) ^ uint32_t(v >> 31); }
+inline int32_t unzigzag(uint32_t v)		{ return int32_t(v >> 1) ^ -int32_t(v & 1); }
+
+
+template <class F>
+bool Decoder::decode(const uint8_t *block, size_t size, F sample) {
+	if (size < header_size)		return false;
+	uint32_t time = block[0] | uint32_t(block[1]) << 8 | uint32_t(block[2]) << 16 | uint32_t(block[3]) << 24;
+	uint8_t number = block[4];
+	if (block[5]) {
+		for (size_t c=0; c<channels; c++)
+			for (size_t k=0; k<max_values; k++)		last[c][k] = 0;
+		synced = true;
+	}
+	else if (!synced || number != expected) {
+		synced = false;
+		skipped++;
+		return false;
+	}
+	expected = number + 1;
+	
+	size_t i = header_size;
+	while (i < size) {
+		uint8_t c = block[i++];
+		uint32_t dt;
+		size_t n = c < channels ? get_varint(block+i, size-i, dt) : 0;
+		if (!n) {
+			synced = false;
+			return false;
+		}
+		i += n;
+		time += unzigzag(dt);
+		float values[max_values];
+		for (size_t k=0; k<info[c].size; k++) {
+			uint32_t v;
+			n = get_varint(block+i, size-i, v);
+			if (!n) {
+				synced = false;
+				return false;
+			}
+			i += n;
+			last[c][k] += unzigzag(v);
+			values[k] = last[c][k] * info[c].unit[k];
+		}
+		sample(Channel(c), time, values);
+	}
+	return true;
+}
+
+};
+#endif
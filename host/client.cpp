@@ -0,0 +1,215 @@
+#include "client.h"
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <termios.h>
+#include <vector>
+
+namespace client {
+
+int64_t now_us() {
+	timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return int64_t(t.tv_sec) * 1000000 + t.tv_nsec / 1000;
+}
+
+/// constante termios d'un debit, 0 s'il n'est pas supporté
+static speed_t speed_constant(unsigned long baud) {
+	switch (baud) {
+		case 9600:		return B9600;
+		case 19200:		return B19200;
+		case 38400:		return B38400;
+		case 57600:		return B57600;
+		case 115200:	return B115200;
+		case 230400:	return B230400;
+#ifdef B460800
+		case 460800:	return B460800;
+		case 921600:	return B921600;
+		case 1000000:	return B1000000;
+		case 2000000:	return B2000000;
+#endif
+		default:		return 0;
+	}
+}
+
+Device::Device() : ping_period(100000), fd(-1), wake{-1, -1}, running(false), rejected(0) {}
+
+Device::~Device() {
+	close();
+}
+
+bool Device::open(const char *path, unsigned long baud) {
+	close();
+	speed_t speed = speed_constant(baud);
+	if (!speed)		return false;
+	fd = ::open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+	if (fd < 0)		return false;
+	termios t;
+	if (tcgetattr(fd, &t) == 0) {
+		cfmakeraw(&t);
+		t.c_cflag |= CLOCAL | CREAD;
+		cfsetispeed(&t, speed);
+		cfsetospeed(&t, speed);
+	}
+	if (tcsetattr(fd, TCSANOW, &t) || pipe(wake)) {
+		::close(fd);
+		fd = -1;
+		return false;
+	}
+	fcntl(wake[0], F_SETFL, O_NONBLOCK);
+	fcntl(wake[1], F_SETFL, O_NONBLOCK);
+
+	// rien ne reste de la session precedente, sauf la derniere pose publiée
+	Pose pose;
+	proto::Message message;
+	while (poses.pop(pose));
+	while (messages.pop(message));
+	while (commands.pop(message));
+	current = Stats();
+	current.connected = true;
+	published.publish(current);
+	rejected = 0;
+
+	running = true;
+	io = std::thread(&Device::run, this);
+	return true;
+}
+
+void Device::close() {
+	if (fd < 0)		return;
+	running = false;
+	char byte = 0;
+	if (write(wake[1], &byte, 1) < 0)	{}		// le tube plein reveille deja le fil
+	io.join();
+	::close(fd);
+	::close(wake[0]);
+	::close(wake[1]);
+	fd = wake[0] = wake[1] = -1;
+}
+
+Stats Device::stats() {
+	Stats s;
+	published.read(s);
+	s.commands_rejected = rejected.load(std::memory_order_relaxed);
+	return s;
+}
+
+bool Device::send(const proto::Message &message) {
+	if (fd < 0 || !commands.push(message)) {
+		rejected.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	// un octet dans le tube non bloquant: s'il est plein, le fil a deja de quoi se reveiller
+	char byte = 0;
+	if (write(wake[1], &byte, 1) < 0)	{}
+	return true;
+}
+
+bool Device::command(proto::Type type, const float *vec) {
+	proto::Message message;
+	message.type = type;
+	for (size_t i=0; i<8; i++)	message.vec[i] = vec ? vec[i] : 0;
+	return send(message);
+}
+
+bool Device::force(const float F[8])				{ return command(proto::FORCE, F); }
+bool Device::block(const float direction[8])		{ return command(proto::BLOCK, direction); }
+bool Device::none()									{ return command(proto::NONE, nullptr); }
+
+void Device::run() {
+	proto::Encoder encoder;
+	proto::Decoder decoder;
+	proto::Message message;
+	uint8_t frame[proto::max_frame];
+	uint8_t input[4096];
+	std::vector<uint8_t> output;	// trames pas encore acceptées par le port
+	size_t written = 0;
+	int64_t next_ping = now_us();
+	double rtt_sum = 0, rtt_sum2 = 0;
+
+	while (running.load(std::memory_order_acquire)) {
+		// commandes de l'application, horodatées au moment ou elles partent
+		while (commands.pop(message)) {
+			message.timestamp = uint32_t(now_us());
+			size_t size = encoder.encode(message, frame);
+			output.insert(output.end(), frame, frame + size);
+			current.commands++;
+		}
+		int64_t now = now_us();
+		if (ping_period && now >= next_ping) {
+			message.type = proto::PING;
+			message.timestamp = uint32_t(now);
+			message.echo = 0;
+			size_t size = encoder.encode(message, frame);
+			output.insert(output.end(), frame, frame + size);
+			current.pings++;
+			next_ping = now + ping_period;
+		}
+		if (written < output.size()) {
+			ssize_t n = write(fd, output.data() + written, output.size() - written);
+			if (n > 0)	written += n;
+			else if (n < 0 && errno != EAGAIN && errno != EINTR)	break;
+			if (written == output.size()) {
+				output.clear();
+				written = 0;
+			}
+		}
+
+		// attente d'octets, de place pour ecrire, d'une commande ou du prochain PING
+		pollfd fds[2] = {
+			{fd, short(POLLIN | (written < output.size() ? POLLOUT : 0)), 0},
+			{wake[0], POLLIN, 0},
+		};
+		int64_t wait = ping_period ? (next_ping - now_us() + 999) / 1000 : 100;
+		if (poll(fds, 2, wait < 0 ? 0 : (wait > 100 ? 100 : int(wait))) < 0 && errno != EINTR)	break;
+		if (fds[1].revents & POLLIN)
+			while (read(wake[0], input, sizeof(input)) > 0);
+
+		if (fds[0].revents & POLLIN) {
+			ssize_t n = read(fd, input, sizeof(input));
+			if (n == 0 || (n < 0 && errno != EAGAIN && errno != EINTR))		break;
+			int64_t received = now_us();
+			for (ssize_t i=0; i<n; i++) {
+				if (!decoder.push(input[i], message))	continue;
+				if (message.type == proto::POSE) {
+					Pose pose;
+					memcpy(pose.X, message.vec, sizeof(pose.X));
+					pose.seq = message.seq;
+					pose.device_time = message.timestamp;
+					pose.host_time = received;
+					last_pose.publish(pose);
+					current.poses++;
+					current.poses_dropped += !poses.push(pose);
+				}
+				else if (message.type == proto::PING) {
+					double rtt = uint32_t(uint32_t(received) - message.echo);
+					rtt_sum += rtt;
+					rtt_sum2 += rtt * rtt;
+					current.rtt_count++;
+					current.rtt_last = rtt;
+					current.rtt_mean = rtt_sum / current.rtt_count;
+					current.rtt_min = current.rtt_count == 1 || rtt < current.rtt_min ? rtt : current.rtt_min;
+					current.rtt_max = rtt > current.rtt_max ? rtt : current.rtt_max;
+					current.rtt_stddev = sqrt(fmax(0, rtt_sum2 / current.rtt_count - current.rtt_mean * current.rtt_mean));
+				}
+				else	current.messages_dropped += !messages.push(message);
+			}
+		}
+		else if (fds[0].revents & (POLLHUP | POLLERR))	break;
+
+		current.frame_errors = decoder.errors;
+		current.frames_lost = decoder.lost;
+		published.publish(current);
+	}
+	// port fermé ou en erreur: le fil s'arrete, close() reste a appeler
+	current.connected = false;
+	current.frame_errors = decoder.errors;
+	current.frames_lost = decoder.lost;
+	published.publish(current);
+}
+
+};
@@ -0,0 +1,112 @@
+#ifndef _CLIENT_H
+#define _CLIENT_H
+
+/*
+	bibliotheque cliente de l'ordinateur pour la carte, en protocole binaire (protocol.h)
+
+	chaque Device a son propre fil d'entrées-sorties, qui seul lit et ecrit le port serie: il decode les trames,
+	publie la derniere pose, range les poses et les autres messages dans des files, envoie les commandes en attente
+	et mesure regulierement l'aller-retour avec des PING.
+	le fil de l'application (la boucle de rendu) n'echange avec lui que par des files et un triple tampon sans verrou (ring.h):
+	aucune de ses methodes ne fait d'appel bloquant, n'alloue ni n'attend le port serie.
+	plusieurs Device peuvent etre ouverts dans un meme processus, ils ne partagent rien.
+
+	chaque file n'a qu'un producteur et un consommateur: les methodes de lecture (latest, next, receive, stats) sont a appeler
+	depuis un seul fil, et les methodes d'envoi (force, block, none, send) depuis un seul fil, le meme ou un autre.
+
+	g++ -O2 -pthread application.cpp client.cpp ../haptik/protocol.cpp -I../haptik -o application
+*/
+
+#include "protocol.h"
+#include "ring.h"
+#include <stdint.h>
+#include <atomic>
+#include <thread>
+
+namespace client {
+
+static const size_t pose_capacity = 256;	// poses non lues par next(): 5 s a 50 poses/s
+static const size_t message_capacity = 64;
+static const size_t command_capacity = 64;
+
+/// horloge monotone de l'hote en µs, celle de Pose::host_time
+int64_t now_us();
+
+struct Pose {
+	float X[8];				// mm et rad, comme vec8
+	uint16_t seq;			// numero de la trame
+	uint32_t device_time;	// µs, horloge de la carte a l'envoi
+	int64_t host_time;		// µs, now_us() a la reception
+};
+
+struct Stats {
+	bool connected;					// faux apres une erreur ou la fermeture du port
+	unsigned long poses;			// poses recues
+	unsigned long poses_dropped;	// poses perdues faute de lecture par next() (la derniere pose reste disponible)
+	unsigned long messages_dropped;	// autres messages perdus faute de lecture par receive()
+	unsigned long commands;			// commandes envoyées sur le port
+	unsigned long commands_rejected;	// commandes refusées, la file d'envoi etant pleine
+	unsigned long frame_errors;		// trames invalides
+	unsigned long frames_lost;		// trames manquantes d'apres les numeros de sequence
+
+	// aller-retour commande -> carte -> ordinateur, en µs: il comprend l'attente de la communication suivante sur la carte
+	unsigned long pings;			// PING envoyés
+	unsigned long rtt_count;		// reponses recues
+	double rtt_last, rtt_mean, rtt_min, rtt_max, rtt_stddev;
+};
+
+class Device {
+public:
+	Device();
+	~Device();
+	Device(const Device &) = delete;
+	Device & operator=(const Device &) = delete;
+
+	/// ouvre le port serie (ou un pseudo-terminal) en mode brut et demarre le fil d'entrées-sorties
+	bool open(const char *path, unsigned long baud = 57600);
+	/// arrete le fil et ferme le port, les commandes encore en file ne sont pas envoyées
+	void close();
+	bool is_open() const	{ return fd >= 0; }
+
+	// fil de l'application: lecture
+
+	/// derniere pose recue, faux si aucune ne l'a encore été
+	bool latest(Pose &pose)		{ return last_pose.read(pose); }
+	/// plus ancienne pose pas encore lue, dans l'ordre de reception, faux s'il n'y en a plus
+	bool next(Pose &pose)		{ return poses.pop(pose); }
+	/// plus ancien message de la carte autre qu'une pose ou un PING (TEXT, TELEMETRY)
+	bool receive(proto::Message &message)	{ return messages.pop(message); }
+	/// compteurs et aller-retour, tels que publiés par le fil apres son dernier echange
+	Stats stats();
+
+	// fil de l'application: envoi. faux si la file d'envoi est pleine, la commande est alors ignorée
+
+	bool force(const float F[8]);
+	bool block(const float direction[8]);
+	bool none();
+	/// n'importe quel message de l'ordinateur vers la carte, horodaté a l'envoi
+	bool send(const proto::Message &message);
+
+	/// µs entre deux PING, 0 pour ne pas mesurer l'aller-retour. a regler avant open()
+	uint32_t ping_period;
+
+private:
+	void run();
+	bool command(proto::Type type, const float *vec);
+
+	int fd;
+	int wake[2];	// tube pour reveiller le fil quand une commande arrive
+	std::thread io;
+	std::atomic<bool> running;
+
+	Latest<Pose> last_pose;
+	Ring<Pose, pose_capacity> poses;
+	Ring<proto::Message, message_capacity> messages;
+	Ring<proto::Message, command_capacity> commands;
+	Latest<Stats> published;
+	Stats current;				// tenu par le fil d'entrées-sorties
+	std::atomic<unsigned long> rejected;
+};
+
+};
+#endif
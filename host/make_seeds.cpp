@@ -0,0 +1,87 @@
+/*
+	genere la table des points de depart du mgd (haptik/seed_table.h, voir seeds.h)
+	les poses sont tirées dans une boite autour de la pose de repos, celles hors de l'espace de travail sont rejetées,
+	puis rangées en arbre k-d implicite sur leurs angles moteurs: le noeud d'un intervalle [lo,hi[ est au milieu, coupé sur l'axe profondeur % 8.
+	
+	g++ -O2 make_seeds.cpp ../haptik/model.cpp ../haptik/seeds.cpp -I../haptik -o make_seeds
+	./make_seeds 2048 > ../haptik/seed_table.h
+*/
+
+#include "model.h"
+#include "seeds.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+
+struct Sample {
+	int16_t q[N];
+	int16_t X[N];
+};
+
+static float uniform(float low, float high) {
+	return low + (high - low) * float(random()) / RAND_MAX;
+}
+
+/// range [lo,hi[ en arbre k-d implicite
+static void build(vector<Sample> &samples, size_t lo, size_t hi, size_t depth) {
+	if (hi - lo < 2)	return;
+	size_t mid = (lo + hi) / 2;
+	size_t axis = depth % N;
+	nth_element(samples.begin()+lo, samples.begin()+mid, samples.begin()+hi,
+		[axis](const Sample &a, const Sample &b) { return a.q[axis] < b.q[axis]; });
+	build(samples, lo, mid, depth+1);
+	build(samples, mid+1, hi, depth+1);
+}
+
+int main(int argc, char **argv) {
+	size_t count = argc > 1 ? atoi(argv[1]) : 2048;
+	Delta delta;
+	srandom(1);
+	
+	// boite de tirage (mm, rad)
+	const float low[N]  = {-40, -40, 120, -0.3, -0.3, -0.3, -0.2, -0.2};
+	const float high[N] = { 40,  40, 240,  0.3,  0.3,  0.3,  0.2,  0.2};
+	
+	vector<Sample> samples;
+	size_t rejected = 0;
+	while (samples.size() < count) {
+		vec8 X;
+		for (size_t i=0; i<N; i++)	X(i) = uniform(low[i], high[i]);
+		vec8 q = delta.mgi(X).q;
+		bool valid = true;
+		for (size_t i=0; i<N; i++)	valid = valid && isfinite(q(i)) && fabs(q(i)) < 32767 * seeds::q_unit;
+		if (!valid) {
+			rejected++;
+			continue;
+		}
+		Sample s;
+		for (size_t i=0; i<N; i++) {
+			s.q[i] = lround(q(i) / seeds::q_unit);
+			s.X[i] = lround(X(i) / seeds::x_unit[i]);
+		}
+		samples.push_back(s);
+	}
+	build(samples, 0, samples.size(), 0);
+	
+	printf("// genere par host/make_seeds (%zu poses, %zu rejetées hors de l'espace de travail), ne pas modifier\n", samples.size(), rejected);
+	printf("static const size_t seed_count = %zu;\n", samples.size());
+	printf("static const int16_t seed_q[seed_count][%zu] = {\n", N);
+	for (const Sample &s : samples) {
+		printf("\t{");
+		for (size_t i=0; i<N; i++)	printf("%d%s", s.q[i], i+1<N ? "," : "");
+		printf("},\n");
+	}
+	printf("};\n");
+	printf("static const int16_t seed_X[seed_count][%zu] = {\n", N);
+	for (const Sample &s : samples) {
+		printf("\t{");
+		for (size_t i=0; i<N; i++)	printf("%d%s", s.X[i], i+1<N ? "," : "");
+		printf("},\n");
+	}
+	printf("};\n");
+	return 0;
+}
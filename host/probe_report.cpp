@@ -0,0 +1,119 @@
+/*
+	affiche le rapport des sondes de temps de la carte (voir probe.h)
+	l'entrée est soit le texte du rapport (protocole texte), soit une capture brute du port serie en protocole binaire dont on garde les messages TEXT.
+	
+	g++ -O2 probe_report.cpp ../haptik/protocol.cpp -I../haptik -o probe_report
+	./probe_report capture.bin
+*/
+
+#include "protocol.h"
+#include "probe.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/// lignes du rapport, depuis le texte ou les trames
+static vector<string> read_report(FILE *input) {
+	vector<uint8_t> data;
+	uint8_t buffer[4096];
+	size_t n;
+	while ((n = fread(buffer, 1, sizeof(buffer), input)) > 0)
+		data.insert(data.end(), buffer, buffer+n);
+	
+	vector<string> lines;
+	if (memchr(data.data(), 0, data.size())) {
+		proto::Decoder decoder;
+		proto::Message message;
+		for (uint8_t byte : data)
+			if (decoder.push(byte, message) && message.type == proto::TEXT)
+				lines.push_back(string(message.text, message.length));
+	}
+	else {
+		string line;
+		for (uint8_t byte : data) {
+			if (byte == '\n')	{ lines.push_back(line);	line.clear(); }
+			else if (byte != '\r')	line += char(byte);
+		}
+		if (!line.empty())	lines.push_back(line);
+	}
+	return lines;
+}
+
+/// barre proportionnelle a count/max
+static string bar(unsigned long count, unsigned long max) {
+	const size_t width = 50;
+	return string(max ? (count * width + max-1) / max : 0, '#');
+}
+
+int main(int argc, char **argv) {
+	FILE *input = argc > 1 ? fopen(argv[1], "rb") : stdin;
+	if (!input) {
+		perror(argv[1]);
+		return 1;
+	}
+	vector<string> lines = read_report(input);
+	
+	double ticks_per_us = 1;
+	vector<string> recent;
+	for (const string &line : lines) {
+		if (line.empty())	continue;
+		const char *l = line.c_str();
+		char name[32];
+		unsigned long count, worst;
+		unsigned long long total;
+		int used;
+		if (sscanf(l, "T %lf", &ticks_per_us) == 1) {
+			printf("%-8s %10s %12s %12s\n", "phase", "count", "mean us", "worst us");
+		}
+		else if (sscanf(l, "P %31s %lu %lu %llu", name, &count, &worst, &total) == 4) {
+			if (count)	printf("%-8s %10lu %12.2f %12.2f\n", name, count, total / ticks_per_us / count, worst / ticks_per_us);
+		}
+		else if (sscanf(l, "H %31s %lu%n", name, &count, &used) == 2) {
+			// classes de la premiere non vide a la derniere
+			vector<unsigned long> h;
+			unsigned long first = count, max = 0, c;
+			int n;
+			for (const char *p = l + used; sscanf(p, " %lu%n", &c, &n) == 1; p += n) {
+				h.push_back(c);
+				if (c > max)	max = c;
+			}
+			if (h.empty())	continue;
+			printf("\n%s\n", name);
+			for (size_t k=0; k<h.size(); k++) {
+				unsigned long b = first + k;
+				double low = b ? (1ull << (b-1)) / ticks_per_us : 0;
+				double high = (1ull << b) / ticks_per_us;
+				printf("  %10.2f - %10.2f us %8lu  %s\n", low, high, h[k], bar(h[k], max).c_str());
+			}
+		}
+		else if (line[0] == 'I') {
+			vector<unsigned long> h;
+			unsigned long max = 0, c;
+			int n;
+			for (const char *p = l + 1; sscanf(p, " %lu%n", &c, &n) == 1; p += n) {
+				h.push_back(c);
+				if (c > max)	max = c;
+			}
+			if (!max)	continue;
+			printf("\nmgd_solve iterations\n");
+			for (size_t k=0; k<h.size(); k++)
+				if (h[k])	printf("  %2zu%s %8lu  %s\n", k, k+1 == h.size() ? "+" : " ", h[k], bar(h[k], max).c_str());
+		}
+		else if (line[0] == 'R')
+			recent.push_back(line.substr(2));
+	}
+	if (!recent.empty()) {
+		printf("\nlast %zu measures, oldest first\n", recent.size());
+		for (const string &r : recent) {
+			char name[32];
+			unsigned long ticks;
+			if (sscanf(r.c_str(), "%31s %lu", name, &ticks) == 2)
+				printf("  %-8s %10.2f us\n", name, ticks / ticks_per_us);
+		}
+	}
+	return 0;
+}
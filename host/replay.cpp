@@ -0,0 +1,82 @@
+#include "replay.h"
+#include <math.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace la;
+
+namespace replay {
+
+/// bilan d'un morceau, additionnés dans l'ordre des morceaux a la fin
+struct ChunkReport {
+	size_t converged;
+	size_t reseeded;
+	size_t histogram[max_iterations+1];
+};
+
+static void solve_chunk(const Delta &delta, const float *q, size_t begin, size_t end, const Columns &out, Method method, ChunkReport &report) {
+	report = ChunkReport();
+	Delta::broyden broyden;
+	Delta::levenberg levenberg;
+	vec8 X;
+	bool warm = false;
+	for (size_t k=begin; k<end; k++) {
+		vec8 Q(q + N*k);
+		Delta::solve_info info;
+		Delta::state s;
+		if (!warm) {
+			report.reseeded += k != begin;
+			s = delta.mgd_solve(Q, &info);
+			broyden = Delta::broyden();
+		}
+		else if (method == BROYDEN)		s = delta.mgd_solve(Q, X, broyden, &info);
+		else if (method == LEVENBERG)	s = delta.mgd_solve(Q, X, levenberg, &info);
+		else							s = delta.mgd_solve(Q, X, &info);
+		X = s.X;
+		warm = info.converged && X.norm() == X.norm();
+
+		for (size_t i=0; i<N; i++)	out.X[i][k] = X(i);
+		out.residual[k] = info.residual;
+		out.iterations[k] = info.iterations;
+		out.converged[k] = info.converged;
+		if (info.converged) {
+			report.converged++;
+			report.histogram[info.iterations < max_iterations ? info.iterations : max_iterations]++;
+		}
+	}
+}
+
+Report run(const Delta &delta, const float *q, size_t samples, const Columns &out, const Options &options) {
+	auto start = std::chrono::steady_clock::now();
+	size_t chunk = options.chunk ? options.chunk : 1;
+	Report report = Report();
+	report.samples = samples;
+	report.chunks = (samples + chunk - 1) / chunk;
+	report.threads = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+	if (report.threads > report.chunks)		report.threads = std::max<size_t>(1, report.chunks);
+
+	// chaque fil prend le prochain morceau libre
+	std::vector<ChunkReport> chunks(report.chunks);
+	std::atomic<size_t> next(0);
+	auto worker = [&] {
+		for (size_t c; (c = next.fetch_add(1, std::memory_order_relaxed)) < report.chunks; )
+			solve_chunk(delta, q, c*chunk, std::min(samples, (c+1)*chunk), out, options.method, chunks[c]);
+	};
+	std::vector<std::thread> pool;
+	for (unsigned t=1; t<report.threads; t++)	pool.emplace_back(worker);
+	worker();
+	for (std::thread &t : pool)		t.join();
+
+	for (const ChunkReport &c : chunks) {
+		report.converged += c.converged;
+		report.reseeded += c.reseeded;
+		for (int n=0; n<=max_iterations; n++)	report.histogram[n] += c.histogram[n];
+	}
+	report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	return report;
+}
+
+};
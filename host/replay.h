@@ -0,0 +1,57 @@
+#ifndef _REPLAY_H
+#define _REPLAY_H
+
+/*
+	recalcul hors ligne des poses a partir d'angles moteurs enregistrés, par mgd_solve, sur plusieurs fils
+
+	les echantillons sont coupés en morceaux de taille fixe. chaque morceau est resolu par un seul fil, dans l'ordre:
+	le premier echantillon part de la table des poses précalculées (Delta::seed), les suivants de la pose du precedent,
+	comme la boucle de la carte. apres un echec de convergence, l'echantillon suivant repart de la table.
+	aucun etat ne passe d'un morceau a l'autre: le resultat ne depend que de la taille des morceaux, pas du nombre de fils
+	ni de l'ordre dans lequel ils prennent les morceaux.
+
+	g++ -O2 -pthread application.cpp replay.cpp ../haptik/model.cpp ../haptik/seeds.cpp -I../haptik -o application
+*/
+
+#include "model.h"
+#include <stddef.h>
+
+namespace replay {
+
+enum Method {
+	NEWTON,		// mci recalculée a chaque iteration
+	BROYDEN,	// jacobienne gardée d'un echantillon a l'autre dans un morceau
+	LEVENBERG,	// moindres carrés amortis
+};
+
+struct Options {
+	size_t chunk = 4096;		// echantillons par morceau
+	unsigned threads = 0;		// 0: un par coeur
+	Method method = NEWTON;
+};
+
+/// colonnes de sortie, une valeur par echantillon (float64 comme host/telemetry_decode)
+struct Columns {
+	double *X[N];			// pose, mm et rad
+	double *residual;		// norme de l'erreur sur q a la sortie de mgd_solve
+	double *iterations;		// evaluations du mgi
+	double *converged;		// 1 ou 0
+};
+
+static const int max_iterations = 8;	// limite de mgd_solve
+
+struct Report {
+	size_t samples;
+	size_t chunks;
+	unsigned threads;
+	size_t converged;
+	size_t reseeded;		// echantillons repartis de la table apres un echec, en plus du premier de chaque morceau
+	size_t histogram[max_iterations+1];	// resolutions convergées par nombre d'iterations
+	double seconds;
+};
+
+/// resout les samples echantillons de q (8 float consecutifs par echantillon, en rad) et remplit out
+Report run(const Delta &delta, const float *q, size_t samples, const Columns &out, const Options &options = Options());
+
+};
+#endif
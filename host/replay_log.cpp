@@ -0,0 +1,124 @@
+/*
+	recalcule les poses d'un enregistrement d'angles moteurs avec le modele et le solveur actuels (voir replay.h)
+	l'enregistrement est une suite d'echantillons de 8 float32 little-endian (q0..q7 en rad), sans entete.
+	les sorties sont des colonnes de float64 little-endian, comme host/telemetry_decode: pose.x ... pose.gy,
+	solver.iterations, solver.residual, solver.converged, listées dans index.txt.
+	entrée et sorties sont projetées en memoire: chaque fil ecrit directement la partie des colonnes de ses morceaux.
+
+	g++ -O2 -pthread replay_log.cpp replay.cpp ../haptik/model.cpp ../haptik/seeds.cpp -I../haptik -o replay_log
+	./replay_log [-j threads] [-c chunk] [-m newton|broyden|lm] q.bin output_directory
+*/
+
+#include "replay.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/// colonne de sortie de samples valeurs, projetée en memoire
+static double * map_column(const string &path, size_t samples) {
+	int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)		return nullptr;
+	size_t size = samples * sizeof(double);
+	void *data = MAP_FAILED;
+	if (ftruncate(fd, size) == 0)	data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	return data == MAP_FAILED ? nullptr : (double *) data;
+}
+
+static void usage(const char *program) {
+	fprintf(stderr, "usage: %s [-j threads] [-c chunk] [-m newton|broyden|lm] q.bin output_directory\n", program);
+	exit(1);
+}
+
+int main(int argc, char **argv) {
+	replay::Options options;
+	int opt;
+	while ((opt = getopt(argc, argv, "j:c:m:")) != -1) {
+		switch (opt) {
+			case 'j':	options.threads = atoi(optarg);	break;
+			case 'c':	options.chunk = strtoul(optarg, nullptr, 10);	break;
+			case 'm':
+				if 		(!strcmp(optarg, "newton"))		options.method = replay::NEWTON;
+				else if (!strcmp(optarg, "broyden"))	options.method = replay::BROYDEN;
+				else if (!strcmp(optarg, "lm"))			options.method = replay::LEVENBERG;
+				else	usage(argv[0]);
+				break;
+			default:	usage(argv[0]);
+		}
+	}
+	if (argc - optind != 2 || !options.chunk)		usage(argv[0]);
+
+	int fd = open(argv[optind], O_RDONLY);
+	struct stat st;
+	if (fd < 0 || fstat(fd, &st) < 0) {
+		perror(argv[optind]);
+		return 1;
+	}
+	const size_t record = N * sizeof(float);
+	if (st.st_size % record)
+		fprintf(stderr, "%s: %zu trailing bytes ignored (not a whole sample)\n", argv[optind], size_t(st.st_size % record));
+	size_t samples = st.st_size / record;
+	if (!samples) {
+		fprintf(stderr, "%s: no complete sample\n", argv[optind]);
+		return 1;
+	}
+	void *data = mmap(nullptr, samples * record, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		perror(argv[optind]);
+		return 1;
+	}
+	madvise(data, samples * record, MADV_SEQUENTIAL);
+	const float *q = (const float *) data;
+
+	string dir = argv[optind+1];
+	mkdir(dir.c_str(), 0755);
+	const char *pose_names[N] = {"x", "y", "z", "rx", "ry", "rz", "gx", "gy"};
+	vector<string> names;
+	for (size_t i=0; i<N; i++)	names.push_back(string("pose.") + pose_names[i]);
+	names.push_back("solver.iterations");
+	names.push_back("solver.residual");
+	names.push_back("solver.converged");
+	vector<double *> columns;
+	for (const string &name : names) {
+		double *column = map_column(dir + "/" + name, samples);
+		if (!column) {
+			perror((dir + "/" + name).c_str());
+			return 1;
+		}
+		columns.push_back(column);
+	}
+	replay::Columns out;
+	for (size_t i=0; i<N; i++)	out.X[i] = columns[i];
+	out.iterations = columns[N];
+	out.residual = columns[N+1];
+	out.converged = columns[N+2];
+
+	static const Delta delta;
+	replay::Report report = replay::run(delta, q, samples, out, options);
+
+	for (double *column : columns)	munmap(column, samples * sizeof(double));
+	FILE *index = fopen((dir + "/index.txt").c_str(), "w");
+	if (!index) {
+		perror(dir.c_str());
+		return 1;
+	}
+	for (const string &name : names)	fprintf(index, "%s %zu\n", name.c_str(), samples);
+	fclose(index);
+
+	printf("%zu samples in %zu chunks of %zu on %u threads: %.3f s, %.0f samples/s\n",
+		report.samples, report.chunks, options.chunk, report.threads, report.seconds, report.samples / report.seconds);
+	printf("%zu converged (%.2f%%), %zu restarted from the seed table after a failure\n  iterations",
+		report.converged, 100. * report.converged / samples, report.reseeded);
+	for (int n=1; n<=replay::max_iterations; n++)	printf(" %d:%zu", n, report.histogram[n]);
+	printf("\n");
+	return 0;
+}
@@ -0,0 +1,85 @@
+#ifndef _RING_H
+#define _RING_H
+
+/*
+	echanges sans verrou entre deux fils de l'hote (voir client.h)
+
+	Ring: file d'un seul producteur vers un seul consommateur. push() et pop() se terminent en un nombre borné d'instructions
+	quoi que fasse l'autre fil (wait-free): push() echoue si la file est pleine, pop() si elle est vide.
+
+	Latest: derniere valeur publiée par un fil, lue par un autre (triple tampon). l'ecrivain ne remplace jamais la valeur
+	que le lecteur est en train de copier, et aucun des deux n'attend l'autre. les valeurs intermediaires peuvent etre sautées.
+*/
+
+#include <stddef.h>
+#include <atomic>
+
+namespace client {
+
+/// taille d'une ligne de cache: les indices du producteur et du consommateur sont sur des lignes differentes
+static const size_t cache_line = 64;
+
+template <class T, size_t capacity>
+class Ring {
+	static_assert(capacity && !(capacity & (capacity-1)), "la capacité doit etre une puissance de 2");
+public:
+	Ring() : head(0), tail(0) {}
+
+	/// producteur: ajoute une copie de value, faux si la file est pleine
+	bool push(const T &value) {
+		size_t h = head.load(std::memory_order_relaxed);
+		if (h - tail.load(std::memory_order_acquire) == capacity)	return false;
+		items[h & (capacity-1)] = value;
+		head.store(h+1, std::memory_order_release);
+		return true;
+	}
+	/// consommateur: retire le plus ancien element, faux si la file est vide
+	bool pop(T &value) {
+		size_t t = tail.load(std::memory_order_relaxed);
+		if (head.load(std::memory_order_acquire) == t)	return false;
+		value = items[t & (capacity-1)];
+		tail.store(t+1, std::memory_order_release);
+		return true;
+	}
+	/// nombre d'elements, approximatif pendant que l'autre fil travaille
+	size_t size() const		{ return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire); }
+
+private:
+	T items[capacity];
+	alignas(cache_line) std::atomic<size_t> head;	// ecrit par le producteur seul
+	alignas(cache_line) std::atomic<size_t> tail;	// ecrit par le consommateur seul
+};
+
+template <class T>
+class Latest {
+public:
+	Latest() : middle(1), back(0), front(2), valid(false) {}
+
+	/// ecrivain: publie une copie de value
+	void publish(const T &value) {
+		buffers[back] = value;
+		back = middle.exchange(back | fresh, std::memory_order_acq_rel) & index;
+	}
+	/// lecteur: copie la derniere valeur publiée, faux si rien n'a encore été publié
+	bool read(T &value) {
+		if (middle.load(std::memory_order_relaxed) & fresh) {
+			front = middle.exchange(front, std::memory_order_acq_rel) & index;
+			valid = true;
+		}
+		if (valid)	value = buffers[front];
+		return valid;
+	}
+
+private:
+	static const unsigned index = 3;
+	static const unsigned fresh = 4;	// le tampon du milieu a été publié depuis la derniere lecture
+
+	T buffers[3];
+	alignas(cache_line) std::atomic<unsigned> middle;	// tampon d'echange, avec le drapeau fresh
+	alignas(cache_line) unsigned back;					// tampon de l'ecrivain
+	alignas(cache_line) unsigned front;					// tampon du lecteur
+	bool valid;
+};
+
+};
+#endif
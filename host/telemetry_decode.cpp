@@ -0,0 +1,100 @@
+/*
+	decode la telemetrie de la carte (voir telemetry.h) depuis une capture brute du port serie en protocole binaire
+	chaque valeur de chaque voie est ecrite dans son propre fichier de float64 little-endian (format colonne),
+	avec le temps en secondes depuis le premier echantillon: numpy.fromfile("out/angles.q0", "<f8")
+	index.txt liste les fichiers avec leur nombre de valeurs.
+
+	g++ -O2 telemetry_decode.cpp ../haptik/telemetry.cpp ../haptik/protocol.cpp -I../haptik -o telemetry_decode
+	./telemetry_decode capture.bin out
+*/
+
+#include "protocol.h"
+#include "telemetry.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct Column {
+	string name;
+	vector<double> values;
+};
+
+int main(int argc, char **argv) {
+	if (argc < 3) {
+		fprintf(stderr, "usage: %s capture.bin output_directory\n", argv[0]);
+		return 1;
+	}
+	FILE *input = strcmp(argv[1], "-") ? fopen(argv[1], "rb") : stdin;
+	if (!input) {
+		perror(argv[1]);
+		return 1;
+	}
+	string dir = argv[2];
+	mkdir(dir.c_str(), 0755);
+
+	// une colonne de temps puis une par valeur, pour chaque voie
+	vector<Column> columns[telemetry::channels];
+	for (size_t c=0; c<telemetry::channels; c++) {
+		const telemetry::ChannelInfo &info = telemetry::info[c];
+		columns[c].push_back(Column{string(info.name) + ".time", {}});
+		string names = info.columns;
+		for (size_t start = 0, end; start <= names.size(); start = end+1) {
+			end = names.find(',', start);
+			if (end == string::npos)	end = names.size();
+			columns[c].push_back(Column{string(info.name) + "." + names.substr(start, end-start), {}});
+		}
+	}
+
+	// temps sur 64 bits malgré le debordement de l'horloge de la carte, compté depuis le premier echantillon
+	bool started = false;
+	uint32_t last_time = 0;
+	int64_t time = 0;
+	unsigned long blocks = 0, bad_blocks = 0;
+	telemetry::Decoder telemetry_decoder;
+
+	proto::Decoder decoder;
+	proto::Message message;
+	int byte;
+	while ((byte = fgetc(input)) != EOF) {
+		if (!decoder.push(byte, message) || message.type != proto::TELEMETRY)	continue;
+		blocks++;
+		bool valid = telemetry_decoder.decode((const uint8_t *) message.text, message.length,
+			[&](telemetry::Channel c, uint32_t t, const float *values) {
+				if (!started)	last_time = t;
+				started = true;
+				time += int32_t(t - last_time);
+				last_time = t;
+				columns[c][0].values.push_back(time * 1e-6);
+				for (size_t k=0; k<telemetry::info[c].size; k++)	columns[c][k+1].values.push_back(values[k]);
+			});
+		bad_blocks += !valid;
+	}
+
+	FILE *index = fopen((dir + "/index.txt").c_str(), "w");
+	if (!index) {
+		perror(dir.c_str());
+		return 1;
+	}
+	for (size_t c=0; c<telemetry::channels; c++) {
+		if (columns[c][0].values.empty())	continue;
+		printf("%-8s %8zu samples\n", telemetry::info[c].name, columns[c][0].values.size());
+		for (const Column &column : columns[c]) {
+			FILE *out = fopen((dir + "/" + column.name).c_str(), "wb");
+			if (!out) {
+				perror(column.name.c_str());
+				return 1;
+			}
+			fwrite(column.values.data(), sizeof(double), column.values.size(), out);
+			fclose(out);
+			fprintf(index, "%s %zu\n", column.name.c_str(), column.values.size());
+		}
+	}
+	fclose(index);
+	printf("%lu blocks (%lu not decoded, waiting for a key block), %lu frame errors, %lu frames lost\n", blocks, bad_blocks, decoder.errors, decoder.lost);
+	return 0;
+}
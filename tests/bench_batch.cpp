@@ -0,0 +1,79 @@
+#include "model.h"
+#include "batch.h"
+#include "simd.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+
+using namespace la;
+
+static double now() {
+	timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + 1e-9*t.tv_nsec;
+}
+static float uniform(float amplitude) {
+	return (2*float(random())/RAND_MAX - 1) * amplitude;
+}
+
+int main() {
+	Delta delta;
+	const size_t nblocks = 256;
+	const int repeat = 20;
+	static DeltaBatch blocks[nblocks];
+	
+	// poses aleatoires autour de la position centrale de l'espace de travail
+	srandom(0);
+	for (size_t k=0; k<nblocks; k++)
+		for (size_t p=0; p<batch_size; p++) {
+			float X[N] = {uniform(20), uniform(20), 200+uniform(20), uniform(0.1), uniform(0.1), uniform(0.1), uniform(0.1), uniform(0.1)};
+			for (size_t i=0; i<N; i++)	blocks[k].X[i][p] = X[i];
+		}
+	
+	// comparaison avec le mgi scalaire
+	float err = 0;
+	for (size_t k=0; k<nblocks; k++) {
+		mgi_batch(delta, blocks[k]);
+		for (size_t p=0; p<batch_size; p++) {
+			vec8 X;
+			for (size_t i=0; i<N; i++)	X(i) = blocks[k].X[i][p];
+			Delta::state s = delta.mgi(X);
+			for (size_t i=0; i<N; i++) {
+				err = fmax(err, fabs(s.q(i) - blocks[k].q[i][p]));
+				for (size_t j=0; j<3; j++) {
+					err = fmax(err, fabs(s.c[i](j) - blocks[k].c[i][j][p]) / delta.R);
+					err = fmax(err, fabs(s.a[i](j) - blocks[k].a[i][j][p]) / delta.R);
+				}
+			}
+		}
+	}
+	printf("simd width %d, max error %g\n", int(simd::width), err);
+	
+	// debit
+	float sink = 0;
+	double start = now();
+	for (int r=0; r<repeat; r++)
+		for (size_t k=0; k<nblocks; k++) {
+			for (size_t p=0; p<batch_size; p++) {
+				vec8 X;
+				for (size_t i=0; i<N; i++)	X(i) = blocks[k].X[i][p];
+				sink += delta.mgi(X).q(0);
+			}
+		}
+	double scalar = (now()-start) / (repeat*nblocks*batch_size);
+	
+	start = now();
+	for (int r=0; r<repeat; r++)
+		for (size_t k=0; k<nblocks; k++) {
+			mgi_batch(delta, blocks[k]);
+			sink += blocks[k].q[0][0];
+		}
+	double batched = (now()-start) / (repeat*nblocks*batch_size);
+	
+	printf("mgi        %8.1f ns/pose\n", scalar*1e9);
+	printf("mgi_batch  %8.1f ns/pose   (x%.2f)\n", batched*1e9, scalar/batched);
+	printf("(%g)\n", sink);
+	
+	return err < 1e-4 ? 0 : 1;
+}
@@ -0,0 +1 @@
+g++ -O2 -march=native bench_batch.cpp ../haptik/model.cpp ../haptik/seeds.cpp ../haptik/batch.cpp -I../haptik -o bench_batch && exec ./bench_batch
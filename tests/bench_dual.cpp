@@ -0,0 +1,68 @@
+#include "model.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#if defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+	static unsigned long long cycles()	{ return __rdtsc(); }
+#else
+	static unsigned long long cycles()	{ return 0; }
+#endif
+
+using namespace la;
+
+static float uniform(float amplitude) {
+	return (2*float(random())/RAND_MAX - 1) * amplitude;
+}
+static vec8 random_pose() {
+	float X[N] = {uniform(20), uniform(20), 200+uniform(20), uniform(0.1), uniform(0.1), uniform(0.1), uniform(0.05), uniform(0.05)};
+	return vec8(X);
+}
+
+/// cycles moyens par appel de f
+template <class F>
+static double measure(F f, int repeat) {
+	unsigned long long start = cycles();
+	for (int i=0; i<repeat; i++)	f();
+	return double(cycles() - start) / repeat;
+}
+
+int main() {
+	Delta delta;
+	const int samples = 200;
+	
+	// dq/dX par differentiation automatique contre differences finies centrées, et contre l'inverse de mci
+	srandom(0);
+	float err_fd = 0, err_mci = 0;
+	for (int k=0; k<samples; k++) {
+		vec8 X = random_pose();
+		mat8 dqdX;
+		Delta::state s = delta.mgi(X, dqdX);
+		for (size_t j=0; j<N; j++) {
+			const float h = j<3? 1e-2: 1e-4;
+			vec8 Xp = X, Xm = X;
+			Xp(j) += h;
+			Xm(j) -= h;
+			vec8 fd = (delta.mgi(Xp).q - delta.mgi(Xm).q) / (2*h);
+			for (size_t i=0; i<N; i++)	err_fd = fmax(err_fd, fabs(fd(i) - dqdX(i,j)));
+		}
+		mat8 P = delta.mci(s) * dqdX;
+		for (size_t i=0; i<N; i++)
+			for (size_t j=0; j<N; j++)	err_mci = fmax(err_mci, fabs(P(i,j) - (i==j)));
+	}
+	printf("dq/dX: max difference with finite differences  %g\n", err_fd);
+	printf("dq/dX: max error of mci * dq/dX from identity  %g\n", err_mci);
+	
+	// cout de calcul: un passage derivé contre mgi suivi de mci
+	vec8 X = random_pose();
+	Delta::state s = delta.mgi(X);
+	mat8 dqdX;
+	volatile float sink = 0;
+	printf("%-16s %12s\n", "cycles", "float");
+	printf("%-16s %12.0f\n", "mgi",				measure([&]{ sink = delta.mgi(X).q(0); }, 2000));
+	printf("%-16s %12.0f\n", "mci",				measure([&]{ sink = delta.mci(s)(0,0); }, 2000));
+	printf("%-16s %12.0f\n", "mgi + mci",		measure([&]{ sink = delta.mci(delta.mgi(X))(0,0); }, 2000));
+	printf("%-16s %12.0f\n", "mgi(X, dqdX)",	measure([&]{ sink = delta.mgi(X, dqdX).q(0) + dqdX(0,0); }, 2000));
+	
+	return 0;
+}
@@ -0,0 +1 @@
+g++ -O3 -march=native bench_dual.cpp ../haptik/model.cpp ../haptik/seeds.cpp -I../haptik -o bench_dual && exec ./bench_dual
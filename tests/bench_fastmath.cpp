@@ -0,0 +1,66 @@
+#include "model.h"
+#include "fastmath.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#if defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+	static unsigned long long cycles()	{ return __rdtsc(); }
+#else
+	static unsigned long long cycles()	{ return 0; }
+#endif
+
+/*
+	noyaux de fastmath.h contre la libm, puis le mgi et mgd_solve selon HAPTIK_FASTMATH (voir bench_fastmath.sh qui compile les deux versions)
+*/
+
+using namespace la;
+
+static const int count = 1024;
+static float a[count], b[count];
+
+/// cycles moyens par element pour f appliquée au tableau d'entrées
+template <class F>
+static double measure(F f, int repeat) {
+	volatile float sink = 0;
+	unsigned long long start = cycles();
+	for (int k=0; k<repeat; k++) {
+		float sum = 0;
+		for (int i=0; i<count; i++)	sum += f(i);
+		sink = sink + sum;
+	}
+	return double(cycles() - start) / (repeat * count);
+}
+
+int main() {
+	const int n = 2000;
+	srandom(0);
+	for (int i=0; i<count; i++) {
+		a[i] = (2*float(random())/RAND_MAX - 1) * M_PI;
+		b[i] = 1 + float(random())/RAND_MAX * 300;
+	}
+	printf("HAPTIK_FASTMATH=%d\n", HAPTIK_FASTMATH);
+	printf("%-10s %10s %10s\n", "cycles", "fm", "libm");
+	printf("%-10s %10.1f %10.1f\n", "sin",	measure([](int i) { return fm::sin(a[i]); }, n),			measure([](int i) { return sinf(a[i]); }, n));
+	printf("%-10s %10.1f %10.1f\n", "cos",	measure([](int i) { return fm::cos(a[i]); }, n),			measure([](int i) { return cosf(a[i]); }, n));
+	printf("%-10s %10.1f %10.1f\n", "atan",	measure([](int i) { return fm::atan(b[i]*a[i]); }, n),		measure([](int i) { return atanf(b[i]*a[i]); }, n));
+	printf("%-10s %10.1f %10.1f\n", "atan2",	measure([](int i) { return fm::atan2(a[i], b[i]-150); }, n),	measure([](int i) { return atan2f(a[i], b[i]-150); }, n));
+	printf("%-10s %10.1f %10.1f\n", "rsqrt",	measure([](int i) { return fm::rsqrt(b[i]); }, n),			measure([](int i) { return 1/sqrtf(b[i]); }, n));
+	printf("%-10s %10.1f %10.1f\n", "sqrt",	measure([](int i) { return fm::sqrt(b[i]); }, n),			measure([](int i) { return sqrtf(b[i]); }, n));
+	
+	static const Delta delta;
+	vec8 X(0.);
+	X(2) = 200;
+	X(0) = 5;	X(3) = 0.05;
+	vec8 q = delta.mgi(X).q;
+	vec8 x0(0.);
+	x0(2) = 200;
+	volatile float sink = 0;
+	unsigned long long start = cycles();
+	for (int k=0; k<n*10; k++)	sink = sink + delta.mgi(X).q(0);
+	printf("%-10s %10.1f\n", "mgi", double(cycles() - start) / (n*10));
+	start = cycles();
+	for (int k=0; k<n; k++)	sink = sink + delta.mgd_solve(q, x0).X(0);
+	printf("%-10s %10.1f\n", "mgd_solve", double(cycles() - start) / n);
+	return 0;
+}
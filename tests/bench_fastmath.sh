@@ -0,0 +1 @@
+for f in 0 1; do g++ -O2 -DHAPTIK_FASTMATH=$f bench_fastmath.cpp ../haptik/model.cpp ../haptik/seeds.cpp -I../haptik -o bench_fastmath && ./bench_fastmath || exit 1; done
@@ -0,0 +1,91 @@
+#include "model.h"
+#include "fixed.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+	static unsigned long long cycles()	{ return __rdtsc(); }
+#else
+	static unsigned long long cycles()	{ return 0; }
+#endif
+
+using namespace la;
+
+typedef BasicDelta<fix12> FixedDelta;
+
+static float uniform(float amplitude) {
+	return (2*float(random())/RAND_MAX - 1) * amplitude;
+}
+static vec8 random_pose() {
+	float X[N] = {uniform(20), uniform(20), 200+uniform(20), uniform(0.1), uniform(0.1), uniform(0.1), uniform(0.05), uniform(0.05)};
+	return vec8(X);
+}
+
+/// cycles moyens par appel de f
+template <class F>
+static double measure(F f, int repeat) {
+	unsigned long long start = cycles();
+	for (int i=0; i<repeat; i++)	f();
+	return double(cycles() - start) / repeat;
+}
+
+int main() {
+	Delta fdelta;
+	FixedDelta xdelta;
+	const int samples = 200;
+	
+	// precision du mgi et de la jacobienne
+	srandom(0);
+	float err_q = 0, err_J = 0;
+	for (int k=0; k<samples; k++) {
+		vec8 X = random_pose();
+		Delta::state fs = fdelta.mgi(X);
+		FixedDelta::state xs = xdelta.mgi(FixedDelta::vec8(X));
+		for (size_t i=0; i<N; i++)	err_q = fmax(err_q, fabs(fs.q(i) - float(xs.q(i))));
+		
+		vec8 dq(0.01);
+		vec8 fdx = fdelta.mci_factor(fs).apply(dq);
+		vec8 xdx = vec8(xdelta.mci_factor(xs).apply(FixedDelta::vec8(dq)));
+		err_J = fmax(err_J, (fdx - xdx).norm() / fdx.norm());
+	}
+	printf("mgi: max error on q  %g rad\n", err_q);
+	printf("mci: max relative error on J*dq  %g\n", err_J);
+	
+	// precision de la resolution complete mgi -> mci -> mgd_solve
+	vec8 x0(0.);
+	x0(2) = 200;
+	float err_X = 0, err_fixq = 0, err_floatq = 0;
+	for (int k=0; k<samples; k++) {
+		vec8 X = random_pose();
+		vec8 q = fdelta.mgi(X).q;
+		Delta::state fs = fdelta.mgd_solve(q, x0);
+		FixedDelta::state xs = xdelta.mgd_solve(FixedDelta::vec8(q), FixedDelta::vec8(x0));
+		err_X = fmax(err_X, (fs.X - vec8(xs.X)).norm());
+		err_fixq = fmax(err_fixq, (vec8(xs.q) - q).norm());
+		err_floatq = fmax(err_floatq, (fs.q - q).norm());
+	}
+	printf("mgd_solve: max distance between float and fixed solutions  %g\n", err_X);
+	printf("mgd_solve: max residual on q  %g rad (float)  %g rad (fixed)\n", err_floatq, err_fixq);
+	
+	// cout de calcul
+	vec8 X = random_pose();
+	vec8 q = fdelta.mgi(X).q;
+	FixedDelta::vec8 xX(X), xq(q), xx0(x0);
+	Delta::state fs = fdelta.mgi(X);
+	FixedDelta::state xs = xdelta.mgi(xX);
+	volatile float sink = 0;
+	printf("%-12s %12s %12s\n", "cycles", "float", "fix12");
+	printf("%-12s %12.0f %12.0f\n", "mgi",
+		measure([&]{ sink = fdelta.mgi(X).q(0); }, 2000),
+		measure([&]{ sink = float(xdelta.mgi(xX).q(0)); }, 2000));
+	printf("%-12s %12.0f %12.0f\n", "mci_factor",
+		measure([&]{ sink = fdelta.mci_factor(fs).Jd(0); }, 2000),
+		measure([&]{ sink = float(xdelta.mci_factor(xs).Jd(0)); }, 2000));
+	printf("%-12s %12.0f %12.0f\n", "mgd_solve",
+		measure([&]{ sink = fdelta.mgd_solve(q, x0).X(0); }, 200),
+		measure([&]{ sink = float(xdelta.mgd_solve(xq, xx0).X(0)); }, 200));
+	
+	return 0;
+}
@@ -0,0 +1 @@
+g++ -O2 bench_fixed.cpp ../haptik/model.cpp ../haptik/seeds.cpp -I../haptik -o bench_fixed && exec ./bench_fixed
@@ -0,0 +1,232 @@
+#include "model.h"
+#include "linalg.h"
+#include "fastmath.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include <vector>
+
+/*
+	mesures de reference de la cinematique, a comparer d'une version a l'autre:
+	mgi, mci, mgd_solve (depuis la table, et en suivi de trajectoire), View::invert, produit 8x8 et quat2mat
+	sur un echantillon fixe de l'espace de travail (generateur propre: le meme echantillon sur toutes les plateformes)
+
+		bench_kinematics [--json] [--quick]
+
+	chaque cas est mesuré runs fois, on garde la mediane et le minimum en ns par operation.
+	--json ecrit un seul objet JSON sur la sortie standard, pour suivre les regressions entre les versions.
+	--quick reduit les repetitions (test de la compilation, les temps ne sont pas significatifs).
+*/
+
+using namespace la;
+
+static const int max_iterations = 8;	// limite de mgd_solve, solve_iterations dans model.cpp
+
+static double now() {
+	timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + 1e-9*t.tv_nsec;
+}
+
+/// generateur congruentiel, independant de la libc
+static uint32_t random_state = 20240101;
+static float uniform(float amplitude) {
+	random_state = random_state * 1664525u + 1013904223u;
+	return (2 * float(random_state >> 8) / float(1u << 24) - 1) * amplitude;
+}
+
+struct Timing {
+	const char *name;
+	size_t ops;			// operations par mesure
+	double median, min;	// ns par operation
+};
+
+/// mesure f() qui fait ops operations, runs fois
+template <class F>
+static Timing measure(const char *name, size_t ops, int runs, F f) {
+	std::vector<double> samples;
+	f();	// chauffe des caches
+	for (int r=0; r<runs; r++) {
+		double start = now();
+		f();
+		samples.push_back((now() - start) * 1e9 / ops);
+	}
+	std::sort(samples.begin(), samples.end());
+	return Timing{name, ops, samples[samples.size()/2], samples[0]};
+}
+
+struct Convergence {
+	const char *name;
+	int histogram[max_iterations+2];	// nombre de resolutions par iterations, la derniere case pour les non convergées
+	size_t count, converged;
+	double mean;
+	float max_residual;
+};
+
+static Convergence convergence(const char *name, const std::vector<Delta::solve_info> &infos) {
+	Convergence c = {name, {}, infos.size(), 0, 0, 0};
+	for (const Delta::solve_info &info : infos) {
+		c.histogram[info.converged ? std::min(info.iterations, max_iterations) : max_iterations+1]++;
+		c.converged += info.converged;
+		c.mean += info.iterations;
+		if (info.converged)		c.max_residual = fmax(c.max_residual, info.residual);
+	}
+	c.mean /= infos.size();
+	return c;
+}
+
+int main(int argc, char **argv) {
+	bool json = false, quick = false;
+	for (int i=1; i<argc; i++) {
+		if 		(!strcmp(argv[i], "--json"))	json = true;
+		else if (!strcmp(argv[i], "--quick"))	quick = true;
+		else {
+			fprintf(stderr, "usage: %s [--json] [--quick]\n", argv[0]);
+			return 2;
+		}
+	}
+	const int runs = quick ? 3 : 15;
+	const size_t samples = quick ? 200 : 2000;
+	static const Delta delta;
+
+	// poses atteignables de l'espace de travail, et une trajectoire de Lissajous parcourue a 1 kHz (jusqu'a 70 mm/s environ)
+	std::vector<vec8> poses, trajectory;
+	std::vector<Delta::state> states;
+	const float range[] = {40, 40, 60, 0.3, 0.3, 0.3, 0.2, 0.2};
+	while (poses.size() < samples) {
+		vec8 X;
+		for (int i=0; i<N; i++)		X(i) = uniform(range[i]);
+		X(2) += 180;
+		Delta::state s = delta.mgi(X);
+		if (s.q.norm() != s.q.norm())	continue;
+		poses.push_back(X);
+		states.push_back(s);
+	}
+	const float amplitude[] = {20, 20, 30, 0.15, 0.15, 0.15, 0.1, 0.1};
+	const float pulsation[] = {2.1, 2.9, 1.3, 1.7, 2.3, 3.1, 2.7, 1.9};	// rad/s
+	std::vector<vec8> trajectory_q;
+	for (size_t k=0; k<samples*10; k++) {
+		vec8 X;
+		for (int i=0; i<N; i++)		X(i) = amplitude[i] * sin(pulsation[i] * k * 1e-3f + i);
+		X(2) += 180;
+		vec8 q = delta.mgi(X).q;
+		if (q.norm() != q.norm())	continue;
+		trajectory.push_back(X);
+		trajectory_q.push_back(q);
+	}
+
+	std::vector<Timing> timings;
+	volatile float sink = 0;
+
+	timings.push_back(measure("mgi", poses.size(), runs, [&] {
+		float s = 0;
+		for (const vec8 &X : poses)		s += delta.mgi(X).q(0);
+		sink = sink + s;
+	}));
+	timings.push_back(measure("mci", states.size(), runs, [&] {
+		float s = 0;
+		for (const Delta::state &st : states)	s += delta.mci(st)(0,0);
+		sink = sink + s;
+	}));
+
+	// mgd_solve depuis la table des poses précalculées (demarrage, grands deplacements)
+	std::vector<Delta::solve_info> seeded(poses.size());
+	timings.push_back(measure("mgd_solve_seed", poses.size(), runs, [&] {
+		float s = 0;
+		for (size_t k=0; k<states.size(); k++)	s += delta.mgd_solve(states[k].q, &seeded[k]).X(0);
+		sink = sink + s;
+	}));
+	// mgd_solve depuis la pose du tick precedent, comme dans la boucle de controle
+	std::vector<Delta::solve_info> tracking(trajectory.size());
+	timings.push_back(measure("mgd_solve_tracking", trajectory.size(), runs, [&] {
+		vec8 X = trajectory[0];
+		for (size_t k=0; k<trajectory.size(); k++)	X = delta.mgd_solve(trajectory_q[k], X, &tracking[k]).X;
+		sink = sink + X(0);
+	}));
+
+	// inversion de matrices de l'espace de travail: les mci de l'echantillon
+	std::vector<mat8> jacobians, products(states.size());
+	for (const Delta::state &st : states)	jacobians.push_back(delta.mci(st));
+	int singular = 0;
+	timings.push_back(measure("view_invert_8x8", jacobians.size(), runs, [&] {
+		singular = 0;
+		for (size_t k=0; k<jacobians.size(); k++) {
+			products[k] = jacobians[k];
+			int err;
+			View<float>(products[k].storage, N, N).invert(&err);
+			singular += err != 0;
+		}
+		sink = sink + products[0](0,0);
+	}));
+	float inverse_error = 0;
+	for (size_t k=0; k<jacobians.size(); k++) {
+		mat8 P = jacobians[k] * products[k];
+		for (int i=0; i<N; i++)
+			for (int j=0; j<N; j++)		inverse_error = fmax(inverse_error, fabs(P(i,j) - (i==j)));
+	}
+	timings.push_back(measure("matmul_8x8", jacobians.size(), runs, [&] {
+		for (size_t k=0; k+1<jacobians.size(); k++)		products[k] = jacobians[k] * jacobians[k+1];
+		products.back() = jacobians.back() * jacobians[0];
+		sink = sink + products[0](0,0);
+	}));
+	std::vector<vec4> quaternions;
+	for (const vec8 &X : poses)		quaternions.push_back(vec2quat(vec3(X.segment<3>(3))));
+	timings.push_back(measure("quat2mat", quaternions.size(), runs, [&] {
+		float s = 0;
+		for (const vec4 &q : quaternions)	s += quat2mat(q)(0,1);
+		sink = sink + s;
+	}));
+
+	// precision des resolutions, en plus de leur cout
+	float seed_error = 0, tracking_error = 0;
+	for (size_t k=0; k<states.size(); k++) {
+		Delta::solve_info info;
+		vec8 X = delta.mgd_solve(states[k].q, &info).X;
+		if (info.converged)		seed_error = fmax(seed_error, (X.segment<3>(0) - poses[k].segment<3>(0)).norm());
+	}
+	vec8 X = trajectory[0];
+	for (size_t k=0; k<trajectory.size(); k++) {
+		Delta::solve_info info;
+		X = delta.mgd_solve(trajectory_q[k], X, &info).X;
+		if (info.converged)		tracking_error = fmax(tracking_error, (X.segment<3>(0) - trajectory[k].segment<3>(0)).norm());
+	}
+	Convergence solves[] = {convergence("mgd_solve_seed", seeded), convergence("mgd_solve_tracking", tracking)};
+	float position_error[] = {seed_error, tracking_error};
+
+	if (json) {
+		printf("{\n  \"benchmark\": \"kinematics\",\n  \"format\": 1,\n");
+		printf("  \"config\": {\"compiler\": \"%s\", \"fastmath\": %d, \"la_unroll\": %d, \"samples\": %zu, \"trajectory\": %zu, \"runs\": %d, \"quick\": %s},\n",
+			__VERSION__, HAPTIK_FASTMATH, LA_UNROLL, poses.size(), trajectory.size(), runs, quick ? "true" : "false");
+		printf("  \"timings\": [\n");
+		for (size_t i=0; i<timings.size(); i++)
+			printf("    {\"name\": \"%s\", \"ops\": %zu, \"ns_per_op\": %.2f, \"ns_per_op_min\": %.2f}%s\n",
+				timings[i].name, timings[i].ops, timings[i].median, timings[i].min, i+1 < timings.size() ? "," : "");
+		printf("  ],\n  \"solvers\": [\n");
+		for (size_t i=0; i<2; i++) {
+			const Convergence &c = solves[i];
+			printf("    {\"name\": \"%s\", \"count\": %zu, \"converged_rate\": %.6f, \"mean_iterations\": %.4f, \"max_residual\": %g, \"max_position_error_mm\": %g, \"iterations\": {",
+				c.name, c.count, double(c.converged) / c.count, c.mean, c.max_residual, position_error[i]);
+			for (int n=1; n<=max_iterations; n++)	printf("\"%d\": %d, ", n, c.histogram[n]);
+			printf("\"failed\": %d}}%s\n", c.histogram[max_iterations+1], i ? "" : ",");
+		}
+		printf("  ],\n  \"view_invert\": {\"singular\": %d, \"max_error\": %g}\n}\n", singular, inverse_error);
+	}
+	else {
+		printf("HAPTIK_FASTMATH=%d LA_UNROLL=%d, %zu poses, %zu trajectory points, median of %d runs\n",
+			HAPTIK_FASTMATH, LA_UNROLL, poses.size(), trajectory.size(), runs);
+		printf("  %-20s %12s %12s\n", "case", "ns/op", "min ns/op");
+		for (const Timing &t : timings)		printf("  %-20s %12.1f %12.1f\n", t.name, t.median, t.min);
+		for (size_t i=0; i<2; i++) {
+			const Convergence &c = solves[i];
+			printf("%s: %.2f%% converged, mean %.2f iterations, max residual %g, max position error %g mm (converged)\n  iterations",
+				c.name, 100. * c.converged / c.count, c.mean, c.max_residual, position_error[i]);
+			for (int n=1; n<=max_iterations; n++)	printf(" %d:%d", n, c.histogram[n]);
+			printf("  failed:%d\n", c.histogram[max_iterations+1]);
+		}
+		printf("view_invert: %d singular, max error of J * J^-1 from identity %g\n", singular, inverse_error);
+	}
+	return singular ? 1 : 0;
+}
@@ -0,0 +1 @@
+g++ -O2 bench_kinematics.cpp ../haptik/model.cpp ../haptik/seeds.cpp -I../haptik -o bench_kinematics && ./bench_kinematics && exec ./bench_kinematics --json --quick
@@ -0,0 +1,77 @@
+#include "model.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#if defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+	static unsigned long long cycles()	{ return __rdtsc(); }
+#else
+	static unsigned long long cycles()	{ return 0; }
+#endif
+
+/*
+	noyaux de taille fixe de linalg.h, deroulés ou non selon LA_UNROLL (voir bench_unroll.sh qui compile les deux versions)
+*/
+
+using namespace la;
+
+static float uniform(float amplitude) {
+	return (2*float(random())/RAND_MAX - 1) * amplitude;
+}
+template <class S, size_t rows, size_t cols>
+static void randomize(Matrix<S,rows,cols> &m) {
+	for (size_t i=0; i<rows; i++)
+		for (size_t j=0; j<cols; j++)	m(i,j) = uniform(1);
+}
+template <class S, size_t dim>
+static void randomize(Vector<S,dim> &v) {
+	for (size_t i=0; i<dim; i++)	v(i) = uniform(1);
+}
+
+/// cycles moyens par appel de f
+template <class F>
+static double measure(F f, int repeat) {
+	unsigned long long start = cycles();
+	for (int i=0; i<repeat; i++)	f();
+	return double(cycles() - start) / repeat;
+}
+
+/// barriere: le compilateur doit supposer que x a changé (operandes) ou est lu en entier (resultats)
+template <class T>
+static const T & load(const T &x)	{ asm volatile("" : : "r"(&x) : "memory"); return x; }
+#define KEEP(expr)	[&]{ auto r = expr; load(r); }
+
+int main() {
+	static const Delta delta;
+	mat3 m3; vec3 v3, w3;
+	mat4 m4, n4; vec4 v4;
+	mat8 m8, n8; vec8 v8;
+	randomize(m3); randomize(v3); randomize(w3);
+	randomize(m4); randomize(n4); randomize(v4);
+	randomize(m8); randomize(n8); randomize(v8);
+	vec8 X(0.);
+	X(2) = 200;
+	X(0) = 5;	X(3) = 0.05;
+	Delta::state s = delta.mgi(X);
+	vec8 q = s.q;
+	vec8 x0(0.);
+	x0(2) = 200;
+	
+	volatile float sink = 0;
+	const int n = 100000;
+	printf("LA_UNROLL=%d\n", LA_UNROLL);
+	printf("%-14s %10.1f\n", "mat3 * vec3",		measure(KEEP(load(m3) * load(v3)), n));
+	printf("%-14s %10.1f\n", "cross3",			measure(KEEP(cross(load(v3), load(w3))), n));
+	printf("%-14s %10.1f\n", "mat4 * vec4",		measure(KEEP(load(m4) * load(v4)), n));
+	printf("%-14s %10.1f\n", "mat4 * mat4",		measure(KEEP(load(m4) * load(n4)), n));
+	printf("%-14s %10.1f\n", "mat4^T",			measure(KEEP(load(m4).transpose()), n));
+	printf("%-14s %10.1f\n", "mat8 * vec8",		measure(KEEP(load(m8) * load(v8)), n));
+	printf("%-14s %10.1f\n", "mat8 * mat8",		measure(KEEP(load(m8) * load(n8)), n));
+	printf("%-14s %10.1f\n", "mat8^T",			measure(KEEP(load(m8).transpose()), n));
+	printf("%-14s %10.1f\n", "dot8",			measure([&]{ sink = dot(load(v8), load(v8)); }, n));
+	printf("%-14s %10.1f\n", "mgi",				measure([&]{ sink = delta.mgi(load(X)).q(0); }, n/10));
+	printf("%-14s %10.1f\n", "mci_factor",		measure([&]{ sink = delta.mci_factor(s).Jd(0); }, n/10));
+	printf("%-14s %10.1f\n", "mgd_solve",		measure([&]{ sink = delta.mgd_solve(load(q), x0).X(0); }, n/100));
+	printf("%-14s %10.1f\n", "Delta()",			measure([&]{ Delta d; sink = d.b[3](1); }, n));
+	return 0;
+}
@@ -0,0 +1 @@
+for u in 0 16 64; do g++ -O2 -DLA_UNROLL=$u -c ../haptik/model.cpp -I../haptik -o model_unroll$u.o && size model_unroll$u.o && g++ -O2 -DLA_UNROLL=$u bench_unroll.cpp model_unroll$u.o ../haptik/seeds.cpp -I../haptik -o bench_unroll$u && ./bench_unroll$u || exit 1; rm -f model_unroll$u.o bench_unroll$u; done
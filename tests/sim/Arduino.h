@@ -0,0 +1,70 @@
+#ifndef _SIM_ARDUINO_H
+#define _SIM_ARDUINO_H
+
+/*
+	remplaçant de l'API Arduino pour executer le code de la carte sur l'hote
+	
+	le temps est simulé: il n'avance que par delay(), par les transferts du bus simulé, ou quand le test appelle sim_advance().
+	a chaque avancée, sim_step est appelé avec le nouvel instant: c'est la que le simulateur fait evoluer le robot (voir hil.h).
+	le port serie garde ce que la carte envoie, et lui donne ce que le test a mis dans sa file de reception.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <math.h>
+#include <deque>
+#include <vector>
+
+inline unsigned long sim_micros = 0;
+inline void (*sim_step)(unsigned long now) = nullptr;
+inline void sim_advance(unsigned long us) {
+	sim_micros += us;
+	if (sim_step)	sim_step(sim_micros);
+}
+
+inline void delay(unsigned long ms)	{ sim_advance(ms*1000); }
+inline unsigned long micros()		{ return sim_micros; }
+inline unsigned long millis()		{ return sim_micros / 1000; }
+
+struct SimSerial {
+	std::deque<uint8_t> rx;		// octets a lire par la carte
+	std::vector<uint8_t> tx;	// octets ecrits par la carte
+	
+	void begin(long) {}
+	int available()		{ return rx.size(); }
+	int availableForWrite()	{ return 64; }	// tampon d'emission d'une carte, toujours vide: l'envoi est instantané
+	int read() {
+		if (rx.empty())		return -1;
+		uint8_t byte = rx.front();
+		rx.pop_front();
+		return byte;
+	}
+	size_t write(const uint8_t *data, size_t n)	{ tx.insert(tx.end(), data, data+n);	return n; }
+	size_t write(uint8_t byte)					{ tx.push_back(byte);	return 1; }
+	
+	// memes formats que Print
+	void print(const char *text)	{ while (*text)		write(*text++); }
+	void print(char c)				{ write(uint8_t(c)); }
+	void print(long v)				{ format("%ld", v); }
+	void print(unsigned long v)		{ format("%lu", v); }
+	void print(int v)				{ print(long(v)); }
+	void print(unsigned v)			{ print((unsigned long) v); }
+	void print(double v)			{ format("%.2f", v); }
+	template <class T>
+	void println(T v)				{ print(v);	print("\r\n"); }
+	
+	/// ajoute des octets a lire par la carte
+	void inject(const uint8_t *data, size_t n)	{ rx.insert(rx.end(), data, data+n); }
+	
+private:
+	template <class T>
+	void format(const char *f, T v) {
+		char text[32];
+		snprintf(text, sizeof(text), f, v);
+		print((const char *) text);
+	}
+};
+inline SimSerial Serial;
+
+#endif
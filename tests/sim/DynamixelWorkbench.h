@@ -0,0 +1,157 @@
+#ifndef _SIM_DYNAMIXELWORKBENCH_H
+#define _SIM_DYNAMIXELWORKBENCH_H
+
+/*
+	bus Dynamixel simulé sur l'hote, avec la meme interface que la bibliotheque DynamixelWorkbench utilisée par HaptikDXL
+	chaque moteur est une table de registres, les transferts comptent les paquets et les octets qu'ils feraient passer sur le bus (protocole 2.0).
+	chaque paquet fait avancer l'horloge simulée de sa durée de transmission, plus return_delay pour les paquets de retour.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "Arduino.h"	// comme la vraie bibliotheque
+
+class DynamixelWorkbench {
+public:
+	static const uint8_t MOTORS = 8;			// moteurs presents sur le bus, identifiants 0 a MOTORS-1
+	static const uint8_t MAX_HANDLERS = 4;
+	static const uint8_t BROADCAST_ID = 0xFE;
+
+	/// table de registres de chaque moteur
+	uint8_t control_table[MOTORS][256];
+
+	/// trafic sur le bus depuis le dernier reset_counters()
+	struct Counters {
+		unsigned long instructions;	// paquets envoyés par la carte
+		unsigned long statuses;		// paquets de retour des moteurs
+		unsigned long bytes_sent;
+		unsigned long bytes_received;
+	} counters;
+	
+	uint32_t return_delay;		// µs entre une instruction et le retour du moteur, commun au bus: le dernier ecrit dans le registre RETURN_DELAY_TIME
+
+	DynamixelWorkbench() : return_delay(0), baudrate(1000000), write_handlers(0), read_handlers(0) {
+		memset(control_table, 0, sizeof(control_table));
+		reset_counters();
+	}
+	void reset_counters()	{ memset(&counters, 0, sizeof(counters)); }
+	/// duree de transmission du trafic compté, en µs (10 bits par octet, sans le delai de retour des moteurs)
+	float bus_time() const	{ return transmission(counters.bytes_sent + counters.bytes_received); }
+
+	uint32_t baud() const	{ return baudrate; }
+
+	bool begin(const char *, uint32_t baud) {
+		baudrate = baud;
+		return true;
+	}
+	bool ping(uint8_t id, uint16_t *model_number = NULL, const char **log = NULL) {
+		instruction(0);
+		if (id >= MOTORS)	return false;
+		status(3);
+		if (model_number)	*model_number = 1060;
+		return true;
+	}
+
+	bool readRegister(uint8_t id, uint16_t address, uint16_t length, uint32_t *data, const char **log = NULL) {
+		instruction(4);
+		if (!valid(id, address, length) || length > 4)	return false;
+		status(length);
+		*data = get(id, address, length);
+		return true;
+	}
+	bool writeRegister(uint8_t id, uint16_t address, uint16_t length, uint8_t *data, const char **log = NULL) {
+		instruction(4 + length);
+		if (!valid(id, address, length))	return false;
+		status(0);
+		memcpy(&control_table[id][address], data, length);
+		if (address <= RETURN_DELAY_ADDRESS && RETURN_DELAY_ADDRESS < address + length)
+			return_delay = 2 * control_table[id][RETURN_DELAY_ADDRESS];
+		return true;
+	}
+
+	/*
+		operations groupées, les handlers sont numérotés dans leur ordre de creation
+	*/
+	bool addSyncWriteHandler(uint16_t address, uint16_t length, const char **log = NULL) {
+		if (write_handlers >= MAX_HANDLERS)	return false;
+		write_handler[write_handlers++] = Handler{address, length};
+		return true;
+	}
+	bool addSyncReadHandler(uint16_t address, uint16_t length, const char **log = NULL) {
+		if (read_handlers >= MAX_HANDLERS)	return false;
+		read_handler[read_handlers++] = Handler{address, length};
+		return true;
+	}
+
+	/// un seul paquet en broadcast, sans retour des moteurs
+	bool syncWrite(uint8_t index, uint8_t *id, uint8_t id_num, int32_t *data, uint8_t data_num_for_each_id, const char **log = NULL) {
+		if (index >= write_handlers)	return false;
+		const Handler &h = write_handler[index];
+		instruction(4 + id_num*(1 + h.length));
+		for (uint8_t i=0; i<id_num; i++) {
+			if (!valid(id[i], h.address, h.length))	continue;
+			uint32_t value = data[i*data_num_for_each_id];
+			memcpy(&control_table[id[i]][h.address], &value, h.length);
+		}
+		return true;
+	}
+	/// un paquet en broadcast, puis un retour par moteur
+	bool syncRead(uint8_t index, uint8_t *id, uint8_t id_num, const char **log = NULL) {
+		if (index >= read_handlers)	return false;
+		const Handler &h = read_handler[index];
+		instruction(4 + id_num);
+		for (uint8_t i=0; i<id_num; i++) {
+			if (!valid(id[i], h.address, h.length))	return false;
+			status(h.length);
+		}
+		return true;
+	}
+	/// extrait une valeur du dernier syncRead (les registres simulés ne changent pas entre temps)
+	bool getSyncReadData(uint8_t index, uint8_t *id, uint8_t id_num, uint16_t address, uint16_t length, int32_t *data, const char **log = NULL) {
+		if (index >= read_handlers)	return false;
+		const Handler &h = read_handler[index];
+		if (address < h.address || address + length > h.address + h.length || length > 4)	return false;
+		for (uint8_t i=0; i<id_num; i++) {
+			if (!valid(id[i], address, length))	return false;
+			data[i] = get(id[i], address, length);
+		}
+		return true;
+	}
+
+private:
+	static const uint16_t RETURN_DELAY_ADDRESS = 9;		// registre RETURN_DELAY_TIME, par pas de 2 µs
+	
+	struct Handler {
+		uint16_t address;
+		uint16_t length;
+	};
+	uint32_t baudrate;
+	Handler write_handler[MAX_HANDLERS];
+	Handler read_handler[MAX_HANDLERS];
+	uint8_t write_handlers;
+	uint8_t read_handlers;
+
+	static bool valid(uint8_t id, uint16_t address, uint16_t length)	{ return id < MOTORS && address + length <= 256; }
+	/// valeur little-endian sur 4 octets au plus non signée, comme la bibliotheque
+	uint32_t get(uint8_t id, uint16_t address, uint16_t length) const {
+		uint32_t value = 0;
+		memcpy(&value, &control_table[id][address], length);
+		return value;
+	}
+	float transmission(unsigned long bytes) const	{ return bytes * 10 * 1e6f / baudrate; }
+	/// paquet d'instruction: entete(4) id(1) longueur(2) instruction(1) parametres crc(2)
+	void instruction(size_t params) {
+		counters.instructions++;
+		counters.bytes_sent += 10 + params;
+		sim_advance(transmission(10 + params));
+	}
+	/// paquet de retour: comme une instruction avec un octet d'erreur en plus
+	void status(size_t params) {
+		counters.statuses++;
+		counters.bytes_received += 11 + params;
+		sim_advance(return_delay + transmission(11 + params));
+	}
+};
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef _SIM_FAKETRANSPORT_H
+#define _SIM_FAKETRANSPORT_H
+
+/*
+	transport non bloquant (dxlbus.h) sur le bus simulé: les moteurs sont les tables de registres de DynamixelWorkbench
+
+	les octets écrits sont mis en file sur le bus a son debit, sans faire avancer l'horloge simulée: la carte continue
+	pendant qu'ils passent. une instruction est executée quand son dernier octet est passé, et chacun de ses retours
+	n'est lisible qu'une fois passé a son tour, apres le delai de retour du moteur (return_delay du bus).
+	latency s'ajoute avant le premier retour de chaque instruction (adaptateur USB, tampon du pilote...).
+
+	l'instruction est executée au premier appel de read() ou write() qui suit sa fin: les registres lus sont ceux de cet instant.
+	les compteurs du bus comptent aussi ces echanges.
+*/
+
+#include "DynamixelWorkbench.h"
+#include "dxlbus.h"
+#include <deque>
+#include <vector>
+
+class FakeTransport : public dxlbus::Transport {
+public:
+	FakeTransport(DynamixelWorkbench &bus) : latency(0), corrupt(0), bus(bus), free(0) {}
+
+	uint32_t latency;		// µs avant le premier retour de chaque instruction
+	unsigned long corrupt;	// retours a corrompre (un octet inversé), en commençant par le prochain
+
+	size_t write(const uint8_t *data, size_t size) override {
+		update();
+		for (size_t i=0; i<size; i++) {
+			free = fmax(free, double(sim_micros)) + byte_time();
+			if (parser.push(data[i]))	schedule();
+		}
+		return size;
+	}
+	int read() override {
+		update();
+		if (received.empty() || int32_t(sim_micros - received.front().time) < 0)	return -1;
+		uint8_t byte = received.front().byte;
+		received.pop_front();
+		return byte;
+	}
+
+	/// instant ou le bus sera libre, en µs simulées
+	double busy_until() const	{ return free; }
+
+private:
+	struct Instruction {
+		double end;			// fin de l'instruction sur le bus
+		double status[DynamixelWorkbench::MOTORS];		// fin de chaque retour, dans l'ordre des moteurs qui repondent
+		uint8_t id, instruction;
+		std::vector<uint8_t> params;
+	};
+	struct Byte {
+		unsigned long time;
+		uint8_t byte;
+	};
+
+	DynamixelWorkbench &bus;
+	dxlbus::Parser parser;
+	double free;			// fin du dernier paquet prevu sur le bus
+	std::deque<Instruction> instructions;
+	std::deque<Byte> received;
+
+	double byte_time() const	{ return 10 * 1e6 / bus.baud(); }
+	static bool present(uint8_t id)	{ return id < DynamixelWorkbench::MOTORS; }
+	static uint16_t word(const uint8_t *p)	{ return p[0] | uint16_t(p[1]) << 8; }
+	static bool fits(uint16_t address, size_t length)	{ return address + length <= 256 && length < dxlbus::max_params; }
+
+	/// moteurs qui repondront a l'instruction qui vient d'etre reconnue, et longueur de leurs retours
+	void responders(std::vector<uint8_t> &ids, uint16_t &length) const {
+		const uint8_t *p = parser.params;
+		length = 0;
+		switch (parser.instruction) {
+			case dxlbus::READ:
+				if (parser.size == 4)	length = word(p+2);
+				// fall through
+			case dxlbus::WRITE:
+				if (present(parser.id))		ids.push_back(parser.id);
+				break;
+			case dxlbus::SYNC_READ:
+				length = word(p+2);
+				for (size_t i=4; i<parser.size; i++)
+					if (present(p[i]))	ids.push_back(p[i]);
+				break;
+		}
+	}
+	/// une instruction complete vient de passer: ses retours occupent le bus a la suite
+	void schedule() {
+		Instruction ins;
+		ins.end = free;
+		ins.id = parser.id;
+		ins.instruction = parser.instruction;
+		ins.params.assign(parser.params, parser.params + parser.size);
+		std::vector<uint8_t> ids;
+		uint16_t length;
+		responders(ids, length);
+		double t = free + (ids.empty() ? 0 : latency);
+		for (size_t i=0; i<ids.size(); i++) {
+			t += bus.return_delay + (11 + length) * byte_time();
+			ins.status[i] = t;
+		}
+		free = t;
+		instructions.push_back(ins);
+		bus.counters.instructions++;
+		bus.counters.bytes_sent += 10 + parser.size;
+	}
+	/// execute les instructions passées: ecritures dans les tables, retours en file de reception
+	void update() {
+		while (!instructions.empty() && instructions.front().end <= sim_micros) {
+			Instruction &ins = instructions.front();
+			const uint8_t *p = ins.params.data();
+			switch (ins.instruction) {
+				case dxlbus::WRITE:
+					if (present(ins.id) && ins.params.size() >= 2 && fits(word(p), ins.params.size() - 2)) {
+						memcpy(&bus.control_table[ins.id][word(p)], p+2, ins.params.size() - 2);
+						reply(ins.id, nullptr, 0, ins.status[0]);
+					}
+					break;
+				case dxlbus::READ:
+					if (present(ins.id) && fits(word(p), word(p+2)))	reply(ins.id, &bus.control_table[ins.id][word(p)], word(p+2), ins.status[0]);
+					break;
+				case dxlbus::SYNC_READ: {
+					size_t n = 0;
+					if (!fits(word(p), word(p+2)))	break;
+					for (size_t i=4; i<ins.params.size(); i++)
+						if (present(p[i]))	reply(p[i], &bus.control_table[p[i]][word(p)], word(p+2), ins.status[n++]);
+					break;
+				}
+				case dxlbus::SYNC_WRITE: {
+					uint16_t length = word(p+2);
+					if (!fits(word(p), length))	break;
+					for (size_t i=4; i + 1 + length <= ins.params.size(); i += 1 + length)
+						if (present(p[i]))	memcpy(&bus.control_table[p[i]][word(p)], &p[i+1], length);
+					break;
+				}
+			}
+			instructions.pop_front();
+		}
+	}
+	/// paquet de retour d'un moteur, lisible en entier a l'instant end
+	void reply(uint8_t id, const uint8_t *data, uint16_t length, double end) {
+		uint8_t params[dxlbus::max_params];
+		params[0] = 0;
+		if (length)		memcpy(params+1, data, length);
+		uint8_t packet[dxlbus::max_packet];
+		size_t size = dxlbus::packet(packet, id, dxlbus::STATUS, params, 1 + length);
+		if (corrupt) {
+			packet[size/2] ^= 0xFF;
+			corrupt--;
+		}
+		for (size_t i=0; i<size; i++)	received.push_back(Byte{(unsigned long) ceil(end), packet[i]});
+		bus.counters.statuses++;
+		bus.counters.bytes_received += 11 + length;
+	}
+};
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef _SIM_HIL_H
+#define _SIM_HIL_H
+
+/*
+	simulateur matériel: relie la dynamique du robot (plant.h) aux tables de registres du bus simulé
+	a chaque avancée de l'horloge simulée, le robot avance par pas fixes jusqu'au nouvel instant,
+	avec les courants demandés dans les registres, et les registres de mesure sont mis a jour.
+	
+	les moteurs se comportent comme des Dynamixel X: mode courant ou position (asservissement proportionnel), couple activé ou non.
+*/
+
+#include "DynamixelWorkbench.h"
+#include "haptlib.h"
+#include "plant.h"
+#include <string.h>
+
+class Hil {
+public:
+	// registres et unités des Dynamixel X
+	enum { MODE = 11, ENABLE = 64, GOAL_CURRENT = 102, GOAL_POSITION = 116, PRESENT_CURRENT = 126, PRESENT_VELOCITY = 128, PRESENT_POSITION = 132 };
+	static constexpr float unit_angle = HaptikDXL::UNIT_ANGLE;	// rad, la meme echelle que le croquis
+	static constexpr float unit_velocity = 0.229 * 2*M_PI/60;	// rad/s
+	static constexpr float unit_current = 2.69;				// mA
+	static constexpr float current_limit = 3200;				// mA
+	static constexpr float position_gain = 5000;				// mA/rad en mode position
+	
+	/// dt: pas d'integration en µs
+	Hil(DynamixelWorkbench &bus, Plant &plant, unsigned long dt = 100)
+		: bus(bus), plant(plant), dt(dt), time(sim_micros) {
+		publish();
+	}
+	/// fait suivre l'horloge simulée par ce simulateur
+	void attach() {
+		instance = this;
+		time = sim_micros;
+		sim_step = [](unsigned long now) { instance->update(now); };
+	}
+	void detach()	{ sim_step = nullptr; }
+	
+	void update(unsigned long now) {
+		while (int32_t(now - (time + dt)) >= 0) {
+			drive();
+			plant.step(dt * 1e-6f);
+			publish();
+			time += dt;
+		}
+	}
+	
+	DynamixelWorkbench &bus;
+	Plant &plant;
+	
+private:
+	unsigned long dt;
+	unsigned long time;
+	static inline Hil *instance = nullptr;
+	
+	template <class T>
+	T get(size_t i, size_t address) const {
+		T v;
+		memcpy(&v, &bus.control_table[i][address], sizeof(T));
+		return v;
+	}
+	template <class T>
+	void set(size_t i, size_t address, T v) {
+		memcpy(&bus.control_table[i][address], &v, sizeof(T));
+	}
+	
+	/// courants moteurs d'apres les registres de consigne
+	void drive() {
+		for (size_t i=0; i<N; i++) {
+			float current = 0;
+			if (get<uint8_t>(i, ENABLE)) {
+				if (get<uint8_t>(i, MODE) == 3)
+					current = position_gain * (get<int32_t>(i, GOAL_POSITION) * unit_angle - plant.q(i));
+				else if (get<uint8_t>(i, MODE) == 0)
+					current = get<int16_t>(i, GOAL_CURRENT) * unit_current;
+			}
+			plant.current(i) = fmax(-current_limit, fmin(current_limit, current));
+		}
+	}
+	/// registres de mesure d'apres l'etat du robot
+	void publish() {
+		for (size_t i=0; i<N; i++) {
+			set<int32_t>(i, PRESENT_POSITION, lround(plant.q(i) / unit_angle));
+			set<int32_t>(i, PRESENT_VELOCITY, lround(plant.dq(i) / unit_velocity));
+			set<int16_t>(i, PRESENT_CURRENT, lround(plant.current(i) / unit_current));
+		}
+	}
+};
+
+#endif
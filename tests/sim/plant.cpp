@@ -0,0 +1,55 @@
+#include "plant.h"
+#include <math.h>
+using namespace la;
+
+Plant::Plant(const Params &params) : params(params) {
+	// au repos, tous les angles moteurs sont nuls
+	vec8 X(0.);
+	X(2) = 150;
+	reset(X);
+}
+
+void Plant::reset(const vec8 &X) {
+	this->X = X;
+	V = vec8(0.);
+	dq = vec8(0.);
+	current = vec8(0.);
+	external = vec8(0.);
+	q = model.mgi(X).q;
+	stuck = false;
+}
+
+void Plant::step(float dt) {
+	if (stuck)	return;
+	mat8 J;
+	q = model.mgi(X, J).q;
+	dq = J * V;
+	
+	vec8 torque = params.torque_constant * current - params.friction * dq;
+	// frottement sec lissé sur quelques mrad/s pour rester stable avec un pas explicite
+	for (size_t i=0; i<N; i++)	torque(i) -= params.stiction * tanh(dq(i) / 0.01f);
+	vec8 F = J.transpose() * torque + external;
+	F(2) -= params.mass * params.gravity;
+	
+	mat8 M = params.motor_inertia * (J.transpose() * J);
+	for (size_t i=0; i<3; i++)	M(i,i) += params.mass;
+	for (size_t i=3; i<6; i++)	M(i,i) += params.inertia;
+	for (size_t i=6; i<8; i++)	M(i,i) += params.sub_inertia;
+	
+	LU<float,N> lu;
+	lu.factorize(M);
+	vec8 A = lu.solve(F);
+	
+	// Euler semi-implicite
+	vec8 V1 = V + dt * A;
+	vec8 X1 = X + dt * V1;
+	vec8 q1 = model.mgi(X1).q;
+	for (size_t i=0; i<N; i++)
+		if (!isfinite(X1(i)) || !isfinite(q1(i))) {
+			stuck = true;
+			V = vec8(0.);
+			return;
+		}
+	V = V1;
+	X = X1;
+}
@@ -0,0 +1,50 @@
+#ifndef _SIM_PLANT_H
+#define _SIM_PLANT_H
+
+/*
+	dynamique du robot pour la simulation
+	l'etat est la pose X et sa vitesse; les angles moteurs en sont deduits par le mgi, avec la jacobienne exacte dq/dX (nombres duaux).
+	la plateforme et les sous-plateformes sont des corps rigides, les tringles et leviers sont sans masse,
+	chaque moteur est une inertie ramenée a l'axe avec un frottement visqueux, entrainée par son courant.
+	
+		M(X) Ẍ = J^T (Kt i - b q̇) + F,		M = Mp + J^T Im J,		J = dq/dX
+	
+	unités: mm, rad, kg, s (forces en mN, couples en mN.mm), courants en mA
+*/
+
+#include "model.h"
+
+class Plant {
+public:
+	struct Params {
+		float mass;				// plateforme (kg)
+		float inertia;			// plateforme, autour de chaque axe (kg.mm²)
+		float sub_inertia;		// sous-plateformes (kg.mm²)
+		float motor_inertia;	// rotor ramené a la sortie du reducteur (kg.mm²)
+		float friction;			// frottement visqueux d'un moteur (mN.mm.s/rad)
+		float stiction;			// frottement sec du reducteur (mN.mm)
+		float torque_constant;	// mN.mm/mA
+		float gravity;			// mm/s², sur -z
+	};
+	/// valeurs pour des XM430-W350 et une plateforme imprimée, sans pesanteur (le croquis ne la compense pas)
+	static Params default_params() {
+		return Params{0.3, 500, 100, 11000, 0.85e6, 3e5, 1780, 0};
+	}
+	
+	Plant(const Params &params = default_params());
+	
+	/// place le robot a l'arret dans la pose X
+	void reset(const vec8 &X);
+	/// avance de dt secondes avec les courants moteurs actuels
+	void step(float dt);
+	
+	Params params;
+	Delta model;
+	vec8 X, V;			// pose et vitesse
+	vec8 q, dq;			// angles et vitesses moteurs
+	vec8 current;		// courant de chaque moteur (mA)
+	vec8 external;		// effort appliqué par l'utilisateur sur X (mN, mN.mm)
+	bool stuck;			// la pose est sortie de l'espace de travail, le robot est arreté
+};
+
+#endif
@@ -0,0 +1,237 @@
+#include "client.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include <thread>
+#include <chrono>
+#include <vector>
+
+/*
+	bibliotheque cliente contre des cartes simulées sur des pseudo-terminaux
+	chaque carte simulée envoie une pose a chaque communication, lit les commandes recues depuis la precedente et repond aux PING,
+	comme la tache communicate() de la carte.
+*/
+
+using namespace client;
+
+/// carte simulée sur le coté maitre d'un pseudo-terminal, dont le coté esclave est ouvert par Device
+class Standin {
+public:
+	Standin(int id, uint32_t period) : id(id), period(period), stop(false), sent(0), forces(0), out_of_order(0) {
+		master = posix_openpt(O_RDWR | O_NOCTTY);
+		if (master < 0 || grantpt(master) || unlockpt(master)) {
+			master = -1;
+			return;
+		}
+		// le coté esclave en mode brut des maintenant: rien ne doit etre interprété avant que Device ne l'ouvre
+		int slave = ::open(ptsname(master), O_RDWR | O_NOCTTY);
+		termios t;
+		tcgetattr(slave, &t);
+		cfmakeraw(&t);
+		tcsetattr(slave, TCSANOW, &t);
+		::close(slave);
+		fcntl(master, F_SETFL, O_NONBLOCK);
+		thread = std::thread(&Standin::run, this);
+	}
+	~Standin()	{ close(); }
+	void close() {
+		if (master < 0)		return;
+		stop = true;
+		thread.join();
+		::close(master);
+		master = -1;
+	}
+	const char * path() const	{ return master < 0 ? nullptr : ptsname(master); }
+
+	const int id;
+	const uint32_t period;		// µs entre deux communications
+	std::atomic<bool> stop;
+	unsigned long sent;			// poses envoyées
+	unsigned long forces;		// commandes FORCE recues
+	unsigned long out_of_order;	// commandes FORCE recues hors de l'ordre d'envoi
+
+private:
+	void write_all(const uint8_t *data, size_t size) {
+		for (size_t done=0; done < size && !stop; ) {
+			ssize_t n = write(master, data+done, size-done);
+			if (n > 0)	done += n;
+		}
+	}
+	void run() {
+		proto::Encoder encoder;
+		proto::Decoder decoder;
+		proto::Message message;
+		uint8_t frame[proto::max_frame];
+		uint8_t buffer[4096];
+		auto tick = std::chrono::steady_clock::now();
+		for (unsigned long k=0; !stop; k++) {
+			tick += std::chrono::microseconds(period);
+			std::this_thread::sleep_until(tick);
+			message.type = proto::POSE;
+			message.timestamp = uint32_t(now_us());
+			message.vec[0] = k;
+			message.vec[1] = id;
+			for (int i=2; i<8; i++)		message.vec[i] = 0.1 * i;
+			write_all(frame, encoder.encode(message, frame));
+			sent++;
+			ssize_t n;
+			while ((n = read(master, buffer, sizeof(buffer))) > 0)
+				for (ssize_t i=0; i<n; i++) {
+					if (!decoder.push(buffer[i], message))	continue;
+					if (message.type == proto::FORCE) {
+						out_of_order += message.vec[0] != forces || message.vec[1] != id;
+						forces++;
+					}
+					else if (message.type == proto::PING) {
+						message.echo = message.timestamp;
+						message.timestamp = uint32_t(now_us());
+						write_all(frame, encoder.encode(message, frame));
+					}
+				}
+		}
+	}
+
+	int master;
+	std::thread thread;
+};
+
+static double now_ns() {
+	return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int main() {
+	// file d'un producteur vers un consommateur: ordre et contenu
+	{
+		static Ring<uint64_t, 1024> ring;
+		const uint64_t count = 2000000;
+		// file pleine ou vide: laisser la main a l'autre fil, la machine peut n'avoir qu'un coeur
+		std::thread producer([&] {
+			for (uint64_t k=0; k<count; k++)
+				while (!ring.push(k))	std::this_thread::yield();
+		});
+		uint64_t expected = 0, wrong = 0, value;
+		double start = now_ns();
+		while (expected < count) {
+			if (ring.pop(value))	wrong += value != expected++;
+			else					std::this_thread::yield();
+		}
+		double elapsed = now_ns() - start;
+		producer.join();
+		printf("ring: %llu items, %llu out of order, %.1f ns per item\n", (unsigned long long) count, (unsigned long long) wrong, elapsed / count);
+	}
+	// derniere valeur: jamais de valeur melangée entre deux publications, jamais de retour en arriere
+	{
+		struct Wide { uint64_t v[16]; };
+		static Latest<Wide> latest;
+		std::atomic<bool> done(false);
+		std::thread writer([&] {
+			Wide w;
+			for (uint64_t k=1; k<=200000; k++) {
+				for (int i=0; i<16; i++)	w.v[i] = k;
+				latest.publish(w);
+				if (k % 64 == 0)	std::this_thread::yield();
+			}
+			done = true;
+		});
+		Wide w;
+		uint64_t reads = 0, torn = 0, backwards = 0, last = 0;
+		while (!done) {
+			std::this_thread::yield();
+			if (!latest.read(w))	continue;
+			reads++;
+			for (int i=1; i<16; i++)	torn += w.v[i] != w.v[0];
+			backwards += w.v[0] < last;
+			last = w.v[0];
+		}
+		writer.join();
+		printf("latest: %llu reads, %llu torn, %llu backwards\n", (unsigned long long) reads, (unsigned long long) torn, (unsigned long long) backwards);
+	}
+
+	// deux cartes: A communique toutes les 2 ms et ses poses sont lues par next(), B toutes les ms sans que personne ne lise ses poses
+	Standin standins[2] = {Standin(0, 2000), Standin(1, 1000)};
+	if (!standins[0].path() || !standins[1].path()) {
+		printf("pty: unavailable\n");
+		return 0;
+	}
+	Device devices[2];
+	for (int d=0; d<2; d++) {
+		devices[d].ping_period = 20000;
+		if (!devices[d].open(standins[d].path())) {
+			printf("device %d: cannot open %s\n", d, standins[d].path());
+			return 1;
+		}
+	}
+
+	// boucle de rendu a 1 kHz: derniere pose des deux cartes, poses de A dans l'ordre, une commande par carte et par image
+	const int frames = 1500;
+	unsigned long forces[2] = {0, 0}, wrong_device = 0, backwards = 0, gaps = 0, in_order = 0;
+	uint32_t last_seq[2] = {0, 0};
+	bool first = true;
+	double worst_read = 0, total_read = 0, worst_send = 0, total_send = 0;
+	unsigned long calls = 0;
+	for (int f=0; f<frames; f++) {
+		for (int d=0; d<2; d++) {
+			Pose pose;
+			float F[8] = {float(forces[d]), float(d), 0, 0, 0, 0, 0, 0};
+			double start = now_ns();
+			bool got = devices[d].latest(pose);
+			double middle = now_ns();
+			bool queued = devices[d].force(F);
+			double end = now_ns();
+			worst_read = fmax(worst_read, middle - start);
+			worst_send = fmax(worst_send, end - middle);
+			total_read += middle - start;
+			total_send += end - middle;
+			calls++;
+			forces[d] += queued;
+			if (got) {
+				wrong_device += pose.X[1] != d;
+				backwards += uint16_t(pose.seq - last_seq[d]) > 0x8000;
+				last_seq[d] = pose.seq;
+			}
+		}
+		// les numeros de trame sautent les PING: l'ordre des poses est verifié sur le compteur de la carte simulée
+		Pose pose;
+		static float expected;
+		while (devices[0].next(pose)) {
+			if (!first)		gaps += pose.X[0] != expected;
+			in_order++;
+			first = false;
+			expected = pose.X[0] + 1;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+	printf("render loop: %d frames, latest() mean %.0f ns worst %.0f ns, force() mean %.0f ns worst %.0f ns, %lu poses from the wrong device, %lu going backwards\n",
+		frames, total_read / calls, worst_read, total_send / calls, worst_send, wrong_device, backwards);
+	for (int d=0; d<2; d++) {
+		Stats s = devices[d].stats();
+		printf("device %c (%4u us): %5lu poses sent %5lu received %4lu dropped unread | %4lu forces queued %4lu received %lu out of order | %lu frame errors %lu lost\n",
+			'A'+d, standins[d].period, standins[d].sent, s.poses, s.poses_dropped, forces[d], standins[d].forces, standins[d].out_of_order, s.frame_errors, s.frames_lost);
+		printf("    rtt over %lu/%lu pings: mean %.0f us  min %.0f  max %.0f  stddev %.0f\n",
+			s.rtt_count, s.pings, s.rtt_mean, s.rtt_min, s.rtt_max, s.rtt_stddev);
+	}
+	printf("device A in order through next(): %lu poses, %lu gaps\n", in_order, gaps);
+
+	// la carte disparait: le fil s'arrete, la derniere pose reste lisible et les commandes sont refusées apres close()
+	standins[0].close();
+	bool disconnected = false;
+	for (int k=0; k<100 && !disconnected; k++) {
+		disconnected = !devices[0].stats().connected;
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	Pose pose;
+	bool kept = devices[0].latest(pose);
+	devices[0].close();
+	bool rejected = !devices[0].none() && devices[0].stats().commands_rejected == 1;
+	printf("hangup: detected %d, last pose kept %d, commands rejected once closed %d, device B still connected %d\n",
+		disconnected, kept, rejected, devices[1].stats().connected);
+	devices[1].close();
+	standins[1].close();
+	return 0;
+}
@@ -0,0 +1 @@
+g++ -O2 -pthread test_client.cpp ../host/client.cpp ../haptik/protocol.cpp -I../haptik -I../host -o test_client && exec ./test_client
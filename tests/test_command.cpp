@@ -0,0 +1,232 @@
+#include "command.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <vector>
+#include <chrono>
+
+/*
+	commandes texte: conversion des nombres, lignes invalides, et flux découpé en morceaux quelconques
+	comme le recoit communicate(): une file remplie au fil de la reception, vidée d'au plus budget octets par tick
+*/
+
+using namespace command;
+
+struct Parsed {
+	Kind kind;
+	float value[values];
+};
+
+static bool same(const Parsed &a, const Parsed &b) {
+	if (a.kind != b.kind)	return false;
+	if (a.kind == FORCE || a.kind == BLOCK)
+		for (size_t i=0; i<values; i++)
+			if (memcmp(&a.value[i], &b.value[i], sizeof(float)))	return false;
+	return true;
+}
+
+/// ecart en ulp entre deux flottants de meme signe
+static long ulp(float a, float b) {
+	int32_t ia, ib;
+	memcpy(&ia, &a, 4);
+	memcpy(&ib, &b, 4);
+	return labs(long(ia) - long(ib));
+}
+
+/// tout le texte d'un coup
+static std::vector<Parsed> parse(const std::string &text, Parser &parser) {
+	std::vector<Parsed> out;
+	for (char c : text)
+		if (parser.push(c)) {
+			Parsed p = {parser.kind, {}};
+			memcpy(p.value, parser.value, sizeof(p.value));
+			out.push_back(p);
+		}
+	return out;
+}
+
+static unsigned random_state = 12345;
+static unsigned rnd()	{ return random_state = random_state * 1103515245 + 12345, (random_state >> 16) & 0x7FFF; }
+
+/// un nombre ecrit de differentes facons, et sa valeur par strtof
+static std::string number(float &expected) {
+	char text[48];
+	double v = (rnd() - 16384.) / 1000. * pow(10., int(rnd() % 13) - 6);
+	switch (rnd() % 5) {
+		case 0:	snprintf(text, sizeof(text), "%.2f", v);	break;
+		case 1:	snprintf(text, sizeof(text), "%.9g", v);	break;
+		case 2:	snprintf(text, sizeof(text), "%e", v);		break;
+		case 3:	snprintf(text, sizeof(text), "%+.3E", v);	break;
+		default:	snprintf(text, sizeof(text), "%d", int(v));
+	}
+	expected = strtof(text, nullptr);
+	return text;
+}
+
+int main() {
+	// conversion des nombres: meme valeur que strtof a 2 ulp pres
+	{
+		Parser parser;
+		long worst = 0;
+		unsigned long exact = 0, total = 0;
+		std::string worst_text;
+		for (int k=0; k<20000; k++) {
+			std::string line = "force ";
+			float expected[values];
+			std::string texts[values];
+			for (size_t i=0; i<values; i++) {
+				texts[i] = number(expected[i]);
+				line += texts[i] + (i < values-1 ? "," : "\n");
+			}
+			std::vector<Parsed> p = parse(line, parser);
+			if (p.size() != 1)	{ printf("rejected: %s", line.c_str());	return 1; }
+			for (size_t i=0; i<values; i++) {
+				long d = ulp(p[0].value[i], expected[i]);
+				exact += d == 0;
+				total++;
+				if (d > worst)	{ worst = d;	worst_text = texts[i]; }
+			}
+		}
+		printf("numbers: %lu values, %.2f%% identical to strtof, worst %ld ulp (%s)\n", total, 100. * exact / total, worst, worst_text.c_str());
+		const char *special[] = {"0", "-0.0", ".5", "5.", "1e3", "1E-3", "+2.5e+1", "000123.4500", "123456789012", "0.000000000012345678901", "1e40", "1e-50"};
+		long special_worst = 0;
+		for (const char *s : special) {
+			Parser single;
+			std::string line = "block ";
+			for (size_t i=0; i<values; i++)		line += std::string(s) + ",";
+			std::vector<Parsed> p = parse(line + "\n", single);
+			if (p.size() != 1)	{ printf("rejected: %s", line.c_str());	return 1; }
+			float expected = strtof(s, nullptr);
+			if (isinf(expected) || fabs(expected) < 1e-38)
+				special_worst = fmax(special_worst, isinf(expected) == isinf(p[0].value[0]) && (isinf(expected) || p[0].value[0] == 0) ? 0 : 1000);
+			else	special_worst = fmax(special_worst, ulp(fabs(p[0].value[0]), fabs(expected)));
+		}
+		printf("special forms (leading zeros, exponents, 12 digits, overflow, underflow): worst %ld ulp\n", special_worst);
+	}
+
+	// lignes invalides: ignorées, comptées, et la ligne suivante est lue normalement
+	{
+		const char *invalid[] = {
+			"force", "force 1,2,3,4,5,6,7", "force 1,2,3,4,5,6,7,8,9", "force 1,2,,4,5,6,7,8", "force 1,2,3,4,5,6,7,8,,",
+			"force 1,2,3,4,5,6,7,x", "force 1.2.3,2,3,4,5,6,7,8", "force 1e,2,3,4,5,6,7,8", "force -,2,3,4,5,6,7,8",
+			"none 1", "forces 1,2,3,4,5,6,7,8", "push", "FORCE 1,2,3,4,5,6,7,8", "averyveryverylongkeyword 1,2", "force 1 2,3,4,5,6,7,8,9",
+		};
+		Parser parser;
+		unsigned long wrong = 0;
+		for (const char *line : invalid) {
+			std::vector<Parsed> p = parse(std::string(line) + "\nnone\n", parser);
+			wrong += p.size() != 1 || p[0].kind != NONE;
+		}
+		std::vector<Parsed> p = parse("  force 1, 2 ,3,4,5,6,7,8,\r\n\n\nprobes\r\n", parser);
+		bool lenient = p.size() == 2 && p[0].kind == FORCE && p[0].value[1] == 2 && p[0].value[7] == 8 && p[1].kind == PROBES;
+		printf("invalid lines: %zu rejected, %lu errors counted, %lu misparsed; spaces, trailing comma, \\r\\n and blank lines accepted %d\n",
+			sizeof(invalid) / sizeof(invalid[0]), parser.errors, wrong, lenient);
+	}
+
+	// flux découpé: une commande coupée a chaque position possible, puis un script en morceaux aleatoires sur plusieurs ticks
+	{
+		std::string line = "block -0.25,1e-3,2,3.5,4,5,6,7\n";
+		Parser reference;
+		Parsed expected = parse(line, reference)[0];
+		int splits_ok = 0;
+		for (size_t cut=0; cut<=line.size(); cut++) {
+			Parser parser;
+			std::vector<Parsed> a = parse(line.substr(0, cut), parser);
+			std::vector<Parsed> b = parse(line.substr(cut), parser);
+			a.insert(a.end(), b.begin(), b.end());
+			splits_ok += a.size() == 1 && same(a[0], expected);
+		}
+		printf("one command split at every position: %d/%zu parsed\n", splits_ok, line.size() + 1);
+
+		std::string script;
+		std::vector<Parsed> expected_commands;
+		const char *keywords[] = {"force", "block", "none", "probes", "bogus"};
+		for (int k=0; k<2000; k++) {
+			int w = rnd() % 5;
+			std::string l = keywords[w];
+			Parsed p = {w == 0 ? FORCE : w == 1 ? BLOCK : w == 2 ? NONE : PROBES, {}};
+			if (w < 2 || w == 4) {
+				l += ' ';
+				for (size_t i=0; i<values; i++)		l += number(p.value[i]) + (i < values-1 ? "," : "");
+			}
+			l += rnd() % 2 ? "\r\n" : "\n";
+			script += l;
+			if (w != 4)		expected_commands.push_back(p);
+		}
+		Ring<512> rx;
+		Parser parser;
+		std::vector<Parsed> received;
+		const size_t budget = 256;
+		size_t fed = 0, max_pending = 0;
+		unsigned long ticks = 0, calls_at_budget = 0;
+		auto start = std::chrono::steady_clock::now();
+		while (fed < script.size() || rx.size()) {
+			// reception: entre 0 et 300 octets depuis la derniere communication, parfois plus que le budget
+			for (size_t n = rnd() % 300; n && fed < script.size(); n--)
+				rx.push(script[fed++]);
+			max_pending = fmax(max_pending, rx.size());
+			uint8_t byte;
+			size_t n = 0;
+			for (; n<budget && rx.pop(byte); n++)
+				if (parser.push(byte)) {
+					Parsed p = {parser.kind, {}};
+					memcpy(p.value, parser.value, sizeof(p.value));
+					received.push_back(p);
+				}
+			calls_at_budget += n == budget;
+			ticks++;
+		}
+		double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+		bool match = received.size() == expected_commands.size();
+		for (size_t i=0; match && i<received.size(); i++) {
+			match = received[i].kind == expected_commands[i].kind;
+			if (received[i].kind == FORCE || received[i].kind == BLOCK)
+				for (size_t v=0; v<values; v++)		match = match && ulp(received[i].value[v], expected_commands[i].value[v]) <= 2;
+		}
+		printf("fragmented script: %zu bytes over %lu ticks, %zu/%zu commands in order %d, %lu lines rejected, %lu bytes dropped\n",
+			script.size(), ticks, received.size(), expected_commands.size(), match, parser.errors, rx.dropped);
+		printf("  at most %zu bytes parsed per tick (%lu ticks at the budget, backlog at most %zu bytes), %.0f ns per byte\n",
+			budget, calls_at_budget, max_pending, elapsed / script.size());
+
+		// file pleine: les octets en trop sont perdus et comptés. la ligne tronquée a perdu sa fin de ligne:
+		// elle se confond avec la suivante, rejetée avec elle, et la commande d'apres est lue normalement
+		Ring<16> small;
+		Parser after;
+		std::string burst = "force 1,2,3,4,5,6,7,8\nnone\n";
+		for (char c : burst)	small.push(c);
+		uint8_t byte;
+		std::string kept;
+		while (small.pop(byte))		kept += char(byte);
+		std::vector<Parsed> p = parse(kept + "none\nnone\n", after);
+		printf("ring overflow: %lu bytes dropped, truncated line rejected with the next one %d, following command parsed %d\n",
+			small.dropped, after.errors == 1, p.size() == 1 && p[0].kind == NONE);
+	}
+
+	// cout par rapport a sscanf("%f,") de l'ancienne lecture
+	{
+		std::vector<std::string> texts;
+		float v;
+		for (int k=0; k<20000; k++)		texts.push_back(number(v) + ",");
+		Parser parser;
+		float sink = 0;
+		auto t0 = std::chrono::steady_clock::now();
+		for (const std::string &t : texts) {
+			sscanf(t.c_str(), "%f,", &v);
+			sink += v;
+		}
+		auto t1 = std::chrono::steady_clock::now();
+		for (size_t k=0; k + values <= texts.size(); k += values) {
+			for (const char *p = "force "; *p; p++)		parser.push(*p);
+			for (size_t i=0; i<values; i++)
+				for (char c : texts[k+i])	parser.push(c);
+			if (parser.push('\n'))	sink += parser.value[0];
+		}
+		auto t2 = std::chrono::steady_clock::now();
+		double scanf_ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / texts.size();
+		double parser_ns = std::chrono::duration<double, std::nano>(t2 - t1).count() / texts.size();
+		printf("per value: sscanf %.0f ns, parser %.0f ns (%g)\n", scanf_ns, parser_ns, sink * 0);
+	}
+	return 0;
+}
@@ -0,0 +1 @@
+g++ -O2 test_command.cpp ../haptik/command.cpp -I../haptik -o test_command && exec ./test_command
@@ -0,0 +1,143 @@
+#include "haptik.ino"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+/// trafic d'un tick de controle complet: une lecture de position et une ecriture de courant par moteur
+static void report(const char *name, const DynamixelWorkbench::Counters &c, float time) {
+	printf("%-12s %3lu instructions  %3lu statuses  %4lu bytes sent  %4lu bytes received  %6.0f us\n",
+		name, c.instructions, c.statuses, c.bytes_sent, c.bytes_received, time);
+}
+
+int main() {
+	// valeurs de registres connues sur chaque moteur
+	for (int i=0; i<N; i++) {
+		int32_t position = 100*i + 50;
+		int32_t velocity = -3*i;
+		int16_t current = 10*i - 40;
+		memcpy(&dxl.control_table[i][HaptikDXL::PRESENT_POSITION], &position, 4);
+		memcpy(&dxl.control_table[i][HaptikDXL::PRESENT_VELOCITY], &velocity, 4);
+		memcpy(&dxl.control_table[i][HaptikDXL::PRESENT_CURRENT], &current, 2);
+	}
+	dxl.begin("3", 1000000);
+	dxl.setup_sync(N);
+	
+	// les operations groupées doivent lire et ecrire les memes valeurs que les operations unitaires
+	float position[N], velocity[N], current[N], goal[N];
+	float err = 0;
+	dxl.sync_get_state(position, velocity, current);
+	for (int i=0; i<N; i++) {
+		err = fmax(err, fabs(position[i] - dxl.get_position(i)));
+		err = fmax(err, fabs(velocity[i] - dxl.get_velocity(i)));
+		err = fmax(err, fabs(current[i] - dxl.get_current(i)));
+	}
+	dxl.sync_get_position(goal);
+	for (int i=0; i<N; i++)		err = fmax(err, fabs(position[i] - goal[i]));
+	for (int i=0; i<N; i++)		goal[i] = 27*i - 100;
+	dxl.sync_set_current(goal);
+	for (int i=0; i<N; i++) {
+		int16_t written;
+		memcpy(&written, &dxl.control_table[i][HaptikDXL::GOAL_CURRENT], 2);
+		err = fmax(err, fabs(written - int16_t(goal[i] / dxl.UNIT_CURRENT)));
+	}
+	printf("sync against single register access: max difference %f\n", err);
+	
+	// trafic par tick, consignes de courant toutes nouvelles
+	dxl.invalidate();
+	dxl.reset_counters();
+	for (int i=0; i<N; i++)		dxl.get_position(i);
+	for (int i=0; i<N; i++)		dxl.set_current(i, goal[i]);
+	report("single", dxl.counters, dxl.bus_time());
+	
+	dxl.invalidate();
+	dxl.reset_counters();
+	dxl.sync_get_position(position);
+	dxl.sync_set_current(goal);
+	report("sync", dxl.counters, dxl.bus_time());
+	
+	dxl.invalidate();
+	dxl.reset_counters();
+	dxl.sync_get_state(position, velocity, current);
+	dxl.sync_set_current(goal);
+	report("sync state", dxl.counters, dxl.bus_time());
+	
+	// ombre des registres: les consignes qui ne changent pas de pas de courant ne partent pas
+	printf("register shadow\n");
+	for (int i=0; i<N; i++)		goal[i] = (10*i + 0.5) * dxl.UNIT_CURRENT;		// au milieu d'un pas
+	dxl.invalidate();
+	dxl.write_counters = {0, 0, 0};
+	dxl.reset_counters();
+	for (int i=0; i<N; i++)		dxl.set_current(i, goal[i]);
+	for (int i=0; i<N; i++)		dxl.set_current(i, goal[i] + 1);	// moins d'un pas
+	dxl.sync_set_current(goal);
+	goal[3] += dxl.UNIT_CURRENT;
+	dxl.sync_set_current(goal);		// un seul moteur dans le paquet
+	printf("  currents: %lu packets sent, %lu suppressed, %lu bytes sent\n", dxl.write_counters.sent, dxl.write_counters.suppressed, dxl.counters.bytes_sent);
+	
+	dxl.write_counters = {0, 0, 0};
+	dxl.set_mode(2, HaptikDXL::CURRENT);
+	unsigned long change = dxl.write_counters.sent;
+	dxl.set_mode(2, HaptikDXL::CURRENT);
+	printf("  set_mode: %lu packets for a change, %lu when already in the mode\n", change, dxl.write_counters.sent - change);
+	
+	// registres voisins dans un lot: position min et max, puis profils d'acceleration et de vitesse
+	dxl.write_counters = {0, 0, 0};
+	dxl.begin_batch();
+	dxl.set_min_position(5, 100);
+	dxl.set_max_position(5, 4000);
+	dxl.set_profile_acceleration(5, 30000.);
+	dxl.set_profile_velocity(5, 200.);
+	dxl.set_profile_velocity(5, 200.);
+	dxl.end_batch();
+	int32_t min_position, max_position;
+	uint32_t acceleration, profile_velocity;
+	memcpy(&min_position, &dxl.control_table[5][HaptikDXL::MIN_POSITION], 4);
+	memcpy(&max_position, &dxl.control_table[5][HaptikDXL::MAX_POSITION], 4);
+	memcpy(&acceleration, &dxl.control_table[5][HaptikDXL::PROFILE_ACCELERATION], 4);
+	memcpy(&profile_velocity, &dxl.control_table[5][HaptikDXL::PROFILE_VELOCITY], 4);
+	printf("  batch of 4 registers: %lu packets sent, %lu coalesced, %lu suppressed, registers written %d\n",
+		dxl.write_counters.sent, dxl.write_counters.coalesced, dxl.write_counters.suppressed,
+		min_position == 100 && max_position == 4000 && acceleration == uint32_t(30000. / dxl.UNIT_ACCELERATION) && profile_velocity == uint32_t(200. / dxl.UNIT_VELOCITY));
+	
+	// ecriture groupée perdue sur le bus (sans retour, la carte ne le sait pas): corrigée au plus tard par le rafraichissement
+	int16_t lost = 0;
+	memcpy(&dxl.control_table[3][HaptikDXL::GOAL_CURRENT], &lost, 2);
+	int calls = 0;
+	int16_t written = 0;
+	while (written == lost && calls < 1000) {
+		dxl.sync_set_current(goal);
+		calls++;
+		memcpy(&written, &dxl.control_table[3][HaptikDXL::GOAL_CURRENT], 2);
+	}
+	printf("  lost sync write corrected after %d calls (refresh every %d)\n", calls, HaptikDXL::SYNC_REFRESH);
+	
+	// meme perte, pendant que les consignes des autres moteurs changent a chaque appel: les paquets partiels ne retardent pas la correction
+	memcpy(&dxl.control_table[3][HaptikDXL::GOAL_CURRENT], &lost, 2);
+	float moving[N];
+	memcpy(moving, goal, sizeof(moving));
+	calls = 0;
+	written = lost;
+	while (written == lost && calls < 1000) {
+		for (int i=0; i<N; i++)
+			if (i != 3)		moving[i] = goal[i] + (calls % 2 ? 10 : 20) * dxl.UNIT_CURRENT;
+		dxl.sync_set_current(moving);
+		calls++;
+		memcpy(&written, &dxl.control_table[3][HaptikDXL::GOAL_CURRENT], 2);
+	}
+	printf("  lost sync write corrected after %d calls while the other currents change\n", calls);
+	bool corrected = written != lost;
+	
+	// le croquis complet, sur une seconde de temps simulé, sans retour de force: les courants ne changent pas
+	setup();
+	dxl.reset_counters();
+	dxl.write_counters = {0, 0, 0};
+	for (unsigned long end = sim_micros + 1000000; sim_micros < end; sim_micros += 10)		loop();
+	const unsigned long ticks = scheduler.task(0).runs;
+	DynamixelWorkbench::Counters c = dxl.counters;
+	float time = dxl.bus_time() / ticks;
+	c.instructions /= ticks;	c.statuses /= ticks;	c.bytes_sent /= ticks;	c.bytes_received /= ticks;
+	report("control()", c, time);
+	printf("  %lu ticks: %lu current writes sent, %lu suppressed\n", ticks, dxl.write_counters.sent, dxl.write_counters.suppressed);
+	
+	return corrected ? 0 : 1;
+}
@@ -0,0 +1,163 @@
+#include "haptlib.h"
+#include "FakeTransport.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+/*
+	echanges non bloquants (dxlbus.h) sur le bus simulé: paquets, transactions, puis debit d'une boucle de controle
+	qui lit les angles, calcule et ecrit les courants, avec les echanges bloquants ou avec la lecture suivante lancée avant le calcul.
+	le temps de calcul de la carte est modelisé en faisant avancer l'horloge simulée.
+*/
+
+static const int N = 8;
+static HaptikDXL bus;
+static FakeTransport transport(bus);
+static dxlbus::Engine engine(transport, micros, 3000, [] { sim_advance(1); });
+
+static void fill_registers() {
+	for (int i=0; i<N; i++) {
+		int32_t position = 100*i - 0x300;	// des octets FF dans les valeurs negatives
+		int32_t velocity = -3*i;
+		int16_t current = 10*i - 40;
+		memcpy(&bus.control_table[i][HaptikDXL::PRESENT_POSITION], &position, 4);
+		memcpy(&bus.control_table[i][HaptikDXL::PRESENT_VELOCITY], &velocity, 4);
+		memcpy(&bus.control_table[i][HaptikDXL::PRESENT_CURRENT], &current, 2);
+	}
+}
+
+/// boucle de controle: lecture des angles, calcul du retour (feedback µs), ecriture des courants, puis la cinematique (solve µs)
+/// retourne la periode moyenne d'un tour en µs, et dans busy l'occupation du bus par tour
+static float control_loop(bool asynchronous, bool pipelined, uint32_t feedback, uint32_t solve, float *busy = nullptr) {
+	const int ticks = 500;
+	float angle[N], current[N];
+	bus.attach(asynchronous ? &engine : nullptr);
+	bus.invalidate();
+	sim_advance(10000);		// bus libre
+	bus.reset_counters();
+	unsigned long start = sim_micros;
+	for (int k=0; k<ticks; k++) {
+		uint32_t time;
+		if (!bus.state_pending())	bus.submit_state(false);
+		if (!bus.collect_state(angle, nullptr, &time))	printf("  read failed at tick %d\n", k);
+		sim_advance(feedback);
+		for (int i=0; i<N; i++)		current[i] = ((k + i) % 20) * bus.UNIT_CURRENT;	// toujours une consigne qui change
+		bus.sync_set_current(current);
+		if (pipelined)	bus.submit_state(false);
+		sim_advance(solve);
+	}
+	// la derniere lecture lancée est recuperée avant de changer de mode
+	if (bus.state_pending())	bus.collect_state(angle, nullptr, nullptr);
+	if (busy)	*busy = (bus.bus_time() + bus.counters.statuses * bus.return_delay) / ticks + transport.latency;	// une lecture par tour
+	return float(sim_micros - start) / ticks;
+}
+
+int main() {
+	int failures = 0;
+	// paquets de l'exemple du manuel du protocole 2.0: PING et READ de la position du moteur 1
+	{
+		uint8_t out[dxlbus::max_packet];
+		const uint8_t ping[] = {0xFF, 0xFF, 0xFD, 0x00, 0x01, 0x03, 0x00, 0x01, 0x19, 0x4E};
+		const uint8_t read[] = {0xFF, 0xFF, 0xFD, 0x00, 0x01, 0x07, 0x00, 0x02, 0x84, 0x00, 0x04, 0x00, 0x1D, 0x15};
+		const uint8_t read_params[] = {0x84, 0x00, 0x04, 0x00};
+		bool ping_ok = dxlbus::packet(out, 1, 0x01, nullptr, 0) == sizeof(ping) && !memcmp(out, ping, sizeof(ping));
+		bool read_ok = dxlbus::packet(out, 1, dxlbus::READ, read_params, 4) == sizeof(read) && !memcmp(out, read, sizeof(read));
+		// bourrage: FF FF FD dans les parametres prend un octet de plus et se relit a l'identique, meme coupé en deux par le flux
+		const uint8_t stuffed[] = {0x74, 0x00, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0xFD};
+		size_t size = dxlbus::packet(out, 3, dxlbus::WRITE, stuffed, sizeof(stuffed));
+		dxlbus::Parser parser;
+		int parsed = 0;
+		const uint8_t noise[] = {0xFF, 0xFF, 0x00, 0xFF};
+		for (uint8_t byte : noise)	parsed += parser.push(byte);
+		for (size_t i=0; i<size; i++)	parsed += parser.push(out[i]);
+		bool stuffing_ok = parsed == 1 && size == 10 + sizeof(stuffed) + 2 && parser.id == 3 && parser.instruction == dxlbus::WRITE
+			&& parser.size == sizeof(stuffed) && !memcmp(parser.params, stuffed, sizeof(stuffed));
+		if (size > 3)	out[size - 3] ^= 1;
+		for (size_t i=0; i<size; i++)	parsed += parser.push(out[i]);
+		printf("packets: ping %d, read %d, byte stuffing %d, corrupted packet rejected %d\n", ping_ok, read_ok, stuffing_ok, parsed == 1 && parser.errors == 1);
+	}
+
+	// transactions: memes valeurs que les echanges bloquants de la bibliotheque
+	fill_registers();
+	bus.begin("3", 1000000);
+	bus.setup_sync(N);
+	{
+		float position[N], velocity[N], current[N], p, v, c;
+		bus.sync_get_state(position, velocity, current);
+		bus.attach(&engine);
+		float err = 0;
+		float async_position[N], async_velocity[N], async_current[N];
+		bus.sync_get_state(async_position, async_velocity, async_current);
+		for (int i=0; i<N; i++) {
+			p = bus.get_position(i);
+			v = bus.get_velocity(i);
+			c = bus.get_current(i);
+			err = fmax(err, fabs(p - position[i]) + fabs(v - velocity[i]) + fabs(c - current[i]));
+			err = fmax(err, fabs(async_position[i] - position[i]) + fabs(async_velocity[i] - velocity[i]) + fabs(async_current[i] - current[i]));
+		}
+		float goal[N];
+		for (int i=0; i<N; i++)		goal[i] = (5*i - 12) * bus.UNIT_CURRENT;
+		bus.sync_set_current(goal);
+		bus.set_position(6, 1.5);
+		dxlbus::Engine::Handle last = engine.read(0, 0, 1);		// la file est vidée dans l'ordre
+		engine.wait(last);
+		engine.release(last);
+		for (int i=0; i<N; i++) {
+			int16_t written;
+			memcpy(&written, &bus.control_table[i][HaptikDXL::GOAL_CURRENT], 2);
+			err = fmax(err, fabs(written - int16_t(goal[i] / bus.UNIT_CURRENT)));
+		}
+		int32_t position6;
+		memcpy(&position6, &bus.control_table[6][HaptikDXL::GOAL_POSITION], 4);
+		printf("transactions against blocking calls: max difference %f, write with status %d\n", err, position6 == int32_t(1.5 / bus.UNIT_ANGLE));
+
+		// moteur absent et retour corrompu: echec apres le delai, la transaction suivante part normalement
+		unsigned long before = sim_micros;
+		dxlbus::Engine::Handle missing = engine.read(12, HaptikDXL::PRESENT_POSITION, 4);
+		bool missing_failed = !engine.wait(missing);
+		engine.release(missing);
+		unsigned long waited = sim_micros - before;
+		transport.corrupt = 1;
+		bool corrupted_failed = !bus.sync_get_position(position);
+		bool recovered = bus.sync_get_position(position) && fabs(position[3] - async_position[3]) < 1e-6;
+		printf("absent motor fails %d after %lu us, corrupted status fails %d, next read ok %d, %lu timeouts, %lu rejected frames\n",
+			missing_failed, waited, corrupted_failed, recovered, engine.counters.timeouts, engine.parser().errors);
+		failures += !missing_failed + !corrupted_failed + !recovered;
+
+		// file pleine: les lectures non libérées gardent leur emplacement
+		dxlbus::Engine::Handle handles[dxlbus::Engine::slots + 1];
+		int accepted = 0;
+		for (int k=0; k<=dxlbus::Engine::slots; k++)	accepted += (handles[k] = engine.read(k, HaptikDXL::PRESENT_POSITION, 4)) >= 0;
+		for (int k=0; k<=dxlbus::Engine::slots; k++) {
+			engine.wait(handles[k]);
+			engine.release(handles[k]);
+		}
+		printf("queue: %d of %d transactions accepted, %lu rejected\n", accepted, dxlbus::Engine::slots + 1, engine.counters.rejected);
+	}
+
+	// debit de la boucle de controle: lecture groupée des 8 positions et ecriture groupée des courants par tour
+	// calcul de la carte: 100 µs pour le retour de force, 600 µs pour la cinematique
+	// le bus simulé de la bibliotheque n'a pas de latence d'adaptateur: pas de comparaison avec elle dans ce cas
+	const uint32_t feedback = 100, solve = 600;
+	printf("control loop, %u us feedback + %u us kinematics per tick (us per tick):\n", feedback, solve);
+	printf("  %8s %12s %8s %10s %10s %10s %10s %8s\n", "baud", "return delay", "latency", "bus busy", "library", "blocking", "pipelined", "gain");
+	const uint32_t bauds[] = {1000000, 4000000};
+	const uint32_t delays[][2] = {{0, 0}, {250, 0}, {0, 1000}};
+	for (uint32_t baud : bauds)
+		for (auto &d : delays) {
+			bus.begin("3", baud);
+			bus.return_delay = d[0];
+			transport.latency = d[1];
+			float busy;
+			float library = control_loop(false, false, feedback, solve);
+			float blocking = control_loop(true, false, feedback, solve);
+			float pipelined = control_loop(true, true, feedback, solve, &busy);
+			char reference[16] = "-";
+			if (!d[1])	snprintf(reference, sizeof(reference), "%.0f", library);
+			printf("  %8u %9u us %5u us %10.0f %10s %10.0f %10.0f %7.2fx\n", baud, d[0], d[1], busy, reference, blocking, pipelined, blocking / pipelined);
+		}
+	bus.attach(nullptr);
+	printf("engine: %lu transactions, %lu completed, %lu timeouts, %lu stray bytes\n",
+		engine.counters.submitted, engine.counters.completed, engine.counters.timeouts, engine.counters.stray);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1 @@
+g++ -O2 test_dxlbus.cpp ../haptik/dxlbus.cpp -Isim -I../haptik -o test_dxlbus && exec ./test_dxlbus
@@ -0,0 +1,101 @@
+#include "model.h"
+#include "fastmath.h"
+#include "seeds.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+using namespace la;
+
+/// erreur maximale de f contre la reference en double, sur n points de [a,b]
+template <class F, class G>
+static double sweep(F f, G ref, double a, double b, int n, bool relative) {
+	double err = 0;
+	for (int i=0; i<=n; i++) {
+		float x = a + (b-a)*i/n;
+		double r = ref(double(x));
+		double e = fabs(double(f(x)) - r);
+		if (relative)	e /= fabs(r);
+		if (e > err)	err = e;
+	}
+	return err;
+}
+
+// erreurs maximales documentées dans fastmath.h, avec une marge pour l'arrondi de l'affichage
+static const double margin = 1.1;
+static int failures = 0;
+
+/// compte un depassement de la borne documentée, retourne l'erreur pour l'afficher
+static double bounded(double err, double bound) {
+	if (!(err <= bound * margin))	failures++;
+	return err;
+}
+
+int main() {
+	const int n = 2000000;
+	printf("HAPTIK_FASTMATH=%d\n", HAPTIK_FASTMATH);
+
+	// noyaux, contre la libm en double. l'erreur de la libm float est donnée en regard
+	printf("kernel                 fm          libm float\n");
+	printf("sin   [-pi,pi]      %9.2e   %9.2e\n",
+		bounded(sweep([](float x) { return fm::sin(x); }, [](double x) { return sin(x); }, -M_PI, M_PI, n, false), 1.2e-7),
+		sweep([](float x) { return sinf(x); }, [](double x) { return sin(x); }, -M_PI, M_PI, n, false));
+	printf("sin   [-100,100]    %9.2e   %9.2e\n",
+		bounded(sweep([](float x) { return fm::sin(x); }, [](double x) { return sin(x); }, -100, 100, n, false), 1.2e-7),
+		sweep([](float x) { return sinf(x); }, [](double x) { return sin(x); }, -100, 100, n, false));
+	printf("cos   [-pi,pi]      %9.2e   %9.2e\n",
+		bounded(sweep([](float x) { return fm::cos(x); }, [](double x) { return cos(x); }, -M_PI, M_PI, n, false), 1.2e-7),
+		sweep([](float x) { return cosf(x); }, [](double x) { return cos(x); }, -M_PI, M_PI, n, false));
+	printf("cos   [-100,100]    %9.2e   %9.2e\n",
+		bounded(sweep([](float x) { return fm::cos(x); }, [](double x) { return cos(x); }, -100, 100, n, false), 1.2e-7),
+		sweep([](float x) { return cosf(x); }, [](double x) { return cos(x); }, -100, 100, n, false));
+	printf("atan  [-50,50]      %9.2e   %9.2e\n",
+		bounded(sweep([](float x) { return fm::atan(x); }, [](double x) { return atan(x); }, -50, 50, n, false), 1.9e-7),
+		sweep([](float x) { return atanf(x); }, [](double x) { return atan(x); }, -50, 50, n, false));
+	// atan2 sur le cercle unité et sur un rayon de 300mm (ordre de grandeur du mgi)
+	const double radii[] = {1, 300};
+	for (double radius : radii) {
+		printf("atan2 r=%-5g        %9.2e   %9.2e\n", radius,
+			bounded(sweep([=](float t) { return fm::atan2(float(radius*sin(t)), float(radius*cos(t))); },
+				[=](double t) { return atan2(double(float(radius*sin(t))), double(float(radius*cos(t)))); }, -M_PI, M_PI, n, false), 2.9e-7),
+			sweep([=](float t) { return atan2f(float(radius*sin(t)), float(radius*cos(t))); },
+				[=](double t) { return atan2(double(float(radius*sin(t))), double(float(radius*cos(t)))); }, -M_PI, M_PI, n, false));
+	}
+	printf("rsqrt [1e-4,1e6]    %9.2e   %9.2e  (relative)\n",
+		bounded(sweep([](float x) { return fm::rsqrt(x); }, [](double x) { return 1/sqrt(x); }, 1e-4, 1e6, n, true), 1.5e-7),
+		sweep([](float x) { return 1/sqrtf(x); }, [](double x) { return 1/sqrt(x); }, 1e-4, 1e6, n, true));
+	printf("sqrt  [1e-4,1e6]    %9.2e   %9.2e  (relative)\n",
+		bounded(sweep([](float x) { return fm::sqrt(x); }, [](double x) { return sqrt(x); }, 1e-4, 1e6, n, true), 1.8e-7),
+		sweep([](float x) { return sqrtf(x); }, [](double x) { return sqrt(x); }, 1e-4, 1e6, n, true));
+	printf("special: sqrt(-1) %g  sqrt(0) %g  atan2(0,-0) %g  atan2(-0,-1) %g\n",
+		fm::sqrt(-1), fm::sqrt(0), fm::atan2(0.f, -0.f), fm::atan2(-0.f, -1));
+	failures += !isnan(fm::sqrt(-1)) + (fm::sqrt(0) != 0) + (fm::atan2(0.f, -0.f) != float(M_PI)) + (fm::atan2(-0.f, -1) != -float(M_PI));
+
+	// espace de travail: les poses de la table de depart, mgi float contre mgi double
+	Delta delta;
+	double err_q = 0, err_X = 0;
+	int failed = 0;
+	for (size_t k=0; k<seeds::count(); k++) {
+		float X[N];
+		seeds::pose(k, X);
+		la::Vector<double,N> Xd;
+		for (size_t i=0; i<N; i++)	Xd(i) = X[i];
+		la::Vector<double,N> qd = delta.mgi_eval(Xd).q;
+		vec8 q = delta.mgi(vec8(X)).q;
+		for (size_t i=0; i<N; i++)	err_q = fmax(err_q, fabs(q(i) - qd(i)));
+
+		// resolution complete depuis une pose voisine, contre la pose exacte
+		vec8 qf;
+		for (size_t i=0; i<N; i++)	qf(i) = qd(i);
+		const float offset[N] = {0.5, 0.5, 0.5, 5e-3, 5e-3, 5e-3, 5e-3, 5e-3};
+		vec8 x0 = vec8(X) + vec8(offset);
+		Delta::solve_info info;
+		vec8 Xs = delta.mgd_solve(qf, x0, &info).X;
+		if (!info.converged)	{ failed++;	continue; }
+		for (size_t i=0; i<3; i++)	err_X = fmax(err_X, fabs(Xs(i) - X[i]));
+	}
+	printf("workspace, %zu poses:  mgi max error on q %.2e rad   mgd_solve max position error %.2e mm  (%d not converged)\n", seeds::count(), err_q, err_X, failed);
+	bounded(err_q, 1.5e-5);		// 1.3e-5 rad mesuré, avec ou sans HAPTIK_FASTMATH: l'arrondi float domine
+	if (failures)	printf("%d errors above their documented bound\n", failures);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1 @@
+for f in 0 1; do g++ -O2 -DHAPTIK_FASTMATH=$f test_fastmath.cpp ../haptik/model.cpp ../haptik/seeds.cpp -I../haptik -o test_fastmath && ./test_fastmath || exit 1; done
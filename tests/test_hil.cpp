@@ -0,0 +1,270 @@
+#include "haptik.ino"
+#include "hil.h"
+#include "FakeTransport.h"
+#include <stdio.h>
+#include <chrono>
+
+/*
+	le croquis complet sur le robot simulé, sans modification:
+	fréquence des taches, iterations du mgd, ecart entre la pose calculée et la vraie, latence du retour de force
+*/
+
+static Plant plant;
+static float pose_error = 0;
+static float predict_error = 0;	// pose extrapolée par l'observateur, telle qu'envoyée
+static bool starved = false;		// une tache n'a pas tourné de toute une mesure
+
+/// fait tourner loop() pendant duration µs de temps simulé
+static void run(unsigned long duration) {
+	for (unsigned long end = sim_micros + duration; sim_micros < end; ) {
+		loop();
+		sim_advance(5);
+		if (!plant.stuck) {
+			pose_error = fmax(pose_error, (pose.X - plant.X).norm());
+			predict_error = fmax(predict_error, (observer.predict(sim_micros) - plant.X).norm());
+		}
+	}
+}
+
+static void report(const char *title, unsigned long since) {
+	unsigned long duration = sim_micros - since;
+	printf("%s\n", title);
+	printf("  %-12s %8s %8s %8s %12s\n", "task", "rate Hz", "overruns", "skipped", "latency us");
+	for (size_t i=0; i<scheduler.size(); i++) {
+		const Scheduler::Task &t = scheduler.task(i);
+		printf("  %-12s %8.0f %8lu %8lu %12u\n", t.name, t.runs * 1e6 / duration, t.overruns, t.skipped, t.worst_latency);
+		starved = starved || !t.runs;
+	}
+	printf("  mgd_solve iterations:");
+	for (size_t n=0; n<probe::max_iterations; n++)
+		if (probe::iteration_count(n))	printf("  %zu:%u", n, probe::iteration_count(n));
+	printf("\n  max distance between solved and simulated pose  %f\n", pose_error);
+	printf("  max distance between predicted and simulated pose  %f\n", predict_error);
+}
+
+static void send(proto::Message &message) {
+	static proto::Encoder encoder;
+	uint8_t frame[proto::max_frame];
+	Serial.inject(frame, encoder.encode(message, frame));
+}
+
+int main() {
+	Hil hil(dxl, plant);
+	hil.attach();
+	auto start = std::chrono::steady_clock::now();
+	
+	// moteurs en sortie d'usine: 250 µs de delai de retour, que setup() doit annuler
+	for (size_t i=0; i<N; i++)	dxl.control_table[i][9] = 125;
+	dxl.return_delay = 250;
+	setup();
+	printf("setup: %.1f s simulated, return delay %u us, angles", sim_micros * 1e-6, dxl.return_delay);
+	for (size_t i=0; i<N; i++)	printf(" %.3f", plant.q(i));
+	printf("\n");
+	
+	// l'utilisateur deplace la plateforme
+	const unsigned long duration = 1000000;
+	scheduler.reset_stats();
+	probe::reset();
+	unsigned long t0 = sim_micros;
+	// la main est un ressort amorti vers une cible qui decrit un cercle de 10 mm par seconde autour de la pose de repos
+	vec8 home = plant.X;
+	for (int k=0; k<1000; k++) {
+		vec8 target = home;
+		target(0) += 10 * sin(2*M_PI*(sim_micros - t0)*1e-6);
+		target(1) += 10 * cos(2*M_PI*(sim_micros - t0)*1e-6) - 10;
+		for (size_t i=0; i<N; i++)	plant.external(i) = (i<3? 500: 1e5) * ((target(i) - plant.X(i)) - 0.05*plant.V(i));
+		run(duration / 1000);
+	}
+	report("free motion, no return delay", t0);
+	
+	// moteur qui n'aurait pas été configuré: les taches tournent quand meme, le controle a mi frequence
+	dxl.return_delay = 250;
+	scheduler.reset_stats();
+	probe::reset();
+	pose_error = predict_error = 0;
+	t0 = sim_micros;
+	run(duration);
+	report("250 us return delay (factory setting)", t0);
+	dxl.return_delay = 0;
+	
+	// latence du retour de force: de la reception de l'ordre au changement des consignes, puis au mouvement
+	plant.external = vec8(0.);
+	run(200000);
+	plant.V = vec8(0.);
+	int16_t before = 0;
+	memcpy(&before, &dxl.control_table[0][Hil::GOAL_CURRENT], 2);
+	proto::Message force;
+	force.type = proto::FORCE;
+	force.timestamp = sim_micros;
+	for (size_t i=0; i<N; i++)	force.vec[i] = 0;
+	force.vec[0] = 20;
+	unsigned long sent = sim_micros, command = 0, motion = 0;
+	send(force);
+	for (unsigned long end = sim_micros + 200000; sim_micros < end && !motion; ) {
+		loop();
+		sim_advance(5);
+		int16_t goal;
+		memcpy(&goal, &dxl.control_table[0][Hil::GOAL_CURRENT], 2);
+		if (!command && goal != before)		command = sim_micros;
+		if (!motion && fabs(plant.V(0)) > 1)	motion = sim_micros;
+	}
+	// mouvement de la plateforme dans la direction de la force
+	float along = plant.V(0) / plant.V.segment<3>(0).norm();
+	printf("force rendering: currents updated after %.2f ms, platform moving after %.2f ms, cosine to the force %.3f\n",
+		(command - sent) * 1e-3, (motion - sent) * 1e-3, along);
+	bool force_along = along > 0.9;
+	
+	// mur virtuel rendu par la scene de la carte: la main pousse au dela, sans aller-retour avec l'ordinateur pendant le contact
+	proto::Message none;
+	none.type = proto::NONE;
+	send(none);
+	run(200000);
+	plant.V = vec8(0.);
+	vec8 rest = plant.X;
+	proto::Message plane;
+	plane.type = proto::SCENE;
+	plane.scene.slot = 0;
+	plane.scene.kind = scene::PLANE;
+	plane.scene.first = 0;
+	plane.scene.count = 6;
+	const float wall_params[] = {-1, 0, 0, -(rest(0) + 3), 2, 0.01};	// x <= rest + 3 mm
+	for (int i=0; i<6; i++)		plane.scene.values[i] = wall_params[i];
+	send(plane);
+	run(50000);
+	float depth = 0, speed = 0;
+	for (int k=0; k<2000; k++) {
+		vec8 target = rest;
+		target(0) += 10;
+		for (size_t i=0; i<N; i++)	plant.external(i) = (i<3? 500: 1e5) * ((target(i) - plant.X(i)) - 0.05*plant.V(i));
+		run(1000);
+		float x = plant.X(0) - rest(0) - 3;
+		if (x > 0 && !speed)	speed = plant.V(0);
+		if (x > depth)	depth = x;
+	}
+	printf("scene wall: contact at %.1f mm/s, max penetration %.2f mm, final %.2f mm (hand 7 mm beyond)\n", speed, depth, plant.X(0) - rest(0) - 3);
+	plant.external = vec8(0.);
+	send(none);
+	run(100000);
+
+	// blocage de x: la main pousse 10 mm au dela pendant 300 ms puis lache, sur plusieurs essais
+	// course parcourue (somme des deplacements) pendant l'appui tenu et apres le lacher: les vibrations l'allongent
+	float deepest = 0, hold_path = 0, release_path = 0;
+	const int trials = 4;
+	for (int trial=0; trial<trials; trial++) {
+		plant.reset(home);
+		run(100000 + 1700*trial);
+		proto::Message block;
+		block.type = proto::BLOCK;
+		for (size_t i=0; i<N; i++)	block.vec[i] = 0;
+		block.vec[0] = 1;
+		send(block);
+		run(50000);
+		float origin = plant.X(0), x = 0;
+		vec8 target = plant.X;
+		target(0) += 10;
+		for (int k=0; k<300; k++) {
+			for (size_t i=0; i<N; i++)	plant.external(i) = (i<3? 500: 1e5) * ((target(i) - plant.X(i)) - 0.05*plant.V(i));
+			run(1000);
+			float next = plant.X(0) - origin;
+			if (k >= 100)	hold_path += fabs(next - x);
+			x = next;
+			deepest = fmax(deepest, x);
+		}
+		plant.external = vec8(0.);
+		for (int k=0; k<300; k++) {
+			run(1000);
+			float next = plant.X(0) - origin;
+			release_path += fabs(next - x);
+			x = next;
+		}
+		send(none);
+	}
+	printf("block: hand pushing 10 mm beyond, %d pushes: max penetration %.2f mm, mean path %.2f mm held, %.2f mm after release\n",
+		trials, deepest, hold_path / trials, release_path / trials);
+	bool blocked = deepest < 3;
+	plant.reset(home);
+	run(100000);
+
+	// meme mouvement, avec les vitesses moteurs en plus dans l'observateur
+	// la lecture groupée des vitesses ne tient pas dans la periode de controle a 1 Mbps: bus a 2 Mbps
+	enable_velocity = true;
+	dxl.begin("3", 2000000);
+	feedback.type = ForceFeedback::NONE;
+	scheduler.reset_stats();
+	probe::reset();
+	pose_error = predict_error = 0;
+	t0 = sim_micros;
+	for (int k=0; k<1000; k++) {
+		vec8 target = home;
+		target(0) += 10 * sin(2*M_PI*(sim_micros - t0)*1e-6);
+		target(1) += 10 * cos(2*M_PI*(sim_micros - t0)*1e-6) - 10;
+		for (size_t i=0; i<N; i++)	plant.external(i) = (i<3? 500: 1e5) * ((target(i) - plant.X(i)) - 0.05*plant.V(i));
+		run(duration / 1000);
+	}
+	report("free motion, motor velocities read", t0);
+	enable_velocity = false;
+	dxl.begin("3", 1000000);
+	
+	// echanges non bloquants: la lecture des angles du tick suivant passe sur le bus pendant les autres taches
+	static FakeTransport transport(dxl);
+	static dxlbus::Engine engine(transport, micros, 3000, [] { sim_advance(1); });
+	dxl.attach(&engine);
+	for (uint32_t delay : {0u, 250u}) {
+		dxl.return_delay = delay;
+		scheduler.reset_stats();
+		probe::reset();
+		pose_error = predict_error = 0;
+		t0 = sim_micros;
+		for (int k=0; k<1000; k++) {
+			vec8 target = home;
+			target(0) += 10 * sin(2*M_PI*(sim_micros - t0)*1e-6);
+			target(1) += 10 * cos(2*M_PI*(sim_micros - t0)*1e-6) - 10;
+			for (size_t i=0; i<N; i++)	plant.external(i) = (i<3? 500: 1e5) * ((target(i) - plant.X(i)) - 0.05*plant.V(i));
+			run(duration / 1000);
+		}
+		report(delay ? "non-blocking bus, 250 us return delay" : "non-blocking bus, no return delay", t0);
+	}
+	printf("  %lu transactions, %lu timeouts\n", engine.counters.submitted, engine.counters.timeouts);
+	dxl.attach(nullptr);
+	dxl.return_delay = 0;
+	
+	// poses recues par l'ordinateur
+	proto::Decoder decoder;
+	proto::Message message;
+	unsigned long poses = 0;
+	for (uint8_t byte : Serial.tx)
+		if (decoder.push(byte, message) && message.type == proto::POSE)	poses++;
+	double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	printf("serial: %lu poses received, %lu errors\n", poses, decoder.errors);
+
+	// commandes texte: un ordre de force qui arrive en trois morceaux sur trois communications, apres une ligne invalide
+	proto::Message config;
+	config.type = proto::CONFIG;
+	config.config.flags = proto::FEEDBACK | proto::MEASURE | proto::ASCII;
+	config.config.refresh = 0;
+	send(config);
+	run(50000);
+	plant.V = vec8(0.);
+	memcpy(&before, &dxl.control_table[0][Hil::GOAL_CURRENT], 2);
+	const char *fragments[] = {"forse 1,2\nfor", "ce 20,0,0,0,", "0,0,0,0\r\n"};
+	unsigned long last = 0;
+	command = 0;
+	for (const char *fragment : fragments) {
+		Serial.inject((const uint8_t *) fragment, strlen(fragment));
+		last = sim_micros;
+		for (unsigned long end = sim_micros + 25000; sim_micros < end; ) {
+			loop();
+			sim_advance(5);
+			int16_t goal;
+			memcpy(&goal, &dxl.control_table[0][Hil::GOAL_CURRENT], 2);
+			if (!command && goal != before)		command = sim_micros;
+		}
+	}
+	printf("text commands: force in 3 fragments applied %d, %.2f ms after the last one, %lu lines rejected\n",
+		command > last, (command - last) * 1e-3, command_parser.errors);
+	Serial.inject((const uint8_t *) "none\n", 5);
+	run(50000);
+
+	printf("simulated %.1f s in %.2f s (x%.1f real time)\n", sim_micros * 1e-6, wall, sim_micros * 1e-6 / wall);
+	return dxl.return_delay || starved || !force_along || !blocked ? 1 : 0;
+}
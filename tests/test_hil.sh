@@ -0,0 +1 @@
+g++ -O2 test_hil.cpp sim/plant.cpp ../haptik/model.cpp ../haptik/seeds.cpp ../haptik/observer.cpp ../haptik/scene.cpp ../haptik/telemetry.cpp ../haptik/protocol.cpp ../haptik/dxlbus.cpp ../haptik/command.cpp ../haptik/scheduler.cpp ../haptik/probe.cpp -Isim -I../haptik -o test_hil && exec ./test_hil
@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <math.h>
 #include "linalg.h"
 
 using namespace la;
@@ -25,5 +26,70 @@ int main() {
 		putchar('\n');
 	}
 	
+	// resolution par factorisation LU, sans inverse
+	LU<float, 8> lu(m3);
+	vec8 b;
+	for (int i=0; i<b.ndim(); i++)	b(i) = i;
+	vec8 x = lu.solve(b);
+	vec8 xt = lu.solve_transpose(b);
+	printf("lu solve residuals: %f  %f\n", (m3*x - b).norm(), (m3.transpose()*xt - b).norm());
+	printf("lu determinant: %f  rcond: %f\n", lu.determinant(), lu.rcond());
+	
+	// factorisation LDL^T d'une matrice symetrique definie positive
+	mat8 spd = m3.transpose() * m3 + mat8::identity();
+	LDLT<float, 8> ldlt(spd);
+	vec8 xs = ldlt.solve(b);
+	LDLT<float, 8> indefinite(mat8::identity() - 2*mat8::identity());
+	printf("ldlt solve residual: %f  indefinite matrix rejected: %d\n", (spd*xs - b).norm(), indefinite.err);
+	
+	// expressions element par element et operateurs en place
+	vec8 y = 2*b - b/2 + 1;
+	y += b;
+	y *= 0.5;
+	y -= 1.25*b + 0.5;
+	printf("expression and in-place operators: %f\n", y.norm());
+	
+	// vues sans copie: lignes, colonnes, diagonale et blocs lisent et ecrivent le stockage de la matrice
+	Matrix<float, 2, 3> wide;
+	for (int i=0; i<2; i++)
+		for (int j=0; j<3; j++)		wide(i,j) = 10*i + j;
+	vec3 r1 = wide.row(1);
+	printf("row of a 2x3 matrix: %g %g %g  (10 11 12)\n", r1(0), r1(1), r1(2));
+	mat8 t;		// bien conditionnée, sans symetrie
+	for (int i=0; i<8; i++)
+		for (int j=0; j<8; j++)		t(i,j) = 1. / (1 + i + 2*j) + (i == j);
+	mat8 m = t, expected = t;
+	m.row(2) = 2 * m.row(5) + 1;
+	m.col(4) += b;
+	m.diagonal() *= 3;
+	m.row(0) = m.row(1);		// copie des elements, pas de la vue
+	for (int j=0; j<8; j++)		expected(2,j) = 2*expected(5,j) + 1;
+	for (int i=0; i<8; i++)		expected(i,4) += b(i);
+	for (int i=0; i<8; i++)		expected(i,i) *= 3;
+	for (int j=0; j<8; j++)		expected(0,j) = expected(1,j);
+	int wrong = 0;
+	for (int i=0; i<8; i++)
+		for (int j=0; j<8; j++)		wrong += m(i,j) != expected(i,j);
+	printf("row, column and diagonal views: %d wrong elements\n", wrong);
+	
+	// inversion et factorisation d'un bloc, en place: le reste de la matrice n'est pas touché
+	mat8 big = t;
+	Matrix<float, 3, 3> sub = big.block<3,3>(2,4);
+	Matrix<float, 3, 3> subinv = sub.inverse();
+	big.block<3,3>(2,4).invert();
+	float blockerr = 0;
+	int touched = 0;
+	for (int i=0; i<8; i++)
+		for (int j=0; j<8; j++) {
+			bool inside = i >= 2 && i < 5 && j >= 4 && j < 7;
+			if (inside)		blockerr = fmaxf(blockerr, fabsf(big(i,j) - subinv(i-2,j-4)));
+			else			touched += big(i,j) != t(i,j);
+		}
+	Matrix<float, 3, 3> check = sub * big.block<3,3>(2,4) - Matrix<float,3,3>::identity();
+	LU<float, 3> sublu(t.block<3,3>(2,4));
+	vec3 sb = vec(1, 2, 3);
+	printf("block inverse: %g from the copied inverse, %g from identity, %d elements outside touched, block lu residual %g\n",
+		blockerr, fmaxf(fmaxf(check.col(0).norm(), check.col(1).norm()), check.col(2).norm()), touched, (sub * sublu.solve(sb) - sb).norm());
+	
 	return 0;
 }
@@ -1,4 +1,5 @@
 #include "model.h"
+#include "seeds.h"
 #include "linalg.h"
 #include <stdlib.h>
 #include <stdio.h>
@@ -9,20 +10,172 @@ using namespace la;
 int main() {
 	Delta delta;
 	
+	// point de depart au centre de l'espace de travail
 	vec8 x(0.);
-	x(2) = 15;
+	x(2) = 200;
 	
 // 	for (int i=0; i<10; i++) {
 // 		printf("run test %d\n", i);
-		vec8 q;
-		for (int i=0; i<N; i++) 	q(i) = float(random()) / RAND_MAX * M_PI_2;
+		// angles moteurs d'une pose atteignable au voisinage
+		vec8 target;
+		for (int i=0; i<N; i++) 	target(i) = x(i) + (float(random()) / RAND_MAX - 0.5) * (i<3? 20: 0.1);
+		vec8 q = delta.mgi(target).q;
 		for (int i=0; i<N; i++)		printf("  %f", q(i));
 		printf("\n");
 		
 // 		Delta::state s = delta.mgi(x);
 		Delta::state s = delta.mgd_solve(q, x);
+		for (int i=0; i<N; i++)		printf("  %f", s.q(i));
+		printf("\n  err %f\n", (s.q - q).norm());
 		x = s.X;
 // 	}
 	
-	return 0;
+	// suivi d'une trajectoire: Newton a chaque tick contre Broyden avec la jacobienne du tick precedent
+	Delta::broyden cache;
+	Delta::levenberg damping;
+	Delta::solve_info newton_info, broyden_info, lm_info;
+	vec8 xn = x, xb = x, xl = x;
+	int newton_calls = 0, broyden_calls = 0, lm_calls = 0, newton_mci = 0, broyden_mci = 0, lm_mci = 0;
+	float newton_residual = 0, broyden_residual = 0, lm_residual = 0;
+	for (int t=0; t<200; t++) {
+		vec8 pose = x;
+		pose(0) += 10*sin(0.05*t);
+		pose(1) += 10*cos(0.03*t);
+		pose(3) += 0.05*sin(0.04*t);
+		vec8 qt = delta.mgi(pose).q;
+		xn = delta.mgd_solve(qt, xn, &newton_info).X;
+		xb = delta.mgd_solve(qt, xb, cache, &broyden_info).X;
+		xl = delta.mgd_solve(qt, xl, damping, &lm_info).X;
+		lm_calls += lm_info.iterations;
+		lm_mci += lm_info.refreshes;
+		lm_residual = fmax(lm_residual, lm_info.residual);
+		newton_calls += newton_info.iterations;
+		broyden_calls += broyden_info.iterations;
+		newton_mci += newton_info.refreshes;
+		broyden_mci += broyden_info.refreshes;
+		newton_residual = fmax(newton_residual, newton_info.residual);
+		broyden_residual = fmax(broyden_residual, broyden_info.residual);
+	}
+	printf("newton:   %d mgi  %d mci  max residual %f\n", newton_calls, newton_mci, newton_residual);
+	printf("broyden:  %d mgi  %d mci  max residual %f\n", broyden_calls, broyden_mci, broyden_residual);
+	printf("lm:       %d mgi  %d mci  max residual %f\n", lm_calls, lm_mci, lm_residual);
+	
+	// la jacobienne par differentiation automatique contre des differences finies centrées du mgi,
+	// puis contre l'inverse de mci, y compris sans rotation et pour des rotations marquées
+	float err_fd = 0, err_ad = 0;
+	for (int t=0; t<20; t++) {
+		vec8 pose = x;
+		if (t)	for (int i=0; i<N; i++) 	pose(i) += (float(random()) / RAND_MAX - 0.5) * (i<3? 20: 0.6);
+		mat8 dqdX;
+		Delta::state s = delta.mgi(pose, dqdX);
+		for (int j=0; j<N; j++) {
+			const float h = j<3? 0.1: 0.01;	// pas ou l'arrondi des float (en 1/h) et la troncature (en h^2) restent sous 4e-4
+			vec8 plus = pose, minus = pose;
+			plus(j) += h;
+			minus(j) -= h;
+			vec8 fd = (delta.mgi(plus).q - delta.mgi(minus).q) / (2*h);
+			// ecart relatif a la plus grande derivée de la colonne
+			float scale = 0;
+			for (int i=0; i<N; i++)		scale = fmax(scale, fabs(fd(i)));
+			for (int i=0; i<N; i++)		err_fd = fmax(err_fd, fabs(dqdX(i,j) - fd(i)) / scale);
+		}
+		mat8 P = delta.mci(s) * dqdX;
+		for (int i=0; i<N; i++)
+			for (int j=0; j<N; j++)		err_ad = fmax(err_ad, fabs(P(i,j) - (i==j)));
+	}
+	printf("dq/dX against central differences:  max relative error %f\n", err_fd);
+	printf("mci * dq/dX:  max error from identity %f\n", err_ad);
+	bool jacobians_ok = err_fd < 1e-3 && err_ad < 1e-3;
+	
+	// point de depart: centre de l'espace de travail contre pose la plus proche de la table, pour des cibles quelconques
+	const int iterations = 8;	// limite de mgd_solve
+	srandom(12345);	// pas la graine de host/make_seeds: les cibles ne doivent pas etre des entrées de la table
+	int center_hist[iterations+2] = {0}, seed_hist[iterations+2] = {0};
+	int targets = 0, nearest_errors = 0;
+	vec8 center(0.);
+	center(2) = 200;
+	for (int t=0; t<500; t++) {
+		vec8 target;
+		const float range[] = {80, 80, 120, 0.6, 0.6, 0.6, 0.4, 0.4};
+		for (int i=0; i<N; i++) 	target(i) = (float(random()) / RAND_MAX - 0.5) * range[i];
+		target(2) += 180;
+		vec8 qt = delta.mgi(target).q;
+		if (qt.norm() != qt.norm())		continue;
+		targets++;
+		Delta::solve_info info;
+		delta.mgd_solve(qt, center, &info);
+		center_hist[info.converged ? info.iterations : iterations+1]++;
+		delta.mgd_solve(qt, &info);
+		seed_hist[info.converged ? info.iterations : iterations+1]++;
+		
+		// l'arbre doit trouver le meme plus proche voisin qu'une recherche exhaustive
+		float qf[N], qs[N];
+		for (int i=0; i<N; i++)		qf[i] = qt(i);
+		size_t best = 0;
+		float best2 = INFINITY;
+		for (size_t k=0; k<seeds::count(); k++) {
+			seeds::angles(k, qs);
+			float d2 = 0;
+			for (int i=0; i<N; i++)		d2 += sq(qs[i] - qf[i]);
+			if (d2 < best2)		{ best2 = d2; best = k; }
+		}
+		if (seeds::nearest(qf) != best)		nearest_errors++;
+	}
+	printf("%d targets, iterations (last column: not converged)\n  center:", targets);
+	for (int i=1; i<iterations+2; i++)		printf(" %d", center_hist[i]);
+	printf("\n  seed:  ");
+	for (int i=1; i<iterations+2; i++)		printf(" %d", seed_hist[i]);
+	printf("\n  nearest seed mismatches %d / %zu entries\n", nearest_errors, seeds::count());
+	
+	// Newton contre Levenberg-Marquardt depuis la table, sur tout l'espace atteignable, en separant les poses proches d'une singularité
+	const float singular_rcond = 3.5e-4;	// environ le dixieme le plus mal conditionné
+	int newton_hist[2][iterations+2] = {}, lm_hist[2][iterations+2] = {};
+	int newton_sum[2] = {0}, lm_sum[2] = {0}, counts[2] = {0};
+	for (int t=0; t<2000; ) {
+		vec8 target;
+		const float range[] = {120, 120, 200, 1.0, 1.0, 1.0, 0.8, 0.8};
+		for (int i=0; i<N; i++) 	target(i) = (float(random()) / RAND_MAX - 0.5) * range[i];
+		target(2) += 180;
+		Delta::state st = delta.mgi(target);
+		if (st.q.norm() != st.q.norm())		continue;
+		t++;
+		int near = delta.mci_factor(st).lu.rcond() < singular_rcond;
+		vec8 x0 = delta.seed(st.q);
+		Delta::solve_info info;
+		Delta::levenberg lm;
+		delta.mgd_solve(st.q, x0, &info);
+		newton_hist[near][info.converged ? info.iterations : iterations+1]++;
+		newton_sum[near] += info.iterations;
+		delta.mgd_solve(st.q, x0, lm, &info);
+		lm_hist[near][info.converged ? info.iterations : iterations+1]++;
+		lm_sum[near] += info.iterations;
+		counts[near]++;
+	}
+	for (int near=0; near<2; near++) {
+		printf("%s: %d targets, iterations (last column: not converged)\n  newton:", near ? "near singular" : "regular", counts[near]);
+		for (int i=1; i<iterations+2; i++)		printf(" %d", newton_hist[near][i]);
+		printf("   mean %.2f\n  lm:    ", float(newton_sum[near]) / counts[near]);
+		for (int i=1; i<iterations+2; i++)		printf(" %d", lm_hist[near][i]);
+		printf("   mean %.2f\n", float(lm_sum[near]) / counts[near]);
+	}
+	
+	// geometrie calculée a la compilation, comparée a la libm
+	{
+		static constexpr Delta flash;
+		const double phia = 23.19*M_PI/180, phib = 12.225*M_PI/180;
+		const double phi[2][8] = {
+			{phia, M_PI/2-phia, M_PI/2+phia, M_PI-phia, M_PI+phia, 3*M_PI/2-phia, 3*M_PI/2+phia, -phia},
+			{phib, M_PI/2-phib, M_PI/2+phib, M_PI-phib, M_PI+phib, 3*M_PI/2-phib, 3*M_PI/2+phib, -phib},
+		};
+		double err = 0;
+		for (int i=0; i<N; i++) {
+			err = fmax(err, fabs(flash.RgA[i](0) - 39*cos(phi[0][i])));
+			err = fmax(err, fabs(flash.RgA[i](1) - 39*sin(phi[0][i])));
+			err = fmax(err, fabs(flash.b[i](0) - 125*cos(phi[1][i])));
+			err = fmax(err, fabs(flash.b[i](1) - 125*sin(phi[1][i])));
+		}
+		printf("constexpr geometry: max error %g mm\n", err);
+	}
+	
+	return jacobians_ok ? 0 : 1;
 }
@@ -0,0 +1,111 @@
+#include "model.h"
+#include "observer.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+using namespace la;
+
+/*
+	trajectoire de main simulée: sinusoides de frequences incommensurables autour de la pose de repos
+	les angles sont quantifiés comme ceux des moteurs (codeur 12 bits, vitesse par pas de 0.229 rpm)
+*/
+static const float unit_angle = 2*M_PI/4095;
+static const float unit_velocity = 0.229 * 2*M_PI/60;
+static float quantize(float v, float unit)	{ return roundf(v / unit) * unit; }
+
+struct Trajectory {
+	float speed;	// facteur sur les frequences
+	vec8 X(float t) const {
+		const float amp[] = {30, 25, 20, 0.15, 0.15, 0.2, 0.1, 0.1};
+		const float freq[] = {0.8, 1.1, 0.6, 0.7, 0.9, 0.5, 1.3, 0.4};
+		vec8 x;
+		for (size_t i=0; i<N; i++)	x(i) = amp[i] * sin(2*M_PI*freq[i]*speed*t + i);
+		x(2) += 180;
+		return x;
+	}
+	vec8 dX(float t) const {
+		const float dt = 1e-4;
+		return (X(t+dt) - X(t-dt)) / (2*dt);
+	}
+};
+
+enum Seed { LAST, PREDICT, VELOCITY };
+static const char *seed_names[] = {"last pose", "alpha-beta", "alpha-beta+vel"};
+
+struct Result {
+	int hist[10];
+	long iterations;
+	int ticks;
+	double pose_err, pose_err_max;		// pose envoyée contre pose reelle au moment de l'envoi (mm)
+	double velocity_err;				// rms de l'erreur sur la vitesse estimée (mm/s), nulle sans observateur
+};
+
+static Result run(Delta &delta, const Trajectory &traj, Seed seed) {
+	const uint32_t period = 4000;	// µs, periode de la cinematique
+	const uint32_t send_delay = 3000;	// µs, age moyen de la pose au moment de l'envoi
+	Result r = {};
+	Delta::broyden cache;
+	Observer observer;
+	vec8 last = traj.X(0);
+	bool converged = true;
+	observer.reset(last, 0);
+	for (uint32_t t=period; t < 10000000; t+=period) {
+		float ts = t * 1e-6f;
+		vec8 X = traj.X(ts);
+		vec8 q;
+		mat8 dqdX;
+		vec8 exact = delta.mgi(X, dqdX).q;
+		vec8 dq = dqdX * traj.dX(ts);
+		for (size_t i=0; i<N; i++)	q(i) = quantize(exact(i), unit_angle);
+		
+		Delta::solve_info info;
+		// meme enchainement que kinematics() dans le croquis
+		vec8 x0 = !converged ? delta.seed(q) : seed == LAST ? last : observer.predict(t);
+		Delta::state s = delta.mgd_solve(q, x0, cache, &info);
+		last = s.X;
+		if (info.converged) {
+			if (converged)	observer.update(last, t);
+			else			observer.reset(last, t);
+			if (seed == VELOCITY) {
+				for (size_t i=0; i<N; i++)	dq(i) = quantize(dq(i), unit_velocity);
+				observer.update_velocity(delta.mci_factor(s).apply(dq));
+			}
+		}
+		converged = info.converged;
+		
+		r.hist[info.converged ? info.iterations : 9]++;
+		r.iterations += info.iterations;
+		r.ticks++;
+		vec8 sent = seed == LAST ? last : observer.predict(t + send_delay);
+		vec8 truth = traj.X(ts + send_delay*1e-6f);
+		float err = 0;
+		for (size_t i=0; i<3; i++)	err += sq(sent(i) - truth(i));
+		err = sqrt(err);
+		r.pose_err += err;
+		r.pose_err_max = fmax(r.pose_err_max, err);
+		vec8 v = seed == LAST ? vec8(0.) : observer.velocity();
+		vec8 dX = traj.dX(ts);
+		for (size_t i=0; i<3; i++)	r.velocity_err += sq(v(i) - dX(i));
+	}
+	r.pose_err /= r.ticks;
+	r.velocity_err = sqrt(r.velocity_err / r.ticks);
+	return r;
+}
+
+int main() {
+	Delta delta;
+	const float speeds[] = {0.3, 1, 3};
+	for (float speed : speeds) {
+		Trajectory traj = {speed};
+		printf("trajectory x%.1f, iterations per tick (last column: not converged)\n", speed);
+		printf("%-16s %6s  %-36s %9s %9s %11s\n", "seed", "mean", "histogram", "err mm", "max mm", "vel rms");
+		for (int s=LAST; s<=VELOCITY; s++) {
+			Result r = run(delta, traj, Seed(s));
+			printf("%-16s %6.2f ", seed_names[s], float(r.iterations) / r.ticks);
+			for (int i=1; i<10; i++)	printf(" %4d", r.hist[i]);
+			printf("  %8.3f  %8.3f  %10.2f\n", r.pose_err, r.pose_err_max, r.velocity_err);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1 @@
+g++ -O2 test_observer.cpp ../haptik/observer.cpp ../haptik/model.cpp ../haptik/seeds.cpp -I../haptik -o test_observer && exec ./test_observer
@@ -0,0 +1,47 @@
+#include "model.h"
+#include "probe.h"
+#include <stdlib.h>
+#include <stdio.h>
+
+using namespace la;
+
+/*
+	mesure de mgd_solve avec les sondes, le rapport est ecrit sur la sortie standard pour probe_report
+	compilé avec -DHAPTIK_PROBES=0, le rapport est vide
+*/
+int main() {
+	Delta delta;
+	Delta::broyden cache;
+	Delta::solve_info info;
+	vec8 x0(0.);
+	x0(2) = 200;
+	vec8 x = x0;
+	probe::init();
+	
+	for (int t=0; t<2000; t++) {
+		vec8 pose = x0;
+		pose(0) += 10*sin(0.05*t);
+		pose(1) += 10*cos(0.03*t);
+		pose(3) += 0.05*sin(0.04*t);
+		vec8 q;
+		{
+			PROBE(READ);
+			q = delta.mgi(pose).q;
+		}
+		{
+			PROBE(SOLVE);
+			x = delta.mgd_solve(q, x, cache, &info).X;
+		}
+		probe::record_iterations(info.iterations);
+		if (t % 10 == 0) {
+			PROBE(MCI);
+			delta.mci_factor(delta.mgi(x));
+		}
+		// cout d'une sonde vide
+		{ PROBE(WRITE); }
+	}
+	
+	char line[128];
+	for (size_t i=0; probe::format(i, line, sizeof(line)); i++)		printf("%s\n", line);
+	return 0;
+}
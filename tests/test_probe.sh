@@ -0,0 +1,5 @@
+g++ -O2 test_probe.cpp ../haptik/model.cpp ../haptik/seeds.cpp ../haptik/probe.cpp -I../haptik -o test_probe && \
+g++ -O2 test_probe.cpp ../haptik/model.cpp ../haptik/seeds.cpp ../haptik/probe.cpp -I../haptik -DHAPTIK_PROBES=0 -o test_probe_off && \
+g++ -O2 ../host/probe_report.cpp ../haptik/protocol.cpp -I../haptik -o probe_report && \
+echo "lines of report with probes disabled: $(./test_probe_off | wc -l)" && \
+./test_probe | ./probe_report
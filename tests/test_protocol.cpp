@@ -0,0 +1,125 @@
+#include "protocol.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+#include <thread>
+
+using namespace proto;
+
+static uint32_t now_us() {
+	timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return uint32_t(t.tv_sec * 1000000ull + t.tv_nsec / 1000);
+}
+
+/// taille du meme message en texte, tel que l'envoie send_pose (2 decimales par defaut de Serial.print)
+static size_t ascii_size(const Message &m) {
+	char text[256];
+	size_t size = sprintf(text, "pose ");
+	for (int i=0; i<8; i++)		size += sprintf(text+size, "%.2f,", m.vec[i]);
+	return size;
+}
+
+/// ouvre une paire de pseudo-terminaux en mode brut, comme un port serie
+static bool open_pty(int &master, int &slave) {
+	master = posix_openpt(O_RDWR | O_NOCTTY);
+	if (master < 0 || grantpt(master) || unlockpt(master))		return false;
+	slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+	if (slave < 0)	return false;
+	termios t;
+	tcgetattr(slave, &t);
+	cfmakeraw(&t);
+	tcsetattr(slave, TCSANOW, &t);
+	return true;
+}
+
+int main() {
+	// aller-retour de chaque type de message
+	Encoder encoder;
+	Decoder decoder;
+	Message sent[6], received;
+	uint8_t frame[max_frame];
+	const Type types[] = {POSE, FORCE, BLOCK, NONE, CONFIG, PING};
+	int roundtrip = 0;
+	for (int k=0; k<6; k++) {
+		memset(&sent[k], 0, sizeof(Message));
+		sent[k].type = types[k];
+		sent[k].timestamp = 1000*k;
+		for (int i=0; i<8; i++)		sent[k].vec[i] = (k==3)? 0 : i - 0.25f*k;
+		sent[k].config.flags = FEEDBACK | MEASURE;
+		sent[k].config.refresh = 5;
+		sent[k].echo = 123456789;
+		size_t size = encoder.encode(sent[k], frame);
+		for (size_t i=0; i<size; i++)
+			if (decoder.push(frame[i], received)) {
+				bool same = received.type == sent[k].type && received.seq == sent[k].seq && received.timestamp == sent[k].timestamp;
+				if (types[k] == CONFIG)		same = same && received.config.flags == sent[k].config.flags && received.config.refresh == sent[k].config.refresh;
+				else if (types[k] == PING)	same = same && received.echo == sent[k].echo;
+				else 						same = same && memcmp(received.vec, sent[k].vec, payload_size(types[k])) == 0;
+				roundtrip += same;
+			}
+	}
+	printf("roundtrip: %d/6 messages identical\n", roundtrip);
+	
+	// un octet corrompu est rejeté par le CRC, la trame suivante est decodée normalement
+	size_t size = encoder.encode(sent[0], frame);
+	frame[10] ^= 0x40;
+	for (size_t i=0; i<size; i++)	decoder.push(frame[i], received);
+	const char garbage[] = "force 1,2,3\n";
+	for (size_t i=0; i<sizeof(garbage); i++)	decoder.push(garbage[i], received);
+	bool resync = false;
+	size = encoder.encode(sent[1], frame);
+	for (size_t i=0; i<size; i++)	resync |= decoder.push(frame[i], received);
+	printf("corruption: %lu frames  %lu errors  %lu lost  resynchronized %d\n", decoder.frames, decoder.errors, decoder.lost, resync);
+	
+	printf("pose message: %zu bytes binary, %zu bytes ascii, %.0f poses/s at 57600 baud\n",
+		encoder.encode(sent[0], frame), ascii_size(sent[0]), 57600. / 10 / encoder.encode(sent[0], frame));
+	
+	// debit et latence sur une paire de pseudo-terminaux
+	int master, slave;
+	if (!open_pty(master, slave)) {
+		printf("pty: unavailable\n");
+		return 0;
+	}
+	const int count = 20000;
+	std::thread writer([&] {
+		Encoder encoder;
+		Message m = sent[0];
+		uint8_t frame[max_frame];
+		for (int k=0; k<count; k++) {
+			m.timestamp = now_us();
+			size_t size = encoder.encode(m, frame);
+			for (size_t done=0; done < size; ) {
+				ssize_t n = write(master, frame+done, size-done);
+				if (n > 0)	done += n;
+			}
+		}
+	});
+	Decoder reader;
+	uint8_t buffer[4096];
+	double latency = 0, max_latency = 0;
+	uint32_t start = now_us();
+	while (reader.frames + reader.errors + reader.lost < count) {
+		ssize_t n = read(slave, buffer, sizeof(buffer));
+		if (n <= 0)		break;
+		for (ssize_t i=0; i<n; i++)
+			if (reader.push(buffer[i], received)) {
+				double l = uint32_t(now_us() - received.timestamp);
+				latency += l;
+				max_latency = fmax(max_latency, l);
+			}
+	}
+	double elapsed = uint32_t(now_us() - start) * 1e-6;
+	writer.join();
+	close(slave);
+	close(master);
+	printf("pty: %lu frames  %lu errors  %lu lost  %.0f poses/s  latency mean %.0f us  max %.0f us\n",
+		reader.frames, reader.errors, reader.lost, reader.frames / elapsed, latency / reader.frames, max_latency);
+	
+	return 0;
+}
@@ -0,0 +1 @@
+g++ -O2 -pthread test_protocol.cpp ../haptik/protocol.cpp -I../haptik -o test_protocol && exec ./test_protocol
@@ -0,0 +1,109 @@
+#include "replay.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+/*
+	recalcul hors ligne (host/replay.h): memes colonnes quel que soit le nombre de fils, precision, et debit selon les fils
+	ecrit aussi l'enregistrement dans replay_q.bin pour host/replay_log (voir test_replay.sh)
+*/
+
+using namespace la;
+
+struct Output {
+	std::vector<double> data;
+	replay::Columns columns;
+	Output(size_t samples) : data((N+3) * samples) {
+		for (size_t i=0; i<N; i++)	columns.X[i] = &data[i * samples];
+		columns.iterations = &data[N * samples];
+		columns.residual = &data[(N+1) * samples];
+		columns.converged = &data[(N+2) * samples];
+	}
+};
+
+int main() {
+	static const Delta delta;
+
+	// enregistrement: mouvements de la main a 1 kHz, avec des echantillons perdus (NaN) et un saut de la plateforme
+	const size_t samples = 40000;
+	std::vector<float> q(N * samples);
+	std::vector<vec8> truth(samples);
+	const float amplitude[] = {20, 20, 30, 0.15, 0.15, 0.15, 0.1, 0.1};
+	const float pulsation[] = {2.1, 2.9, 1.3, 1.7, 2.3, 3.1, 2.7, 1.9};
+	for (size_t k=0; k<samples; k++) {
+		vec8 X;
+		for (int i=0; i<N; i++)		X(i) = amplitude[i] * sin(pulsation[i] * k * 1e-3f + i);
+		X(2) += 180;
+		if (k >= 20000)		X(0) += 15;		// saut
+		truth[k] = X;
+		vec8 qk = delta.mgi(X).q;
+		for (int i=0; i<N; i++)		q[N*k + i] = k % 9973 == 5000 ? NAN : qk(i);
+	}
+	FILE *log = fopen("replay_q.bin", "wb");
+	if (!log || fwrite(q.data(), sizeof(float), q.size(), log) != q.size()) {
+		perror("replay_q.bin");
+		return 1;
+	}
+	fclose(log);
+
+	// reference sur un seul fil, puis les memes morceaux sur plusieurs fils: colonnes identiques a l'octet pres
+	replay::Options options;
+	options.chunk = 1024;
+	options.threads = 1;
+	Output reference(samples);
+	replay::Report first = replay::run(delta, q.data(), samples, reference.columns, options);
+	float error = 0;
+	for (size_t k=0; k<samples; k++)
+		if (reference.columns.converged[k]) {
+			vec8 X;
+			for (int i=0; i<N; i++)		X(i) = reference.columns.X[i][k];
+			error = fmax(error, (X.segment<3>(0) - truth[k].segment<3>(0)).norm());
+		}
+	printf("%zu samples in %zu chunks: %zu converged, %zu restarted after a failure, max position error %.3f mm\n  iterations",
+		first.samples, first.chunks, first.converged, first.reseeded, error);
+	for (int n=1; n<=replay::max_iterations; n++)	printf(" %d:%zu", n, first.histogram[n]);
+	printf("\n");
+
+	unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+	printf("%u cores\n  %8s %10s %10s %10s\n", cores, "threads", "samples/s", "speedup", "identical");
+	bool deterministic = true;
+	for (unsigned threads : {1u, 2u, 3u, 4u, 8u}) {
+		options.threads = threads;
+		Output output(samples);
+		replay::Report report = replay::run(delta, q.data(), samples, output.columns, options);
+		bool same = !memcmp(output.data.data(), reference.data.data(), output.data.size() * sizeof(double))
+			&& report.converged == first.converged && !memcmp(report.histogram, first.histogram, sizeof(first.histogram));
+		deterministic = deterministic && same;
+		printf("  %8u %10.0f %9.2fx %10d\n", threads, samples / report.seconds, first.seconds / report.seconds, same);
+	}
+
+	// autre taille de morceaux: les resultats different a partir des debuts de morceaux, le solveur s'arretant des que l'erreur
+	// sur q est sous sa tolerance, la pose trouvée depend du point de depart
+	options.chunk = 100;
+	options.threads = 0;
+	Output small(samples);
+	replay::run(delta, q.data(), samples, small.columns, options);
+	float chunk_difference = 0;
+	for (size_t k=0; k<samples; k++)
+		if (small.columns.converged[k] && reference.columns.converged[k])
+			for (int i=0; i<3; i++)		chunk_difference = fmax(chunk_difference, fabs(small.columns.X[i][k] - reference.columns.X[i][k]));
+	printf("chunks of 100 against 1024: max position difference %.3f mm\n", chunk_difference);
+
+	// les autres methodes du solveur
+	for (replay::Method method : {replay::BROYDEN, replay::LEVENBERG}) {
+		options.method = method;
+		options.chunk = 1024;
+		Output a(samples), b(samples);
+		options.threads = 1;
+		replay::Report ra = replay::run(delta, q.data(), samples, a.columns, options);
+		options.threads = 4;
+		replay::run(delta, q.data(), samples, b.columns, options);
+		bool same = !memcmp(a.data.data(), b.data.data(), a.data.size() * sizeof(double));
+		deterministic = deterministic && same;
+		printf("%s: %zu converged, 1 and 4 threads identical %d\n", method == replay::BROYDEN ? "broyden" : "levenberg", ra.converged, same);
+	}
+	return deterministic ? 0 : 1;
+}
@@ -0,0 +1 @@
+g++ -O2 -pthread test_replay.cpp ../host/replay.cpp ../haptik/model.cpp ../haptik/seeds.cpp -I../haptik -I../host -o test_replay && g++ -O2 -pthread ../host/replay_log.cpp ../host/replay.cpp ../haptik/model.cpp ../haptik/seeds.cpp -I../haptik -o replay_log && ./test_replay && ./replay_log -j 2 replay_q.bin replay_out && cat replay_out/index.txt
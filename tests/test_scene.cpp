@@ -0,0 +1,135 @@
+#include "scene.h"
+#include "protocol.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#if defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+	static unsigned long long cycles()	{ return __rdtsc(); }
+#else
+	static unsigned long long cycles()	{ return 0; }
+#endif
+
+using namespace la;
+
+static vec8 pose(float x, float y, float z) {
+	vec8 X(0.);
+	X(0) = x;	X(1) = y;	X(2) = z;
+	return X;
+}
+static void print(const char *name, const vec8 &W) {
+	printf("  %-28s", name);
+	for (size_t i=0; i<N; i++)	printf(" %7.3f", W(i));
+	printf("\n");
+}
+
+int main() {
+	scene::Scene s;
+	const vec8 still(0.);
+	printf("memory: %zu bytes for %zu primitives and %zu path points\n", sizeof(scene::Scene), scene::max_primitives, scene::max_points);
+
+	// chaque primitive seule, effort attendu entre parentheses
+	printf("wrench per primitive\n");
+	const float plane[] = {0, 0, 1, 180, 2, 0.1};		// sol a z = 180
+	s.set(0, scene::PLANE, 0, plane, 6);
+	print("plane, 3 mm in (z 6)", s.evaluate(pose(0, 0, 177), still));
+	print("plane, outside (0)", s.evaluate(pose(0, 0, 181), still));
+	print("plane, moving out (0)", s.evaluate(pose(0, 0, 179), pose(0, 0, 100)));
+	s.set(0, scene::EMPTY, 0, nullptr, 0);
+
+	const float sphere[] = {0, 0, 200, 10, 1, 0};
+	s.set(1, scene::SPHERE, 0, sphere, 6);
+	print("sphere, 4 mm in (x 4)", s.evaluate(pose(6, 0, 200), still));
+	const float cavity = -10;
+	s.set(1, scene::SPHERE, 3, &cavity, 1);		// meme sphere, en cavité
+	print("cavity, 2 mm out (x -2)", s.evaluate(pose(12, 0, 200), still));
+	print("cavity, inside (0)", s.evaluate(pose(6, 0, 200), still));
+	s.set(1, scene::EMPTY, 0, nullptr, 0);
+
+	const float box[] = {0, 0, 200, 10, 20, 30, 1, 0};
+	s.set(2, scene::BOX, 0, box, 8);
+	print("box, 1 mm from +x (x 1)", s.evaluate(pose(9, 5, 210), still));
+	print("box, 2 mm from -y (y -2)", s.evaluate(pose(0, -18, 200), still));
+	s.set(2, scene::EMPTY, 0, nullptr, 0);
+
+	float spring[11] = {0, 0, 200, 0, 0, 0.1, 0, 0, 2, 100, 0.5};
+	s.set(3, scene::SPRING, 0, spring, 11);
+	vec8 X = pose(1, 0, 200);
+	print("spring (x -2, rz 10, vy -0.5)", s.evaluate(X, pose(0, 1, 0)));
+	s.set(3, scene::EMPTY, 0, nullptr, 0);
+
+	// trajectoire en L: (0,0,200) -> (20,0,200) -> (20,20,200)
+	const float points[] = {0, 0, 200,  20, 0, 200,  20, 20, 200};
+	s.set_points(6, points, 9);		// points 2 a 4
+	const float path[] = {2, 3, 1, 0.5, 1};
+	s.set(4, scene::PATH, 0, path, 5);
+	print("path, 3 mm off (y -2)", s.evaluate(pose(10, 3, 200), still));
+	print("path, in tube (0)", s.evaluate(pose(10, 0.5, 200), still));
+	print("path, along it (0)", s.evaluate(pose(10, 3, 200), pose(100, 0, 0)) - s.evaluate(pose(10, 3, 200), still));
+	print("path, 2nd leg (x 1)", s.evaluate(pose(18, 10, 200), still));
+
+	// mises a jour refusées, sans effet
+	int rejected = !s.set(scene::max_primitives, scene::PLANE, 0, plane, 6)
+		+ !s.set(0, scene::PLANE, 4, plane, 3)
+		+ !s.set(0, scene::Kind(scene::kinds), 0, plane, 1)
+		+ !s.set_points(3*scene::max_points - 2, points, 3);
+	printf("rejected updates: %d/4, scene still holds only the path: %d\n", rejected, s.primitive(0).kind == scene::EMPTY && s.primitive(4).kind == scene::PATH);
+	// bornes de trajectoire hors de la reserve de points: negatives, NaN, non entieres, trop grandes ou dont la somme deborde
+	const float bad_bounds[][2] = {{-1, 3}, {2, -3}, {NAN, 3}, {2, NAN}, {INFINITY, 1}, {2.5, 3}, {2, 1e20}, {60, 10}, {1e10, 1e10}};
+	int bad_rejected = 0;
+	for (const float *b : bad_bounds)
+		bad_rejected += !s.set(4, scene::PATH, 0, b, 2);
+	vec8 guided = s.evaluate(pose(10, 3, 200), still);
+	bool unchanged = s.primitive(4).params[0] == 2 && s.primitive(4).params[1] == 3;
+	printf("invalid path bounds rejected: %d/%zu, path unchanged %d, force finite %d\n", bad_rejected, sizeof(bad_bounds) / sizeof(bad_bounds[0]),
+		unchanged, guided.norm() == guided.norm() && guided.norm() < INFINITY);
+	bool bounds_ok = bad_rejected == int(sizeof(bad_bounds) / sizeof(bad_bounds[0])) && unchanged;
+
+	// chargement par messages, puis mise a jour d'un seul parametre (la hauteur du sol)
+	proto::Encoder encoder;
+	proto::Decoder decoder;
+	proto::Message m;
+	uint8_t frame[proto::max_frame];
+	s.clear();
+	m.type = proto::SCENE;
+	m.scene.slot = 5;
+	m.scene.kind = scene::PLANE;
+	m.scene.first = 0;
+	m.scene.count = 6;
+	for (int i=0; i<6; i++)		m.scene.values[i] = plane[i];
+	size_t size = encoder.encode(m, frame);
+	size_t total = size;
+	m.scene.first = 3;
+	m.scene.count = 1;
+	m.scene.values[0] = 190;
+	size_t update = encoder.encode(m, frame + size);
+	total += update;
+	proto::Message received;
+	for (size_t i=0; i<total; i++)
+		if (decoder.push(frame[i], received) && received.type == proto::SCENE)
+			s.set(received.scene.slot, scene::Kind(received.scene.kind), received.scene.first, received.scene.values, received.scene.count);
+	printf("messages: upload %zu bytes, update %zu bytes, %lu errors\n", size, update, decoder.errors);
+	print("raised plane (z 13)", s.evaluate(pose(0, 0, 183.5), still));
+
+	// cout d'une scene pleine
+	s.clear();
+	for (size_t i=0; i<scene::max_points; i++) {
+		float p[3] = {float(i), float(i%2), 200};
+		s.set_points(3*i, p, 3);
+	}
+	for (uint8_t k=0; k<scene::max_primitives; k++) {
+		switch (k % 5) {
+			case 0:	s.set(k, scene::PLANE, 0, plane, 6);	break;
+			case 1:	s.set(k, scene::SPHERE, 0, sphere, 6);	break;
+			case 2:	s.set(k, scene::BOX, 0, box, 8);		break;
+			case 3:	s.set(k, scene::SPRING, 0, spring, 11);	break;
+			case 4:	{ float p[] = {0, scene::max_points, 1, 0.5, 1};	s.set(k, scene::PATH, 0, p, 5); }
+		}
+	}
+	const int repeat = 10000;
+	volatile float sink = 0;
+	unsigned long long start = cycles();
+	for (int i=0; i<repeat; i++)	sink = sink + s.evaluate(pose(5 + (i&7), 2, 195), pose(1, 1, 0))(0);
+	printf("full scene (%zu primitives, %zu points): %.0f cycles per evaluation\n", scene::max_primitives, scene::max_points, double(cycles() - start) / repeat);
+	return bounds_ok ? 0 : 1;
+}
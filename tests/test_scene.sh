@@ -0,0 +1 @@
+g++ -O2 test_scene.cpp ../haptik/scene.cpp ../haptik/protocol.cpp -I../haptik -o test_scene && exec ./test_scene
@@ -0,0 +1,70 @@
+#include "scheduler.h"
+#include <stdio.h>
+
+/// horloge simulée: seules les taches et l'attente du test la font avancer
+static unsigned long now = 0;
+static unsigned long clock_us()		{ return now; }
+
+// durées simulées des taches (µs): le controle attend le bus, la cinematique a parfois besoin de plus d'iterations
+static int solves = 0;
+static void control()		{ now += 600; }
+static void kinematics()	{ now += (++solves % 50 == 0) ? 5000 : 1500; }
+static void communicate()	{ now += 300; }
+/// controle plus long que sa periode a chaque fois (bus avec le delai de retour d'usine)
+static void slow_control()	{ now += 2400; }
+/// l'ancienne loop(): tout a la suite a chaque periode, les communications une fois sur 10
+static int ticks = 0;
+static void sequential() {
+	control();
+	kinematics();
+	if (ticks++ % 10 == 0)	communicate();
+}
+
+static void report(const Scheduler &s, unsigned long duration) {
+	printf("%-12s %8s %8s %8s %8s %8s %10s %10s\n", "task", "period", "runs", "expected", "overruns", "skipped", "worst us", "latency us");
+	for (size_t i=0; i<s.size(); i++) {
+		const Scheduler::Task &t = s.task(i);
+		printf("%-12s %8u %8lu %8lu %8lu %8lu %10u %10u\n",
+			t.name, t.period, t.runs, duration / t.period, t.overruns, t.skipped, t.worst_time, t.worst_latency);
+	}
+}
+
+int main() {
+	// l'horloge part pres de son debordement pour le verifier
+	now = 0xFFFFFFFFul - 100000;
+	Scheduler scheduler(clock_us);
+	scheduler.add("control", control, 2000);
+	scheduler.add("kinematics", kinematics, 4000);
+	scheduler.add("comm", communicate, 20000);
+	
+	const unsigned long duration = 1000000;
+	for (unsigned long end = now + duration; int32_t(end - now) > 0; )
+		if (!scheduler.poll())	now += 10;
+	report(scheduler, duration);
+	
+	// la meme charge en une seule tache, comme l'ancienne loop(): le controle attend chaque resolution
+	now = 0;
+	solves = 0;
+	Scheduler single(clock_us);
+	single.add("sequential", sequential, 2000);
+	for (unsigned long end = now + duration; now < end; )
+		if (!single.poll())		now += 10;
+	report(single, duration);
+	
+	// le controle depasse sa periode a chaque execution: les autres taches doivent quand meme tourner
+	now = 0;
+	solves = 0;
+	Scheduler overloaded(clock_us);
+	overloaded.add("control", slow_control, 2000);
+	overloaded.add("kinematics", kinematics, 4000);
+	overloaded.add("comm", communicate, 20000);
+	for (unsigned long end = now + duration; now < end; )
+		if (!overloaded.poll())		now += 10;
+	report(overloaded, duration);
+	bool progress = true;
+	for (size_t i=0; i<overloaded.size(); i++)
+		progress = progress && overloaded.task(i).runs >= duration / overloaded.task(i).period / 10;
+	printf("overloaded control: every task ran at least a tenth of its rate %d\n", progress);
+	
+	return progress ? 0 : 1;
+}
@@ -0,0 +1 @@
+g++ -O2 test_scheduler.cpp ../haptik/scheduler.cpp -I../haptik -o test_scheduler && exec ./test_scheduler
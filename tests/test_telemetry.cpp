@@ -0,0 +1,131 @@
+#include "telemetry.h"
+#include "protocol.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+
+/*
+	enregistrement d'une seconde de controle a 500 Hz (mouvement de main simulé), puis decodage des blocs
+	la capture des trames est ecrite dans telemetry.bin pour host/telemetry_decode (voir test_telemetry.sh)
+*/
+
+using namespace telemetry;
+
+static const int ticks = 500;
+static const uint32_t period = 2000;	// µs
+static const uint32_t start = 4294000000u;	// l'horloge deborde pendant l'enregistrement
+
+static void signals(int tick, float *X, float *q, float *current, float *solver, float *loop) {
+	float t = tick * period * 1e-6f;
+	for (int i=0; i<8; i++) {
+		X[i] = (i < 3 ? 20 : 0.1) * sinf(2*M_PI*(0.7 + 0.1*i)*t + i) + (i == 2 ? 200 : 0);
+		q[i] = 0.4 * sinf(2*M_PI*(0.9 + 0.05*i)*t + i) + 0.3;
+		current[i] = roundf(40 * sinf(2*M_PI*3*t + i) / 2.69) * 2.69;	// pas du courant des moteurs
+	}
+	solver[0] = 1 + (tick % 7 == 0);
+	solver[1] = 1e-4 * (1 + tick % 5);
+	loop[0] = 900 + tick % 13;
+}
+
+/// enregistre ticks periodes avec ces decimations; a chaque communication (tous les every ticks) envoie au plus frames blocs
+/// retourne les trames envoyées, bout a bout
+static std::vector<uint8_t> run(const uint8_t *decimation, int every, size_t frames, Recorder &recorder) {
+	for (size_t c=0; c<channels; c++)	recorder.select(Channel(c), decimation[c]);
+	proto::Encoder encoder;
+	proto::Message message;
+	message.type = proto::TELEMETRY;
+	uint8_t frame[proto::max_frame];
+	std::vector<uint8_t> sent;
+	float X[8], q[8], current[8], solver[2], loop[1];
+	for (int k=0; k<ticks; k++) {
+		uint32_t time = start + k*period;
+		signals(k, X, q, current, solver, loop);
+		recorder.record(ANGLES, q, time);
+		recorder.record(CURRENT, current, time);
+		recorder.record(LOOP, loop, time);
+		recorder.record(POSE, X, time - 1000);
+		recorder.record(SOLVER, solver, time - 1000);
+		if (k % every == every-1) {
+			size_t size;
+			const uint8_t *block;
+			for (size_t f=0; f<frames && (block = recorder.next(size)); f++) {
+				message.length = size;
+				memcpy(message.text, block, size);
+				size_t length = encoder.encode(message, frame);
+				sent.insert(sent.end(), frame, frame + length);
+				recorder.release();
+			}
+		}
+	}
+	return sent;
+}
+
+struct Decoded {
+	unsigned long count[channels];
+	float err[channels];	// en pas de quantification
+	int misdated;
+	unsigned long skipped;
+};
+
+/// decode les trames, et compare chaque valeur au signal d'origine a l'instant de l'echantillon
+static Decoded decode(const std::vector<uint8_t> &sent) {
+	Decoded d = {};
+	proto::Decoder frames;
+	Decoder decoder;
+	proto::Message message;
+	for (uint8_t byte : sent) {
+		if (!frames.push(byte, message))	continue;
+		decoder.decode((const uint8_t *) message.text, message.length, [&](Channel c, uint32_t t, const float *values) {
+			d.count[c]++;
+			uint32_t elapsed = t - start + ((c == POSE || c == SOLVER) ? 1000 : 0);
+			d.misdated += elapsed % period != 0;
+			float ref[5][8];
+			signals(elapsed / period, ref[POSE], ref[ANGLES], ref[CURRENT], ref[SOLVER], ref[LOOP]);
+			for (size_t i=0; i<info[c].size; i++)	d.err[c] = fmax(d.err[c], fabs(values[i] - ref[c][i]) / info[c].unit[i]);
+		});
+	}
+	d.skipped = decoder.skipped;
+	return d;
+}
+
+int main() {
+	// toutes les voies, pose et mgd a la periode de la cinematique, sans limite de debit
+	const uint8_t all[] = {2, 1, 1, 2, 10};
+	Recorder recorder;
+	std::vector<uint8_t> sent = run(all, 1, blocks, recorder);
+	Decoded d = decode(sent);
+	printf("%-8s %8s %8s %14s\n", "channel", "samples", "expected", "max err/unit");
+	unsigned long values = 0;
+	for (size_t c=0; c<channels; c++) {
+		printf("%-8s %8lu %8d %14.3f\n", info[c].name, d.count[c], (ticks + all[c]-1) / all[c], d.err[c]);
+		values += d.count[c] * info[c].size;
+	}
+	printf("%zu bytes for %lu values: %.2f bytes per value (4 as raw floats), %d misdated samples, %lu dropped\n",
+		sent.size(), values, double(sent.size()) / values, d.misdated, recorder.dropped);
+	FILE *capture = fopen("telemetry.bin", "wb");
+	fwrite(sent.data(), 1, sent.size(), capture);
+	fclose(capture);
+
+	// un octet corrompu: la trame est rejetée, le decodeur attend le bloc clé suivant
+	std::vector<uint8_t> corrupted = sent;
+	corrupted[sent.size() / 3] ^= 0x10;
+	Decoded c = decode(corrupted);
+	unsigned long total = 0, kept = 0;
+	for (size_t i=0; i<channels; i++)	{ total += d.count[i];	kept += c.count[i]; }
+	printf("corrupted frame: %lu blocks skipped until the next key block, %lu/%lu samples decoded, max err/unit %.3f\n",
+		c.skipped, kept, total, fmax(fmax(c.err[POSE], c.err[ANGLES]), c.err[CURRENT]));
+
+	// debit du port serie a 57600 baud: 115 octets par communication, dont 43 pour la pose: un bloc de telemetrie
+	printf("link limited to one block per communication (%.0f bytes/s of telemetry):\n", 1e6 / (10*period) * (block_size + 11));
+	for (uint8_t decimation = 1; decimation <= 3; decimation++) {
+		const uint8_t angles[] = {0, decimation, 0, 0, 0};
+		Recorder limited;
+		Decoded l = decode(run(angles, 10, 1, limited));
+		printf("  angles every %d ticks: %.0f samples/s received, %lu dropped on the card\n",
+			decimation, l.count[ANGLES] / (ticks * period * 1e-6), limited.dropped);
+	}
+	printf("ascii pose for comparison: %.0f poses/s at most\n", 1e6 / (10*period));
+	return 0;
+}
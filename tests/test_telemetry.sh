@@ -0,0 +1,3 @@
+g++ -O2 test_telemetry.cpp ../haptik/telemetry.cpp ../haptik/protocol.cpp -I../haptik -o test_telemetry && \
+g++ -O2 ../host/telemetry_decode.cpp ../haptik/telemetry.cpp ../haptik/protocol.cpp -I../haptik -o telemetry_decode && \
+./test_telemetry && ./telemetry_decode telemetry.bin telemetry_out && cat telemetry_out/index.txt